@@ -0,0 +1,50 @@
+#ifndef __BENCH_COMMON_HH__
+#define __BENCH_COMMON_HH__
+
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "scenes.hh"
+
+namespace geom::bench
+{
+
+/**
+ * @brief Get scene generated once per process, so it isn't regenerated by every benchmark
+ */
+template <std::floating_point T>
+const std::vector<Triangle<T>> &cachedScene(Scene scene, std::size_t n)
+{
+  static std::map<std::pair<Scene, std::size_t>, std::vector<Triangle<T>>> cache{};
+  auto [it, isNew] = cache.try_emplace({scene, n});
+  if (isNew)
+    it->second = makeScene<T>(scene, n);
+
+  return it->second;
+}
+
+/**
+ * @brief Run benchmark for every scene kind and for 1K, 8K and 64K triangles
+ * @details
+ * Arguments are (n, scene). Straddling scene keeps all triangles in the root, so its query is
+ * quadratic and it stops at 8K.
+ */
+inline void sceneArgs(benchmark::internal::Benchmark *bench)
+{
+  for (auto scene : kScenes)
+  {
+    std::int64_t maxSize = Scene::STRADDLE == scene ? 1 << 13 : 1 << 16;
+    for (std::int64_t n = 1 << 10; n <= maxSize; n *= 8)
+      bench->Args({n, static_cast<std::int64_t>(scene)});
+  }
+
+  bench->ArgNames({"n", "scene"})->Unit(benchmark::kMillisecond);
+}
+
+} // namespace geom::bench
+
+#endif // __BENCH_COMMON_HH__
@@ -0,0 +1,39 @@
+#include <string>
+
+#include "common.hh"
+#include "intersection/intersection.hh"
+
+using namespace geom;
+using namespace geom::bench;
+
+namespace
+{
+
+template <std::floating_point T>
+void narrowPhase(benchmark::State &state)
+{
+  constexpr std::size_t kMaxPairs = 1 << 20;
+  auto n = static_cast<std::size_t>(state.range(0));
+  auto scene = static_cast<Scene>(state.range(1));
+  const auto &triangles = cachedScene<T>(scene, n);
+  auto pairs = candidatePairs(triangles, kMaxPairs);
+
+  std::size_t nIntersecting = 0;
+  for (auto _ : state)
+  {
+    nIntersecting = 0;
+    for (auto [lhs, rhs] : pairs)
+      nIntersecting += isIntersect(triangles[lhs], triangles[rhs]);
+    benchmark::DoNotOptimize(nIntersecting);
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(pairs.size()));
+  state.counters["pairs"] = static_cast<double>(pairs.size());
+  state.counters["hits"] = static_cast<double>(nIntersecting);
+  state.SetLabel(std::string{sceneName(scene)});
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(narrowPhase, float)->Apply(sceneArgs);
+BENCHMARK_TEMPLATE(narrowPhase, double)->Apply(sceneArgs);
@@ -0,0 +1,82 @@
+#include <memory_resource>
+#include <string>
+
+#include "common.hh"
+#include "kdtree/kdtree.hh"
+
+using namespace geom;
+using namespace geom::bench;
+using namespace geom::kdtree;
+
+namespace
+{
+
+template <std::floating_point T>
+void buildTree(benchmark::State &state)
+{
+  auto n = static_cast<std::size_t>(state.range(0));
+  auto scene = static_cast<Scene>(state.range(1));
+  const auto &triangles = cachedScene<T>(scene, n);
+
+  for (auto _ : state)
+  {
+    KdTree<T> tree{};
+    tree.build(triangles.begin(), triangles.end());
+    benchmark::DoNotOptimize(tree.nodeCount());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetLabel(std::string{sceneName(scene)});
+}
+
+/**
+ * @brief Build and destroy tree whose arrays are bump allocated in an arena released at once
+ */
+template <std::floating_point T>
+void buildTreeArena(benchmark::State &state)
+{
+  auto n = static_cast<std::size_t>(state.range(0));
+  auto scene = static_cast<Scene>(state.range(1));
+  const auto &triangles = cachedScene<T>(scene, n);
+
+  for (auto _ : state)
+  {
+    std::pmr::monotonic_buffer_resource arena{};
+    KdTree<T> tree{&arena};
+    tree.build(triangles.begin(), triangles.end());
+    benchmark::DoNotOptimize(tree.nodeCount());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.SetLabel(std::string{sceneName(scene)});
+}
+
+template <std::floating_point T>
+void queryTree(benchmark::State &state)
+{
+  auto n = static_cast<std::size_t>(state.range(0));
+  auto scene = static_cast<Scene>(state.range(1));
+  const auto &triangles = cachedScene<T>(scene, n);
+  KdTree<T> tree{triangles.begin(), triangles.end()};
+  IndexBitmap found{};
+
+  for (auto _ : state)
+  {
+    found.reset();
+    tree.findIntersectingIndices(found);
+    benchmark::DoNotOptimize(found);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.counters["found"] = static_cast<double>(found.count());
+  state.SetLabel(std::string{sceneName(scene)});
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(buildTree, float)->Apply(sceneArgs);
+BENCHMARK_TEMPLATE(buildTree, double)->Apply(sceneArgs);
+BENCHMARK_TEMPLATE(buildTreeArena, float)->Apply(sceneArgs);
+BENCHMARK_TEMPLATE(buildTreeArena, double)->Apply(sceneArgs);
+BENCHMARK_TEMPLATE(queryTree, float)->Apply(sceneArgs);
+BENCHMARK_TEMPLATE(queryTree, double)->Apply(sceneArgs);
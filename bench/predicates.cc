@@ -0,0 +1,79 @@
+#include <string>
+
+#include "common.hh"
+#include "intersection/predicates.hh"
+
+using namespace geom;
+using namespace geom::bench;
+
+namespace
+{
+
+/**
+ * @brief Rotate scene about x axis
+ * @details Rotated coordinates are rounded, so points of a coplanar sheet become only nearly
+ * coplanar and orient3d can't settle them in its first stages.
+ */
+template <std::floating_point T>
+std::vector<Triangle<T>> tilt(std::vector<Triangle<T>> triangles)
+{
+  constexpr auto kCos = static_cast<T>(0.8);
+  constexpr auto kSin = static_cast<T>(0.6);
+  for (auto &tr : triangles)
+    for (std::size_t k = 0; k < 3; ++k)
+    {
+      auto pt = tr[k];
+      tr[k] = {pt.x, kCos * pt.y - kSin * pt.z, kSin * pt.y + kCos * pt.z};
+    }
+
+  return triangles;
+}
+
+/**
+ * @brief orient3d of a triangle of every candidate pair and vertices of the other one
+ * @details Arguments are (scene, tilted), coplanar scenes show cost of the exact stages
+ */
+template <std::floating_point T>
+void orient3dPairs(benchmark::State &state)
+{
+  constexpr std::size_t kSize = 1 << 13;
+  constexpr std::size_t kMaxPairs = 1 << 18;
+  auto scene = static_cast<Scene>(state.range(0));
+  auto isTilted = state.range(1) != 0;
+  auto triangles = cachedScene<T>(scene, kSize);
+  if (isTilted)
+    triangles = tilt(std::move(triangles));
+
+  auto pairs = candidatePairs(triangles, kMaxPairs);
+
+  std::size_t nCoplanar = 0;
+  for (auto _ : state)
+  {
+    nCoplanar = 0;
+    for (auto [lhs, rhs] : pairs)
+    {
+      const auto &base = triangles[lhs];
+      for (const auto &pt : triangles[rhs])
+        nCoplanar += (0 == orient3d(base[0], base[1], base[2], pt));
+    }
+    benchmark::DoNotOptimize(nCoplanar);
+  }
+
+  state.SetItemsProcessed(state.iterations() * 3 * static_cast<std::int64_t>(pairs.size()));
+  state.counters["coplanar"] = static_cast<double>(nCoplanar);
+  state.SetLabel(std::string{sceneName(scene)} + (isTilted ? ", tilted" : ""));
+}
+
+void predicateArgs(benchmark::internal::Benchmark *bench)
+{
+  for (auto scene : {Scene::UNIFORM, Scene::COPLANAR})
+    for (std::int64_t isTilted : {0, 1})
+      bench->Args({static_cast<std::int64_t>(scene), isTilted});
+
+  bench->ArgNames({"scene", "tilted"});
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(orient3dPairs, float)->Apply(predicateArgs);
+BENCHMARK_TEMPLATE(orient3dPairs, double)->Apply(predicateArgs);
@@ -0,0 +1,236 @@
+#ifndef __BENCH_SCENES_HH__
+#define __BENCH_SCENES_HH__
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "primitives/primitives.hh"
+
+namespace geom::bench
+{
+
+/**
+ * @brief Kinds of synthetic scenes
+ */
+enum class Scene
+{
+  UNIFORM,   // small triangles spread uniformly over a cube
+  CLUSTERED, // small triangles packed into a few dense clusters
+  SLIVERS,   // long thin triangles along random axes
+  COPLANAR,  // triangles lying in a few parallel planes
+  STRADDLE   // triangles crossing the middle of the scene, i.e. the root separator
+};
+
+constexpr Scene kScenes[] = {Scene::UNIFORM, Scene::CLUSTERED, Scene::SLIVERS, Scene::COPLANAR,
+                             Scene::STRADDLE};
+
+inline std::string_view sceneName(Scene scene)
+{
+  switch (scene)
+  {
+  case Scene::UNIFORM:
+    return "uniform";
+  case Scene::CLUSTERED:
+    return "clustered";
+  case Scene::SLIVERS:
+    return "slivers";
+  case Scene::COPLANAR:
+    return "coplanar";
+  case Scene::STRADDLE:
+    return "straddle";
+  default:
+    throw std::invalid_argument("Unknown scene");
+  }
+}
+
+/**
+ * @class Random
+ * @brief Deterministic source of coordinates
+ * @details
+ * std::mt19937 output is fixed by the standard, unlike output of std distributions, so the same
+ * seed gives the same scene with any standard library.
+ */
+template <std::floating_point T>
+class Random final
+{
+private:
+  std::mt19937 gen_;
+
+public:
+  explicit Random(std::uint32_t seed) : gen_(seed)
+  {}
+
+  /**
+   * @brief Uniform number in [lo, hi)
+   */
+  T uniform(T lo, T hi)
+  {
+    auto unit = static_cast<T>(static_cast<double>(gen_()) / 0x1p32);
+    return lo + (hi - lo) * unit;
+  }
+
+  /**
+   * @brief Bell shaped number in (-radius, radius), sum of uniform ones
+   */
+  T bell(T radius)
+  {
+    return (uniform(-radius, radius) + uniform(-radius, radius) + uniform(-radius, radius)) / 3;
+  }
+
+  Vec3<T> point(T lo, T hi)
+  {
+    auto x = uniform(lo, hi);
+    auto y = uniform(lo, hi);
+    return {x, y, uniform(lo, hi)};
+  }
+
+  std::size_t index(std::size_t count)
+  {
+    std::size_t value = gen_();
+    return value % count;
+  }
+};
+
+/**
+ * @brief Generate scene of n triangles
+ * @details
+ * Scene side grows as cube root of n, so average number of neighbours of a triangle and
+ * fraction of intersecting ones stay about the same for every n.
+ *
+ * @param[in] scene kind of scene
+ * @param[in] n number of triangles
+ * @param[in] seed seed of generator, equal seeds give equal scenes
+ */
+template <std::floating_point T>
+std::vector<Triangle<T>> makeScene(Scene scene, std::size_t n, std::uint32_t seed = 1)
+{
+  Random<T> rnd{seed};
+  auto side = static_cast<T>(4 * std::cbrt(static_cast<double>(n)));
+  constexpr T kSize = 1;
+
+  std::vector<Triangle<T>> res{};
+  res.reserve(n);
+
+  auto nearby = [&rnd](const Vec3<T> &center, T size) {
+    return Triangle<T>{center + rnd.point(-size, size), center + rnd.point(-size, size),
+                       center + rnd.point(-size, size)};
+  };
+
+  switch (scene)
+  {
+  case Scene::UNIFORM:
+    for (std::size_t i = 0; i < n; ++i)
+      res.push_back(nearby(rnd.point(0, side), kSize));
+    break;
+
+  case Scene::CLUSTERED: {
+    constexpr std::size_t kClusters = 8;
+    std::vector<Vec3<T>> centers{};
+    for (std::size_t i = 0; i < kClusters; ++i)
+      centers.push_back(rnd.point(0, side));
+
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      const auto &center = centers[rnd.index(kClusters)];
+      auto x = rnd.bell(side / 8);
+      auto y = rnd.bell(side / 8);
+      res.push_back(nearby(center + Vec3<T>{x, y, rnd.bell(side / 8)}, kSize));
+    }
+    break;
+  }
+
+  case Scene::SLIVERS:
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      auto start = rnd.point(0, side);
+      auto dir = Vec3<T>{};
+      dir[rnd.index(3)] = side / 4;
+      auto width = rnd.point(-kSize / 100, kSize / 100);
+      res.push_back({start, start + dir, start + dir + width});
+    }
+    break;
+
+  case Scene::COPLANAR: {
+    constexpr std::size_t kSheets = 4;
+    auto sheetSide = side * static_cast<T>(std::sqrt(side / kSheets));
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      auto z = side * static_cast<T>(rnd.index(kSheets)) / kSheets;
+      auto x = rnd.uniform(0, sheetSide);
+      auto y = rnd.uniform(0, sheetSide);
+      auto tr = nearby({x, y, z}, kSize);
+      for (std::size_t k = 0; k < 3; ++k)
+        tr[k].z = z;
+      res.push_back(tr);
+    }
+    break;
+  }
+
+  case Scene::STRADDLE: {
+    /* Scene is the longest along x, so root is cut by x = 0 plane which every triangle crosses */
+    auto sheetSide = side * static_cast<T>(std::sqrt(side));
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      auto y = rnd.uniform(0, sheetSide);
+      auto z = rnd.uniform(0, sheetSide / 4);
+      auto tr = nearby({0, y, z}, kSize);
+      tr[0].x = -2 * sheetSide;
+      tr[1].x = 2 * sheetSide;
+      res.push_back(tr);
+    }
+    break;
+  }
+
+  default:
+    throw std::invalid_argument("Unknown scene");
+  }
+
+  return res;
+}
+
+/**
+ * @brief Find pairs of triangles with overlapping bound boxes, i.e. what broad phase passes to
+ * narrow phase
+ * @details
+ * Boxes are swept along y, which no generated scene keeps narrow. At most maxCount pairs are
+ * returned.
+ */
+template <std::floating_point T>
+std::vector<std::pair<std::size_t, std::size_t>> candidatePairs(
+  const std::vector<Triangle<T>> &triangles, std::size_t maxCount)
+{
+  std::vector<BoundBox<T>> boxes{};
+  std::vector<std::size_t> order(triangles.size());
+  for (std::size_t i = 0; i < triangles.size(); ++i)
+  {
+    boxes.push_back(triangles[i].boundBox());
+    order[i] = i;
+  }
+
+  std::sort(order.begin(), order.end(),
+            [&boxes](auto lhs, auto rhs) { return boxes[lhs].minY < boxes[rhs].minY; });
+
+  std::vector<std::pair<std::size_t, std::size_t>> res{};
+  for (std::size_t i = 0; i < order.size() && res.size() < maxCount; ++i)
+    for (std::size_t j = i + 1; j < order.size() && res.size() < maxCount; ++j)
+    {
+      const auto &lhs = boxes[order[i]];
+      const auto &rhs = boxes[order[j]];
+      if (rhs.minY > lhs.maxY)
+        break;
+      if (lhs.overlaps(rhs))
+        res.emplace_back(order[i], order[j]);
+    }
+
+  return res;
+}
+
+} // namespace geom::bench
+
+#endif // __BENCH_SCENES_HH__
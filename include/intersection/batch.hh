@@ -0,0 +1,496 @@
+#ifndef __INCLUDE_INTERSECTION_BATCH_HH__
+#define __INCLUDE_INTERSECTION_BATCH_HH__
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "intersection.hh"
+#include "prepared.hh"
+
+namespace geom
+{
+
+/**
+ * @brief Alignment of batch's coordinate streams, enough for 512-bit vector loads
+ */
+constexpr std::size_t kBatchAlign = 64;
+
+/**
+ * @class TriangleBatch
+ * @brief Up to N triangles stored in structure-of-arrays layout for batched narrow phase
+ * @details
+ * Every coordinate of every vertex, every plane parameter and every bound box bound is stored
+ * in its own aligned stream of N lanes, so one triangle is tested with the whole batch by
+ * plain loops over lanes which compiler turns into vector instructions of the target. Without
+ * -march flags x86-64 target is plain SSE2, so wider batches gain little there.
+ * Batch refers to the pushed triangles and their prepared data, they must outlive it.
+ *
+ * @tparam T - floating point type of coordinates
+ * @tparam N - number of lanes: 4, 8 or 16
+ */
+template <std::floating_point T, std::size_t N>
+class TriangleBatch final
+{
+  static_assert(N == 4 || N == 8 || N == 16, "TriangleBatch width must be 4, 8 or 16");
+
+public:
+  /**
+   * @brief Set of lanes, bit i stands for lane i
+   */
+  using Mask = std::uint32_t;
+
+  static constexpr std::size_t kWidth = N;
+
+private:
+  using Lanes = std::array<T, N>;
+
+  alignas(kBatchAlign) std::array<Lanes, 3> x_{}; // x_[k][i] is x of k-th vertex of lane i
+  alignas(kBatchAlign) std::array<Lanes, 3> y_{};
+  alignas(kBatchAlign) std::array<Lanes, 3> z_{};
+
+  alignas(kBatchAlign) Lanes normX_{};
+  alignas(kBatchAlign) Lanes normY_{};
+  alignas(kBatchAlign) Lanes normZ_{};
+  alignas(kBatchAlign) Lanes dist_{};
+  alignas(kBatchAlign) Lanes magnitude_{}; // max of |x| + |y| + |z| over lane's vertices
+  alignas(kBatchAlign) Lanes normErr_{};   // error bound of lane's unit normal, see normalError
+
+  alignas(kBatchAlign) std::array<Lanes, 3> boxMin_{}; // boxMin_[axis][i]
+  alignas(kBatchAlign) std::array<Lanes, 3> boxMax_{};
+
+  std::array<const Triangle<T> *, N> triangles_{};
+  std::array<const PreparedTriangle<T> *, N> prepared_{};
+  Mask valid_{};
+  std::size_t size_{};
+
+public:
+  std::size_t size() const;
+  bool empty() const;
+  bool full() const;
+  Mask lanes() const;
+
+  void clear();
+  void push(const Triangle<T> &tr, const PreparedTriangle<T> &prep);
+
+  const Triangle<T> &triangle(std::size_t lane) const;
+  const PreparedTriangle<T> &prepared(std::size_t lane) const;
+
+  Mask filter(const Triangle<T> &tr, const PreparedTriangle<T> &prep, T thres) const;
+
+private:
+  template <typename Pred>
+  static Mask toMask(Pred pred);
+};
+
+/**
+ * @brief Checks intersection of a triangle with every triangle of a batch
+ * @details
+ * Rejection by bound boxes and by sides of planes is done for all lanes at once, the rest of
+ * lanes, including degenerate triangles, are checked by scalar isIntersect(tr, prep, ...).
+ * Result for every lane is the same as result of the scalar version.
+ *
+ * @tparam T - floating point type of coordinates
+ * @tparam N - batch width
+ * @param tr triangle to test
+ * @param prep prepared data of tr
+ * @param batch triangles to test with
+ * @param lanes lanes of batch to test, the rest ones are not reported
+ * @param thres comparison threshold, all triangles must be prepared with it
+ * @return mask of lanes whose triangles intersect tr
+ */
+template <std::floating_point T, std::size_t N>
+typename TriangleBatch<T, N>::Mask isIntersect(const Triangle<T> &tr,
+                                               const PreparedTriangle<T> &prep,
+                                               const TriangleBatch<T, N> &batch,
+                                               typename TriangleBatch<T, N>::Mask lanes,
+                                               T thres = ThresComp<T>::getThreshold());
+
+/**
+ * @brief Checks intersection of a triangle with every triangle of a batch
+ *
+ * @tparam T - floating point type of coordinates
+ * @tparam N - batch width
+ * @param tr triangle to test
+ * @param prep prepared data of tr
+ * @param batch triangles to test with
+ * @return mask of lanes whose triangles intersect tr
+ */
+template <std::floating_point T, std::size_t N>
+typename TriangleBatch<T, N>::Mask isIntersect(const Triangle<T> &tr,
+                                               const PreparedTriangle<T> &prep,
+                                               const TriangleBatch<T, N> &batch);
+
+/**
+ * @brief Checks intersection of a triangle with lanes of a batch by isIntersectMixed
+ * @details Lanes are filtered as in isIntersect(tr, prep, batch, lanes)
+ *
+ * @tparam T - floating point type of coordinates
+ * @tparam N - batch width
+ * @param tr triangle to test
+ * @param prep prepared data of tr
+ * @param batch triangles to test with
+ * @param lanes lanes of batch to test, the rest ones are not reported
+ * @param thres comparison threshold in T, all triangles must be prepared with it
+ * @param thresDouble comparison threshold of the recheck in double
+ * @return mask of lanes whose triangles intersect tr
+ */
+template <std::floating_point T, std::size_t N>
+typename TriangleBatch<T, N>::Mask isIntersectMixed(
+  const Triangle<T> &tr, const PreparedTriangle<T> &prep, const TriangleBatch<T, N> &batch,
+  typename TriangleBatch<T, N>::Mask lanes, T thres = ThresComp<T>::getThreshold(),
+  double thresDouble = ThresComp<double>::getThreshold());
+
+/**
+ * @brief Find all triangles of a container which intersect a triangle
+ * @details
+ * Bound boxes, degeneracy and sides of tr's plane are checked on the coordinate streams of
+ * soa, kWidth lanes at a time. The rest of triangles are checked by scalar isIntersect, so
+ * the result is the same as testing every triangle with isIntersect(tr, soa[i], thres).
+ *
+ * @tparam T - floating point type of coordinates
+ * @param[in] tr triangle to test
+ * @param[in] soa triangles to test with
+ * @param[out] indices ascending indices of intersecting triangles are appended here
+ * @param[in] thres comparison threshold
+ */
+template <std::floating_point T>
+void findIntersectingIndices(const Triangle<T> &tr, const TriangleSoA<T> &soa,
+                             std::vector<std::size_t> &indices,
+                             T thres = ThresComp<T>::getThreshold());
+
+//============================================================================================
+//                                  TriangleBatch definitions
+//============================================================================================
+
+template <std::floating_point T, std::size_t N>
+std::size_t TriangleBatch<T, N>::size() const
+{
+  return size_;
+}
+
+template <std::floating_point T, std::size_t N>
+bool TriangleBatch<T, N>::empty() const
+{
+  return 0 == size_;
+}
+
+template <std::floating_point T, std::size_t N>
+bool TriangleBatch<T, N>::full() const
+{
+  return N == size_;
+}
+
+/**
+ * @brief Mask of filled lanes
+ */
+template <std::floating_point T, std::size_t N>
+auto TriangleBatch<T, N>::lanes() const -> Mask
+{
+  return static_cast<Mask>((std::uint64_t{1} << size_) - 1);
+}
+
+template <std::floating_point T, std::size_t N>
+void TriangleBatch<T, N>::clear()
+{
+  size_ = 0;
+  valid_ = 0;
+}
+
+template <std::floating_point T, std::size_t N>
+void TriangleBatch<T, N>::push(const Triangle<T> &tr, const PreparedTriangle<T> &prep)
+{
+  if (full())
+    throw std::length_error("TriangleBatch: push to a full batch");
+
+  auto lane = size_++;
+  for (std::size_t k = 0; k < 3; ++k)
+  {
+    x_[k][lane] = tr[k].x;
+    y_[k][lane] = tr[k].y;
+    z_[k][lane] = tr[k].z;
+  }
+
+  magnitude_[lane] = detail::magnitude(tr);
+  normErr_[lane] = prep.normErr;
+
+  const auto &norm = prep.plane.norm();
+  normX_[lane] = norm.x;
+  normY_[lane] = norm.y;
+  normZ_[lane] = norm.z;
+  dist_[lane] = prep.plane.dist();
+
+  std::size_t axisIdx = 0;
+  for (auto axis : {Axis::X, Axis::Y, Axis::Z})
+  {
+    boxMin_[axisIdx][lane] = prep.boundBox.min(axis);
+    boxMax_[axisIdx][lane] = prep.boundBox.max(axis);
+    ++axisIdx;
+  }
+
+  triangles_[lane] = &tr;
+  prepared_[lane] = &prep;
+  if (prep.isValid())
+    valid_ |= Mask{1} << lane;
+}
+
+template <std::floating_point T, std::size_t N>
+const Triangle<T> &TriangleBatch<T, N>::triangle(std::size_t lane) const
+{
+  return *triangles_[lane];
+}
+
+template <std::floating_point T, std::size_t N>
+const PreparedTriangle<T> &TriangleBatch<T, N>::prepared(std::size_t lane) const
+{
+  return *prepared_[lane];
+}
+
+/**
+ * @brief Find lanes which may intersect with tr
+ * @details
+ * Lane is dropped if its box is apart from tr's one or if both triangles are valid and
+ * one of them lies on one side of the other's plane farther than threshold plus error of the
+ * distance. Error covers rounding of the distance and deviation of the computed plane from the
+ * exact one, which is large for slivers, so the exact side is known for dropped lanes.
+ * tr against lane's plane is checked only if planes can't be equal as Plane::isEqual tells,
+ * near-equal planes are left to the scalar test. Such pairs are rejected by scalar narrow
+ * phase in T and in double, so filtering never changes the result. All branches are replaced
+ * with bitwise operations.
+ *
+ * @return mask of filled lanes which need the exact test
+ */
+template <std::floating_point T, std::size_t N>
+auto TriangleBatch<T, N>::filter(const Triangle<T> &tr, const PreparedTriangle<T> &prep,
+                                 T thres) const -> Mask
+{
+  const auto &bb = prep.boundBox;
+  auto overlap = toMask([&](std::size_t i) {
+    return (boxMin_[0][i] <= bb.maxX) & (bb.minX <= boxMax_[0][i]) &
+           (boxMin_[1][i] <= bb.maxY) & (bb.minY <= boxMax_[1][i]) &
+           (boxMin_[2][i] <= bb.maxZ) & (bb.minZ <= boxMax_[2][i]);
+  });
+  overlap &= lanes();
+  detail::countExits(NarrowExit::BOX,
+                     static_cast<std::uint64_t>(std::popcount(lanes() & ~overlap)));
+
+  if (0 == (overlap & valid_) || !prep.isValid())
+    return overlap;
+
+  auto isApart = [thres](T d0, T d1, T d2, T err) {
+    auto band = thres + err;
+    return ((d0 > band) & (d1 > band) & (d2 > band)) |
+           ((d0 < -band) & (d1 < -band) & (d2 < -band));
+  };
+
+  const auto &norm = prep.plane.norm();
+  auto dist = prep.plane.dist();
+  const auto &v0 = tr[0];
+  const auto &v1 = tr[1];
+  const auto &v2 = tr[2];
+  auto trMagnitude = detail::magnitude(tr);
+  auto trNormErr = detail::normalError(tr);
+  auto parSlack = thres + detail::kDistErrFactor<T>;
+
+  auto rejected = toMask([&](std::size_t i) {
+    /* Lane's triangle against tr's plane */
+    auto d0 = x_[0][i] * norm.x + y_[0][i] * norm.y + z_[0][i] * norm.z - dist;
+    auto d1 = x_[1][i] * norm.x + y_[1][i] * norm.y + z_[1][i] * norm.z - dist;
+    auto d2 = x_[2][i] * norm.x + y_[2][i] * norm.y + z_[2][i] * norm.z - dist;
+
+    /* tr against lane's plane */
+    auto e0 = v0.x * normX_[i] + v0.y * normY_[i] + v0.z * normZ_[i] - dist_[i];
+    auto e1 = v1.x * normX_[i] + v1.y * normY_[i] + v1.z * normZ_[i] - dist_[i];
+    auto e2 = v2.x * normX_[i] + v2.y * normY_[i] + v2.z * normZ_[i] - dist_[i];
+
+    /* Comparisons are widened by their rounding, so planes equal for the scalar test are too */
+    auto distSlack = thres + detail::kDistErrFactor<T> * (std::abs(dist) + std::abs(dist_[i]));
+    auto isPar = (std::abs(norm.y * normZ_[i] - norm.z * normY_[i]) <= parSlack) &
+                 (std::abs(norm.z * normX_[i] - norm.x * normZ_[i]) <= parSlack) &
+                 (std::abs(norm.x * normY_[i] - norm.y * normX_[i]) <= parSlack);
+    auto isEqual = isPar & (std::abs(normX_[i] * dist_[i] - norm.x * dist) <= distSlack) &
+                   (std::abs(normY_[i] * dist_[i] - norm.y * dist) <= distSlack) &
+                   (std::abs(normZ_[i] * dist_[i] - norm.z * dist) <= distSlack);
+
+    auto magnitudes = magnitude_[i] + trMagnitude;
+    auto errD = detail::kDistErrFactor<T> * (magnitude_[i] + std::abs(dist)) +
+                trNormErr * magnitudes;
+    auto errE = detail::kDistErrFactor<T> * (trMagnitude + std::abs(dist_[i])) +
+                normErr_[i] * magnitudes;
+
+    return isApart(d0, d1, d2, errD) | ((!isEqual) & isApart(e0, e1, e2, errE));
+  });
+
+  rejected &= overlap & valid_;
+  detail::countExits(NarrowExit::BATCH_SIDE, static_cast<std::uint64_t>(std::popcount(rejected)));
+
+  return overlap & ~rejected;
+}
+
+/**
+ * @brief Pack pred(i) of all lanes into mask
+ */
+template <std::floating_point T, std::size_t N>
+template <typename Pred>
+auto TriangleBatch<T, N>::toMask(Pred pred) -> Mask
+{
+  std::array<bool, N> flags{};
+  for (std::size_t i = 0; i < N; ++i)
+    flags[i] = pred(i);
+
+  Mask mask{};
+  for (std::size_t i = 0; i < N; ++i)
+    mask |= static_cast<Mask>(flags[i]) << i;
+
+  return mask;
+}
+
+//============================================================================================
+//                                    Batch intersection
+//============================================================================================
+
+namespace detail
+{
+
+/**
+ * @brief Run test(tr, prep, lane's triangle, lane's prepared data) for lanes passing the filter
+ */
+template <std::floating_point T, std::size_t N, typename Test>
+typename TriangleBatch<T, N>::Mask intersectLanes(const Triangle<T> &tr,
+                                                  const PreparedTriangle<T> &prep,
+                                                  const TriangleBatch<T, N> &batch,
+                                                  typename TriangleBatch<T, N>::Mask lanes,
+                                                  T thres, Test test)
+{
+  using Mask = typename TriangleBatch<T, N>::Mask;
+
+  auto candidates = batch.filter(tr, prep, thres) & lanes;
+  Mask res{};
+  while (candidates != 0)
+  {
+    auto lane = static_cast<std::size_t>(std::countr_zero(candidates));
+    candidates &= candidates - 1;
+
+    if (test(tr, prep, batch.triangle(lane), batch.prepared(lane)))
+      res |= Mask{1} << lane;
+  }
+
+  return res;
+}
+
+} // namespace detail
+
+template <std::floating_point T, std::size_t N>
+typename TriangleBatch<T, N>::Mask isIntersect(const Triangle<T> &tr,
+                                               const PreparedTriangle<T> &prep,
+                                               const TriangleBatch<T, N> &batch,
+                                               typename TriangleBatch<T, N>::Mask lanes,
+                                               T thres)
+{
+  return detail::intersectLanes(tr, prep, batch, lanes, thres,
+                                [thres](const auto &tr1, const auto &prep1, const auto &tr2,
+                                        const auto &prep2) {
+                                  return isIntersect(tr1, prep1, tr2, prep2, thres);
+                                });
+}
+
+template <std::floating_point T, std::size_t N>
+typename TriangleBatch<T, N>::Mask isIntersect(const Triangle<T> &tr,
+                                               const PreparedTriangle<T> &prep,
+                                               const TriangleBatch<T, N> &batch)
+{
+  return isIntersect(tr, prep, batch, batch.lanes());
+}
+
+template <std::floating_point T, std::size_t N>
+typename TriangleBatch<T, N>::Mask isIntersectMixed(const Triangle<T> &tr,
+                                                    const PreparedTriangle<T> &prep,
+                                                    const TriangleBatch<T, N> &batch,
+                                                    typename TriangleBatch<T, N>::Mask lanes,
+                                                    T thres, double thresDouble)
+{
+  return detail::intersectLanes(tr, prep, batch, lanes, thres,
+                                [thres, thresDouble](const auto &tr1, const auto &prep1,
+                                                     const auto &tr2, const auto &prep2) {
+                                  return isIntersectMixed(tr1, prep1, tr2, prep2, thres,
+                                                          thresDouble);
+                                });
+}
+
+template <std::floating_point T>
+void findIntersectingIndices(const Triangle<T> &tr, const TriangleSoA<T> &soa,
+                             std::vector<std::size_t> &indices, T thres)
+{
+  constexpr auto kWidth = TriangleSoA<T>::kWidth;
+
+  PreparedTriangle<T> prep{tr, thres};
+  const auto &bb = prep.boundBox;
+  const auto &norm = prep.plane.norm();
+  auto dist = prep.plane.dist();
+  auto isValid = prep.isValid();
+  auto trMagnitude = detail::magnitude(tr);
+  auto trNormErr = isValid ? detail::normalError(tr) : T{};
+
+  std::array<const T *, 3> xs{soa.x(0), soa.x(1), soa.x(2)};
+  std::array<const T *, 3> ys{soa.y(0), soa.y(1), soa.y(2)};
+  std::array<const T *, 3> zs{soa.z(0), soa.z(1), soa.z(2)};
+
+  for (std::size_t first = 0; first < soa.paddedSize(); first += kWidth)
+  {
+    /* NaN padding lanes fail box test */
+    std::array<bool, kWidth> isCandidate{};
+    for (std::size_t lane = 0; lane < kWidth; ++lane)
+    {
+      auto i = first + lane;
+      auto x0 = xs[0][i], x1 = xs[1][i], x2 = xs[2][i];
+      auto y0 = ys[0][i], y1 = ys[1][i], y2 = ys[2][i];
+      auto z0 = zs[0][i], z1 = zs[1][i], z2 = zs[2][i];
+
+      auto overlaps = (std::min({x0, x1, x2}) - thres <= bb.maxX) &
+                      (bb.minX <= std::max({x0, x1, x2}) + thres) &
+                      (std::min({y0, y1, y2}) - thres <= bb.maxY) &
+                      (bb.minY <= std::max({y0, y1, y2}) + thres) &
+                      (std::min({z0, z1, z2}) - thres <= bb.maxZ) &
+                      (bb.minZ <= std::max({z0, z1, z2}) + thres);
+
+      /* Lane's triangle is valid if cross product of its edges is not zero */
+      auto ex1 = x1 - x0, ey1 = y1 - y0, ez1 = z1 - z0;
+      auto ex2 = x2 - x0, ey2 = y2 - y0, ez2 = z2 - z0;
+      auto isLaneValid = (std::abs(ey1 * ez2 - ez1 * ey2) >= thres) |
+                         (std::abs(ez1 * ex2 - ex1 * ez2) >= thres) |
+                         (std::abs(ex1 * ey2 - ey1 * ex2) >= thres);
+
+      auto d0 = x0 * norm.x + y0 * norm.y + z0 * norm.z - dist;
+      auto d1 = x1 * norm.x + y1 * norm.y + z1 * norm.z - dist;
+      auto d2 = x2 * norm.x + y2 * norm.y + z2 * norm.z - dist;
+      auto magnitude = std::max({std::abs(x0) + std::abs(y0) + std::abs(z0),
+                                 std::abs(x1) + std::abs(y1) + std::abs(z1),
+                                 std::abs(x2) + std::abs(y2) + std::abs(z2)});
+      auto band = thres + detail::kDistErrFactor<T> * (magnitude + std::abs(dist)) +
+                  trNormErr * (magnitude + trMagnitude);
+      auto isApart = ((d0 > band) & (d1 > band) & (d2 > band)) |
+                     ((d0 < -band) & (d1 < -band) & (d2 < -band));
+
+      isCandidate[lane] = overlaps & !(isValid & isLaneValid & isApart);
+    }
+
+    for (std::size_t lane = 0; lane < kWidth; ++lane)
+    {
+      if (!isCandidate[lane])
+        continue;
+
+      auto i = first + lane;
+      auto other = soa[i];
+      if (isIntersect(tr, prep, other, PreparedTriangle<T>{other, thres}, thres))
+        indices.push_back(i);
+    }
+  }
+}
+
+} // namespace geom
+
+#endif // __INCLUDE_INTERSECTION_BATCH_HH__
@@ -1,13 +1,19 @@
 #ifndef __INCLUDE_INTERSECTION_DETAIL_HH__
 #define __INCLUDE_INTERSECTION_DETAIL_HH__
 
+#include <algorithm>
+#include <cmath>
 #include <concepts>
+#include <iterator>
+#include <limits>
 #include <variant>
 
 #include "distance/distance.hh"
 #include "primitives/primitives.hh"
 #include "primitives/vec2.hh"
 
+#include "predicates.hh"
+
 namespace geom::detail
 {
 
@@ -24,40 +30,94 @@ template <std::floating_point T>
 bool isIntersect2D(const Triangle<T> &tr1, const Triangle<T> &tr2);
 
 template <std::floating_point T>
-bool isIntersectMollerHaines(const Triangle<T> &tr1, const Triangle<T> &tr2);
+bool isIntersect2D(const Plane<T> &pl, const Triangle<T> &tr1, const Triangle<T> &tr2);
+
+template <std::floating_point T>
+bool isIntersectMollerHaines(const Triangle<T> &tr1, const Triangle<T> &tr2,
+                             T thres = ThresComp<T>::getThreshold());
+
+template <std::floating_point T>
+bool isIntersectMollerHaines(const Triangle<T> &tr1, const Plane<T> &pl1, const Triangle<T> &tr2,
+                             const Plane<T> &pl2, T thres = ThresComp<T>::getThreshold());
+
+template <std::floating_point T>
+Segment2D<T> helperMollerHaines(const Triangle<T> &tr, const Plane<T> &pl, const Line<T> &l,
+                                T thres = ThresComp<T>::getThreshold());
+
+template <std::floating_point T>
+bool isIntersectBothInvalid(const Triangle<T> &tr1, const Triangle<T> &tr2,
+                            T thres = ThresComp<T>::getThreshold());
 
 template <std::floating_point T>
-Segment2D<T> helperMollerHaines(const Triangle<T> &tr, const Plane<T> &pl, const Line<T> &l);
+bool isIntersectValidInvalid(const Triangle<T> &valid, const Triangle<T> &invalid,
+                             T thres = ThresComp<T>::getThreshold());
 
 template <std::floating_point T>
-bool isIntersectBothInvalid(const Triangle<T> &tr1, const Triangle<T> &tr2);
+bool isIntersectValidInvalid(const Triangle<T> &valid, const Plane<T> &pl,
+                             const Triangle<T> &invalid, T thres = ThresComp<T>::getThreshold());
 
 template <std::floating_point T>
-bool isIntersectValidInvalid(const Triangle<T> &valid, const Triangle<T> &invalid);
+bool isIntersectPointTriangle(const Vec3<T> &pt, const Triangle<T> &tr,
+                              T thres = ThresComp<T>::getThreshold());
 
 template <std::floating_point T>
-bool isIntersectPointTriangle(const Vec3<T> &pt, const Triangle<T> &tr);
+bool isIntersectPointTriangle(const Vec3<T> &pt, const Triangle<T> &tr, const Plane<T> &pl,
+                              T thres = ThresComp<T>::getThreshold());
 
 template <std::floating_point T>
-bool isIntersectPointSegment(const Vec3<T> &pt, const Segment3D<T> &segm);
+bool isIntersectPointSegment(const Vec3<T> &pt, const Segment3D<T> &segm,
+                             T thres = ThresComp<T>::getThreshold());
 
 template <std::floating_point T>
-bool isIntersectSegmentSegment(const Segment3D<T> &segm1, const Segment3D<T> &segm2);
+bool isIntersectSegmentSegment(const Segment3D<T> &segm1, const Segment3D<T> &segm2,
+                               T thres = ThresComp<T>::getThreshold());
 
 template <std::floating_point T>
-bool isPoint(const Triangle<T> &tr);
+bool isPoint(const Triangle<T> &tr, T thres = ThresComp<T>::getThreshold());
 
 template <std::floating_point T>
 bool isOverlap(Segment2D<T> &segm1, Segment2D<T> &segm2);
 
 template <std::forward_iterator It>
-bool isAllPosNeg(It begin, It end);
+bool isAllPosNeg(It begin, It end,
+                 std::iter_value_t<It> thres = ThresComp<std::iter_value_t<It>>::getThreshold());
 
 template <std::floating_point T>
-bool isAllPosNeg(T num1, T num2);
+bool isAllPosNeg(T num1, T num2, T thres = ThresComp<T>::getThreshold());
 
 template <std::floating_point T>
-bool isOnOneSide(const Plane<T> &pl, const Triangle<T> &tr);
+bool isOnOneSide(const Plane<T> &pl, const Triangle<T> &tr, T thres = ThresComp<T>::getThreshold());
+
+template <std::floating_point T>
+bool isOnOneSide(const Triangle<T> &base, const Plane<T> &pl, T normErr, const Triangle<T> &tr,
+                 T thres = ThresComp<T>::getThreshold());
+
+/**
+ * @brief Signed distance to plane computed in T is off by less than this times magnitude of its
+ * terms
+ */
+template <std::floating_point T>
+constexpr T kDistErrFactor = 8 * std::numeric_limits<T>::epsilon();
+
+/**
+ * @brief Unit normal computed in T is off by less than this times |e1|_1 |e2|_1 / |e1 x e2| for
+ * edges e1, e2 of the triangle
+ */
+template <std::floating_point T>
+constexpr T kNormErrFactor = 16 * std::numeric_limits<T>::epsilon();
+
+template <std::floating_point T>
+T magnitude(const Triangle<T> &tr);
+
+template <std::floating_point T>
+T normalError(const Triangle<T> &tr);
+
+template <std::floating_point T>
+bool isBorderline(const Plane<T> &pl, const Triangle<T> &tr,
+                  T thres = ThresComp<T>::getThreshold());
+
+template <std::floating_point U, std::floating_point T>
+Triangle<U> toPrecision(const Triangle<T> &tr);
 
 template <std::floating_point T>
 Trian2<T> getTrian2(const Plane<T> &pl, const Triangle<T> &tr);
@@ -72,15 +132,21 @@ template <std::floating_point T>
 Segment3D<T> getSegment(const Triangle<T> &tr);
 
 template <std::bidirectional_iterator It>
-std::size_t roguePos(It begin, It end);
+std::size_t roguePos(It begin, It end,
+                     std::iter_value_t<It> thres =
+                       ThresComp<std::iter_value_t<It>>::getThreshold());
 
 //======================================================================
 
 template <std::floating_point T>
 bool isIntersect2D(const Triangle<T> &tr1, const Triangle<T> &tr2)
 {
-  auto pl = tr1.getPlane();
+  return isIntersect2D(tr1.getPlane(), tr1, tr2);
+}
 
+template <std::floating_point T>
+bool isIntersect2D(const Plane<T> &pl, const Triangle<T> &tr1, const Triangle<T> &tr2)
+{
   auto trian1 = getTrian2(pl, tr1);
   auto trian2 = getTrian2(pl, tr2);
 
@@ -100,21 +166,26 @@ bool isIntersect2D(const Triangle<T> &tr1, const Triangle<T> &tr2)
 }
 
 template <std::floating_point T>
-bool isIntersectMollerHaines(const Triangle<T> &tr1, const Triangle<T> &tr2)
+bool isIntersectMollerHaines(const Triangle<T> &tr1, const Triangle<T> &tr2, T thres)
 {
-  auto pl1 = tr1.getPlane();
-  auto pl2 = tr2.getPlane();
+  return isIntersectMollerHaines(tr1, tr1.getPlane(), tr2, tr2.getPlane(), thres);
+}
 
-  auto l = std::get<Line<T>>(intersect(pl1, pl2));
+template <std::floating_point T>
+bool isIntersectMollerHaines(const Triangle<T> &tr1, const Plane<T> &pl1, const Triangle<T> &tr2,
+                             const Plane<T> &pl2, T thres)
+{
+  auto l = std::get<Line<T>>(intersect(pl1, pl2, thres));
 
-  auto params1 = helperMollerHaines(tr1, pl2, l);
-  auto params2 = helperMollerHaines(tr2, pl1, l);
+  auto params1 = helperMollerHaines(tr1, pl2, l, thres);
+  auto params2 = helperMollerHaines(tr2, pl1, l, thres);
 
   return isOverlap(params1, params2);
 }
 
 template <std::floating_point T>
-Segment2D<T> helperMollerHaines(const Triangle<T> &tr, const Plane<T> &pl, const Line<T> &l)
+Segment2D<T> helperMollerHaines(const Triangle<T> &tr, const Plane<T> &pl, const Line<T> &l,
+                                T thres)
 {
   /* Project the triangle vertices onto line */
   std::array<T, 3> vert{};
@@ -125,7 +196,7 @@ Segment2D<T> helperMollerHaines(const Triangle<T> &tr, const Plane<T> &pl, const
   std::transform(tr.begin(), tr.end(), sdist.begin(), std::bind_front(distance<T>, pl));
 
   /* Looking for vertex which is alone on it's side */
-  std::size_t rogue = roguePos(sdist.begin(), sdist.end());
+  std::size_t rogue = roguePos(sdist.begin(), sdist.end(), thres);
 
   std::array<T, 2> segm{};
   std::array<size_t, 2> arr{(rogue + 1) % 3, (rogue + 2) % 3};
@@ -137,31 +208,37 @@ Segment2D<T> helperMollerHaines(const Triangle<T> &tr, const Plane<T> &pl, const
 }
 
 template <std::floating_point T>
-bool isIntersectBothInvalid(const Triangle<T> &tr1, const Triangle<T> &tr2)
+bool isIntersectBothInvalid(const Triangle<T> &tr1, const Triangle<T> &tr2, T thres)
 {
-  auto isPoint1 = isPoint(tr1);
-  auto isPoint2 = isPoint(tr2);
+  auto isPoint1 = isPoint(tr1, thres);
+  auto isPoint2 = isPoint(tr2, thres);
 
   if (isPoint1 && isPoint2)
-    return tr1[0] == tr2[0];
+    return tr1[0].isEqual(tr2[0], thres);
 
   if (isPoint1)
-    return isIntersectPointSegment(tr1[0], getSegment(tr2));
+    return isIntersectPointSegment(tr1[0], getSegment(tr2), thres);
 
   if (isPoint2)
-    return isIntersectPointSegment(tr2[0], getSegment(tr1));
+    return isIntersectPointSegment(tr2[0], getSegment(tr1), thres);
+
+  return isIntersectSegmentSegment(getSegment(tr1), getSegment(tr2), thres);
+}
 
-  return isIntersectSegmentSegment(getSegment(tr1), getSegment(tr2));
+template <std::floating_point T>
+bool isIntersectValidInvalid(const Triangle<T> &valid, const Triangle<T> &invalid, T thres)
+{
+  return isIntersectValidInvalid(valid, valid.getPlane(), invalid, thres);
 }
 
 template <std::floating_point T>
-bool isIntersectValidInvalid(const Triangle<T> &valid, const Triangle<T> &invalid)
+bool isIntersectValidInvalid(const Triangle<T> &valid, const Plane<T> &pl,
+                             const Triangle<T> &invalid, T thres)
 {
-  if (isPoint(invalid))
-    return isIntersectPointTriangle(invalid[0], valid);
+  if (isPoint(invalid, thres))
+    return isIntersectPointTriangle(invalid[0], valid, pl, thres);
 
   auto segm = getSegment(invalid);
-  auto pl = valid.getPlane();
 
   auto dst1 = distance(pl, segm.first);
   auto dst2 = distance(pl, segm.second);
@@ -169,20 +246,27 @@ bool isIntersectValidInvalid(const Triangle<T> &valid, const Triangle<T> &invali
   if (dst1 * dst2 > 0)
     return false;
 
-  if (isZeroThreshold(dst1) && isZeroThreshold(dst2))
-    return isIntersect2D(valid, invalid);
+  if (isZeroThreshold(dst1, thres) && isZeroThreshold(dst2, thres))
+    return isIntersect2D(pl, valid, invalid);
 
   dst1 = std::abs(dst1);
   dst2 = std::abs(dst2);
 
   auto pt = segm.first + (segm.second - segm.first) * dst1 / (dst1 + dst2);
-  return isIntersectPointTriangle(pt, valid);
+  return isIntersectPointTriangle(pt, valid, pl, thres);
+}
+
+template <std::floating_point T>
+bool isIntersectPointTriangle(const Vec3<T> &pt, const Triangle<T> &tr, T thres)
+{
+  return isIntersectPointTriangle(pt, tr, tr.getPlane(), thres);
 }
 
 template <std::floating_point T>
-bool isIntersectPointTriangle(const Vec3<T> &pt, const Triangle<T> &tr)
+bool isIntersectPointTriangle(const Vec3<T> &pt, const Triangle<T> &tr, const Plane<T> &pl,
+                              T thres)
 {
-  if (!tr.getPlane().belongs(pt))
+  if (!pl.belongs(pt, thres))
     return false;
 
   /* TODO: comment better */
@@ -203,51 +287,50 @@ bool isIntersectPointTriangle(const Vec3<T> &pt, const Triangle<T> &tr)
   auto v = (dotE1E1 * dotE2PT - dotE1E2 * dotE1PT) / denom;
 
   /* Point belongs to triangle if: (u >= 0) && (v >= 0) && (u + v <= 1) */
-  auto eps = ThresComp<T>::getThreshold();
-  return (u > -eps) && (v > -eps) && (u + v < 1 + eps);
+  return (u > -thres) && (v > -thres) && (u + v < 1 + thres);
 }
 
 template <std::floating_point T>
-bool isIntersectPointSegment(const Vec3<T> &pt, const Segment3D<T> &segm)
+bool isIntersectPointSegment(const Vec3<T> &pt, const Segment3D<T> &segm, T thres)
 {
   Line<T> l{segm.first, segm.second - segm.first};
-  if (!l.belongs(pt))
+  if (!l.belongs(pt, thres))
     return false;
 
   auto beg = dot(l.dir(), segm.first - pt);
   auto end = dot(l.dir(), segm.second - pt);
 
-  return !isAllPosNeg(beg, end);
+  return !isAllPosNeg(beg, end, thres);
 }
 
 template <std::floating_point T>
-bool isIntersectSegmentSegment(const Segment3D<T> &segm1, const Segment3D<T> &segm2)
+bool isIntersectSegmentSegment(const Segment3D<T> &segm1, const Segment3D<T> &segm2, T thres)
 {
   Line<T> l1{segm1.first, segm1.second - segm1.first};
   Line<T> l2{segm2.first, segm2.second - segm2.first};
-  auto intersectionResult = intersect(l1, l2);
+  auto intersectionResult = intersect(l1, l2, thres);
 
   if (std::holds_alternative<Line<T>>(intersectionResult))
   {
     const auto &dir = l1.dir();
-    Segment2D<T> s1{dot(dir, segm1.first), dot(dir, segm1.second)};
-    Segment2D<T> s2{dot(dir, segm2.first), dot(dir, segm2.second)};
+    Segment2D<T> s1 = std::minmax(dot(dir, segm1.first), dot(dir, segm1.second));
+    Segment2D<T> s2 = std::minmax(dot(dir, segm2.first), dot(dir, segm2.second));
     return isOverlap(s1, s2);
   }
 
   if (std::holds_alternative<Vec3<T>>(intersectionResult))
   {
     auto pt = std::get<Vec3<T>>(intersectionResult);
-    return isIntersectPointSegment(pt, segm1) && isIntersectPointSegment(pt, segm2);
+    return isIntersectPointSegment(pt, segm1, thres) && isIntersectPointSegment(pt, segm2, thres);
   }
 
   return false;
 }
 
 template <std::floating_point T>
-bool isPoint(const Triangle<T> &tr)
+bool isPoint(const Triangle<T> &tr, T thres)
 {
-  return (tr[0] == tr[1]) && (tr[0] == tr[2]);
+  return tr[0].isEqual(tr[1], thres) && tr[0].isEqual(tr[2], thres);
 }
 
 template <std::floating_point T>
@@ -257,29 +340,120 @@ bool isOverlap(Segment2D<T> &segm1, Segment2D<T> &segm2)
 }
 
 template <std::forward_iterator It>
-bool isAllPosNeg(It begin, It end)
+bool isAllPosNeg(It begin, It end, std::iter_value_t<It> thres)
 {
   if (begin == end)
     return true;
 
   bool fst = (*begin > 0);
-  return std::none_of(std::next(begin), end,
-                      [fst](auto &&elt) { return (elt > 0) != fst || isZeroThreshold(elt); });
+  return std::none_of(std::next(begin), end, [fst, thres](auto &&elt) {
+    return (elt > 0) != fst || isZeroThreshold(elt, thres);
+  });
 }
 
 template <std::floating_point T>
-bool isAllPosNeg(T num1, T num2)
+bool isAllPosNeg(T num1, T num2, T thres)
 {
-  auto thres = ThresComp<T>::getThreshold();
   return (num1 > thres && num2 > thres) || (num1 < -thres && num2 < -thres);
 }
 
 template <std::floating_point T>
-bool isOnOneSide(const Plane<T> &pl, const Triangle<T> &tr)
+bool isOnOneSide(const Plane<T> &pl, const Triangle<T> &tr, T thres)
 {
   std::array<T, 3> sdist{};
   std::transform(tr.begin(), tr.end(), sdist.begin(), std::bind_front(distance<T>, pl));
-  return detail::isAllPosNeg(sdist.begin(), sdist.end());
+  return detail::isAllPosNeg(sdist.begin(), sdist.end(), thres);
+}
+
+/**
+ * @brief Checks if all vertices of tr lie farther than threshold on one side of base's plane pl
+ * @details
+ * Distances are compared with threshold as in isOnOneSide(pl, tr, thres). Sign of a distance
+ * which rounding may flip is taken from exact orient3d, so the sides do not depend on T.
+ *
+ * @param[in] normErr error bound of pl's normal, see normalError
+ */
+template <std::floating_point T>
+bool isOnOneSide(const Triangle<T> &base, const Plane<T> &pl, T normErr, const Triangle<T> &tr,
+                 T thres)
+{
+  auto trMagnitude = magnitude(tr);
+  auto band = kDistErrFactor<T> * (trMagnitude + std::abs(pl.dist())) +
+              normErr * (trMagnitude + magnitude(base));
+
+  int side = 0;
+  for (const auto &pt : tr)
+  {
+    auto dist = distance(pl, pt);
+    if (!(std::abs(dist) > thres))
+      return false;
+
+    auto ptSide = std::abs(dist) > band ? sign(dist) : orient3d(base[0], base[1], base[2], pt);
+    if (0 == ptSide || (side != 0 && ptSide != side))
+      return false;
+
+    side = ptSide;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Max of |x| + |y| + |z| over vertices of tr, bounds terms of distance to unit normal plane
+ */
+template <std::floating_point T>
+T magnitude(const Triangle<T> &tr)
+{
+  T res{};
+  for (const auto &pt : tr)
+    res = std::max(res, std::abs(pt.x) + std::abs(pt.y) + std::abs(pt.z));
+
+  return res;
+}
+
+/**
+ * @brief Bound of distance between unit normal of tr computed in T and the exact one
+ * @details
+ * Cross product of nearly parallel edges cancels, so the bound grows for slivers. Distance of
+ * point p to the computed plane differs from the exact one by at most this times
+ * (magnitude of p + magnitude(tr)), rounding of the distance itself aside.
+ */
+template <std::floating_point T>
+T normalError(const Triangle<T> &tr)
+{
+  auto e1 = tr[1] - tr[0];
+  auto e2 = tr[2] - tr[0];
+  auto norm1 = [](const Vec3<T> &vec) {
+    return std::abs(vec.x) + std::abs(vec.y) + std::abs(vec.z);
+  };
+
+  return kNormErrFactor<T> * norm1(e1) * norm1(e2) / cross(e1, e2).length();
+}
+
+/**
+ * @brief Checks if a vertex of tr may be within threshold of pl
+ * @details Band is threshold plus rounding error of signed distance computed in T
+ */
+template <std::floating_point T>
+bool isBorderline(const Plane<T> &pl, const Triangle<T> &tr, T thres)
+{
+  auto band = thres + kDistErrFactor<T> * (magnitude(tr) + std::abs(pl.dist()));
+
+  return std::any_of(tr.begin(), tr.end(),
+                     [&pl, band](const auto &pt) { return std::abs(distance(pl, pt)) <= band; });
+}
+
+/**
+ * @brief Convert triangle's coordinates to U
+ */
+template <std::floating_point U, std::floating_point T>
+Triangle<U> toPrecision(const Triangle<T> &tr)
+{
+  auto conv = [](const Vec3<T> &pt) {
+    return Vec3<U>{static_cast<U>(pt.x), static_cast<U>(pt.y), static_cast<U>(pt.z)};
+  };
+
+  return {conv(tr[0]), conv(tr[1]), conv(tr[2])};
 }
 
 template <std::floating_point T>
@@ -359,27 +533,27 @@ Segment3D<T> getSegment(const Triangle<T> &tr)
 }
 
 template <std::bidirectional_iterator It>
-std::size_t roguePos(It beg, It end)
+std::size_t roguePos(It beg, It end, std::iter_value_t<It> thres)
 {
-  using T = typename std::iterator_traits<It>::value_type;
-
-  auto isDiffSides = [thres = ThresComp<T>::getThreshold()](auto lhs, auto rhs) {
+  auto isDiffSides = [thres](auto lhs, auto rhs) {
     return (lhs > thres && rhs < -thres) || (lhs < -thres && rhs > thres);
   };
 
+  /* Of two vertices on different sides the rogue one isn't on the same side with the third */
   for (std::size_t i = 0; i < 3; ++i)
     if (isDiffSides(*(beg + i), *(beg + (i + 1) % 3)))
-      return i;
+      return isAllPosNeg(*(beg + i), *(beg + (i + 2) % 3), thres) ? (i + 1) % 3 : i;
 
   std::array<bool, 3> isOneSide{};
   for (std::size_t i = 0; i < 3; ++i)
-    isOneSide[i] = isAllPosNeg(*(beg + i), *(beg + (i + 1) % 3));
+    isOneSide[i] = isAllPosNeg(*(beg + i), *(beg + (i + 1) % 3), thres);
 
   if (std::none_of(isOneSide.begin(), isOneSide.end(), std::identity{}))
   {
     auto rbeg = std::reverse_iterator(end);
     auto rend = std::reverse_iterator(beg);
-    auto rogueIt = std::find_if_not(rbeg, rend, isZeroThreshold<T>);
+    auto rogueIt =
+      std::find_if_not(rbeg, rend, [thres](auto num) { return isZeroThreshold(num, thres); });
     return (rogueIt == rend) ? 0 : std::distance(rogueIt, rend) - 1;
   }
 
@@ -10,6 +10,8 @@
 #include "primitives/vec2.hh"
 
 #include "detail.hh"
+#include "prepared.hh"
+#include "stats.hh"
 
 namespace geom
 {
@@ -20,11 +22,58 @@ namespace geom
  * @tparam T - floating point type of coordinates
  * @param tr1 first triangle
  * @param tr2 second triangle
+ * @param thres comparison threshold
  * @return true if triangles are intersect
  * @return false if triangles are not intersect
  */
 template <std::floating_point T>
-bool isIntersect(const Triangle<T> &tr1, const Triangle<T> &tr2);
+bool isIntersect(const Triangle<T> &tr1, const Triangle<T> &tr2,
+                 T thres = ThresComp<T>::getThreshold());
+
+/**
+ * @brief Checks intersection of 2 triangles using their prepared data
+ * @details Gives the same result as isIntersect(tr1, tr2, thres), but planes aren't recomputed
+ * and triangles with disjoint bound boxes are rejected at once. Triangles must be prepared
+ * with the same threshold.
+ *
+ * @tparam T - floating point type of coordinates
+ * @param tr1 first triangle
+ * @param prep1 data of the first triangle
+ * @param tr2 second triangle
+ * @param prep2 data of the second triangle
+ * @param thres comparison threshold
+ * @return true if triangles are intersect
+ * @return false if triangles are not intersect
+ */
+template <std::floating_point T>
+bool isIntersect(const Triangle<T> &tr1, const PreparedTriangle<T> &prep1,
+                 const Triangle<T> &tr2, const PreparedTriangle<T> &prep2,
+                 T thres = ThresComp<T>::getThreshold());
+
+/**
+ * @brief Checks intersection of 2 triangles in T, rechecking borderline pairs in double
+ * @details
+ * Pair is borderline if a vertex of one triangle is within tolerance band of the other's plane
+ * or if a triangle is degenerate. Band is thres widened by rounding error of the signed
+ * distance. Borderline pairs are converted to double and tested by isIntersect with
+ * thresDouble, the rest are tested in T with thres. For T at least as precise as double it is
+ * isIntersect(tr1, prep1, tr2, prep2, thres).
+ *
+ * @tparam T - floating point type of coordinates
+ * @param tr1 first triangle
+ * @param prep1 data of the first triangle
+ * @param tr2 second triangle
+ * @param prep2 data of the second triangle
+ * @param thres comparison threshold in T
+ * @param thresDouble comparison threshold of the recheck in double
+ * @return true if triangles are intersect
+ * @return false if triangles are not intersect
+ */
+template <std::floating_point T>
+bool isIntersectMixed(const Triangle<T> &tr1, const PreparedTriangle<T> &prep1,
+                      const Triangle<T> &tr2, const PreparedTriangle<T> &prep2,
+                      T thres = ThresComp<T>::getThreshold(),
+                      double thresDouble = ThresComp<double>::getThreshold());
 
 /**
  * @brief Intersect 2 planes and return result of intersection
@@ -94,10 +143,12 @@ bool isIntersect(const Triangle<T> &tr1, const Triangle<T> &tr2);
  * @tparam T - floating point type of coordinates
  * @param[in] pl1 first plane
  * @param[in] pl2 second plane
+ * @param[in] thres comparison threshold
  * @return std::variant<std::monostate, Line<T>, Plane<T>>
  */
 template <std::floating_point T>
-std::variant<std::monostate, Line<T>, Plane<T>> intersect(const Plane<T> &pl1, const Plane<T> &pl2);
+std::variant<std::monostate, Line<T>, Plane<T>> intersect(const Plane<T> &pl1, const Plane<T> &pl2,
+                                                          T thres = ThresComp<T>::getThreshold());
 
 /**
  * @brief Intersect 2 lines and return result of intersection
@@ -147,45 +198,116 @@ std::variant<std::monostate, Line<T>, Plane<T>> intersect(const Plane<T> &pl1, c
  * @tparam T - floating point type of coordinates
  * @param[in] l1 first line
  * @param[in] l2 second line
+ * @param[in] thres comparison threshold
  * @return std::variant<std::monostate, Vec3<T>, Line<T>>
  */
 template <std::floating_point T>
-std::variant<std::monostate, Vec3<T>, Line<T>> intersect(const Line<T> &l1, const Line<T> &l2);
+std::variant<std::monostate, Vec3<T>, Line<T>> intersect(const Line<T> &l1, const Line<T> &l2,
+                                                         T thres = ThresComp<T>::getThreshold());
 
 template <std::floating_point T>
-bool isIntersect(const Triangle<T> &tr1, const Triangle<T> &tr2)
+bool isIntersect(const Triangle<T> &tr1, const Triangle<T> &tr2, T thres)
 {
-  auto isInv1 = !tr1.isValid();
-  auto isInv2 = !tr2.isValid();
+  auto isInv1 = !tr1.isValid(thres);
+  auto isInv2 = !tr2.isValid(thres);
 
   if (isInv1 && isInv2)
-    return detail::isIntersectBothInvalid(tr1, tr2);
+    return detail::exitWith(NarrowExit::BOTH_DEGENERATE,
+                            detail::isIntersectBothInvalid(tr1, tr2, thres));
 
   if (isInv1)
-    return detail::isIntersectValidInvalid(tr2, tr1);
+    return detail::exitWith(NarrowExit::ONE_DEGENERATE,
+                            detail::isIntersectValidInvalid(tr2, tr1, thres));
 
   if (isInv2)
-    return detail::isIntersectValidInvalid(tr1, tr2);
+    return detail::exitWith(NarrowExit::ONE_DEGENERATE,
+                            detail::isIntersectValidInvalid(tr1, tr2, thres));
 
   auto pl1 = tr1.getPlane();
-  if (detail::isOnOneSide(pl1, tr2))
-    return false;
+  if (detail::isOnOneSide(tr1, pl1, detail::normalError(tr1), tr2, thres))
+    return detail::exitWith(NarrowExit::FIRST_SIDE, false);
 
   auto pl2 = tr2.getPlane();
-  if (pl1 == pl2)
-    return detail::isIntersect2D(tr1, tr2);
+  if (pl1.isEqual(pl2, thres))
+    return detail::exitWith(NarrowExit::COPLANAR, detail::isIntersect2D(tr1, tr2));
 
-  if (pl1.isPar(pl2))
-    return false;
+  if (pl1.isPar(pl2, thres))
+    return detail::exitWith(NarrowExit::PARALLEL, false);
 
-  if (detail::isOnOneSide(pl2, tr1))
-    return false;
+  if (detail::isOnOneSide(tr2, pl2, detail::normalError(tr2), tr1, thres))
+    return detail::exitWith(NarrowExit::SECOND_SIDE, false);
 
-  return detail::isIntersectMollerHaines(tr1, tr2);
+  return detail::exitWith(NarrowExit::MOLLER_HAINES,
+                          detail::isIntersectMollerHaines(tr1, tr2, thres));
+}
+
+template <std::floating_point T>
+bool isIntersect(const Triangle<T> &tr1, const PreparedTriangle<T> &prep1,
+                 const Triangle<T> &tr2, const PreparedTriangle<T> &prep2, T thres)
+{
+  if (!prep1.boundBox.overlaps(prep2.boundBox))
+    return detail::exitWith(NarrowExit::BOX, false);
+
+  auto isInv1 = !prep1.isValid();
+  auto isInv2 = !prep2.isValid();
+
+  if (isInv1 && isInv2)
+    return detail::exitWith(NarrowExit::BOTH_DEGENERATE,
+                            detail::isIntersectBothInvalid(tr1, tr2, thres));
+
+  if (isInv1)
+    return detail::exitWith(NarrowExit::ONE_DEGENERATE,
+                            detail::isIntersectValidInvalid(tr2, prep2.plane, tr1, thres));
+
+  if (isInv2)
+    return detail::exitWith(NarrowExit::ONE_DEGENERATE,
+                            detail::isIntersectValidInvalid(tr1, prep1.plane, tr2, thres));
+
+  const auto &pl1 = prep1.plane;
+  if (detail::isOnOneSide(tr1, pl1, prep1.normErr, tr2, thres))
+    return detail::exitWith(NarrowExit::FIRST_SIDE, false);
+
+  const auto &pl2 = prep2.plane;
+  if (pl1.isEqual(pl2, thres))
+    return detail::exitWith(NarrowExit::COPLANAR, detail::isIntersect2D(pl1, tr1, tr2));
+
+  if (pl1.isPar(pl2, thres))
+    return detail::exitWith(NarrowExit::PARALLEL, false);
+
+  if (detail::isOnOneSide(tr2, pl2, prep2.normErr, tr1, thres))
+    return detail::exitWith(NarrowExit::SECOND_SIDE, false);
+
+  return detail::exitWith(NarrowExit::MOLLER_HAINES,
+                          detail::isIntersectMollerHaines(tr1, pl1, tr2, pl2, thres));
+}
+
+template <std::floating_point T>
+bool isIntersectMixed(const Triangle<T> &tr1, const PreparedTriangle<T> &prep1,
+                      const Triangle<T> &tr2, const PreparedTriangle<T> &prep2, T thres,
+                      double thresDouble)
+{
+  if constexpr (sizeof(T) >= sizeof(double))
+    return isIntersect(tr1, prep1, tr2, prep2, thres);
+  else
+  {
+    if (!prep1.boundBox.overlaps(prep2.boundBox))
+      return detail::exitWith(NarrowExit::BOX, false);
+
+    if (!prep1.isValid() || !prep2.isValid() || detail::isBorderline(prep1.plane, tr2, thres) ||
+        detail::isBorderline(prep2.plane, tr1, thres))
+    {
+      detail::countRecheck();
+      return isIntersect(detail::toPrecision<double>(tr1), detail::toPrecision<double>(tr2),
+                         thresDouble);
+    }
+
+    return isIntersect(tr1, prep1, tr2, prep2, thres);
+  }
 }
 
 template <std::floating_point T>
-std::variant<std::monostate, Line<T>, Plane<T>> intersect(const Plane<T> &pl1, const Plane<T> &pl2)
+std::variant<std::monostate, Line<T>, Plane<T>> intersect(const Plane<T> &pl1, const Plane<T> &pl2,
+                                                          T thres)
 {
   const auto &n1 = pl1.norm();
   const auto &n2 = pl2.norm();
@@ -193,9 +315,9 @@ std::variant<std::monostate, Line<T>, Plane<T>> intersect(const Plane<T> &pl1, c
   auto dir = cross(n1, n2);
 
   /* if planes are parallel */
-  if (Vec3<T>{0} == dir)
+  if (dir.isEqual(Vec3<T>{0}, thres))
   {
-    if (pl1 == pl2)
+    if (pl1.isEqual(pl2, thres))
       return pl1;
 
     return std::monostate{};
@@ -212,17 +334,18 @@ std::variant<std::monostate, Line<T>, Plane<T>> intersect(const Plane<T> &pl1, c
 }
 
 template <std::floating_point T>
-std::variant<std::monostate, Vec3<T>, Line<T>> intersect(const Line<T> &l1, const Line<T> &l2)
+std::variant<std::monostate, Vec3<T>, Line<T>> intersect(const Line<T> &l1, const Line<T> &l2,
+                                                         T thres)
 {
-  if (l1.isPar(l2))
+  if (l1.isPar(l2, thres))
   {
-    if (l1.isEqual(l2))
+    if (l1.isEqual(l2, thres))
       return l1;
 
     return std::monostate{};
   }
 
-  if (l1.isSkew(l2))
+  if (l1.isSkew(l2, thres))
     return std::monostate{};
 
   auto dir1xdir2 = cross(l1.dir(), l2.dir());
@@ -0,0 +1,646 @@
+#ifndef __INCLUDE_INTERSECTION_PREDICATES_HH__
+#define __INCLUDE_INTERSECTION_PREDICATES_HH__
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <utility>
+
+#include "primitives/vec2.hh"
+#include "primitives/vec3.hh"
+
+/**
+ * @brief predicates.hh
+ * Adaptive orientation predicates (J. R. Shewchuk, "Adaptive Precision Floating-Point Arithmetic
+ * and Fast Robust Geometric Predicates", 1997): a floating point evaluation with certified error
+ * bound, then exact determinant of rounded differences, then its first order correction and only
+ * then the exact determinant of the points. Every stage has its own error bound, so the later
+ * ones run only for nearly degenerate input. Expansions are fixed size arrays on stack, nothing
+ * is allocated. Results are exact unless intermediate values overflow or underflow.
+ */
+
+namespace geom
+{
+
+/**
+ * @brief Sign of orientation of 2D points
+ *
+ * @tparam T - floating point type of coordinates
+ * @param[in] a 1st point
+ * @param[in] b 2nd point
+ * @param[in] c 3rd point
+ * @return 1 if a, b, c go counterclockwise, -1 if clockwise, 0 if they are collinear
+ */
+template <std::floating_point T>
+int orient2d(const Vec2<T> &a, const Vec2<T> &b, const Vec2<T> &c);
+
+/**
+ * @brief Sign of orientation of 3D points
+ * @details Sign of \f$ (b - a) \times (c - a) \cdot (d - a) \f$
+ *
+ * @tparam T - floating point type of coordinates
+ * @param[in] a 1st point
+ * @param[in] b 2nd point
+ * @param[in] c 3rd point
+ * @param[in] d point to classify
+ * @return 1 if d lies on the side of plane abc where its normal (b - a) x (c - a) points,
+ * -1 if on the other side, 0 if points are coplanar
+ */
+template <std::floating_point T>
+int orient3d(const Vec3<T> &a, const Vec3<T> &b, const Vec3<T> &c, const Vec3<T> &d);
+
+} // namespace geom
+
+namespace geom::detail
+{
+
+/**
+ * @class Expansion
+ * @brief Exact sum of at most N floating point numbers with no overlapping bits, ascending by
+ * magnitude
+ *
+ * @tparam T - floating point type of components
+ * @tparam N - capacity
+ */
+template <std::floating_point T, std::size_t N>
+class Expansion final
+{
+private:
+  std::array<T, N> comp_{};
+  std::size_t size_{};
+
+public:
+  Expansion() = default;
+
+  std::size_t size() const
+  {
+    return size_;
+  }
+
+  T operator[](std::size_t i) const
+  {
+    return comp_[i];
+  }
+
+  void push_back(T comp)
+  {
+    assert(size_ < N);
+    comp_[size_++] = comp;
+  }
+
+  void clear()
+  {
+    size_ = 0;
+  }
+};
+
+/**
+ * @brief Relative error bounds of the evaluation stages (J. R. Shewchuk, 1997)
+ */
+template <std::floating_point T>
+struct OrientErrBound final
+{
+  static constexpr T eps = std::numeric_limits<T>::epsilon() / 2;
+  static constexpr T result = (3 + 8 * eps) * eps;
+  static constexpr T ccwA = (3 + 16 * eps) * eps;
+  static constexpr T ccwB = (2 + 12 * eps) * eps;
+  static constexpr T ccwC = (9 + 64 * eps) * eps * eps;
+  static constexpr T o3dA = (7 + 56 * eps) * eps;
+  static constexpr T o3dB = (3 + 28 * eps) * eps;
+  static constexpr T o3dC = (26 + 288 * eps) * eps * eps;
+};
+
+/**
+ * @brief Capacity of the full orient3d expansion
+ */
+constexpr std::size_t kOrient3dTerms = 192;
+
+template <std::floating_point T>
+int sign(T num)
+{
+  return (num > 0) - (num < 0);
+}
+
+template <std::floating_point T>
+std::pair<T, T> fastTwoSum(T a, T b);
+
+template <std::floating_point T>
+std::pair<T, T> twoSum(T a, T b);
+
+template <std::floating_point T>
+T twoDiffTail(T a, T b, T diff);
+
+template <std::floating_point T>
+std::pair<T, T> twoProduct(T a, T b);
+
+template <std::floating_point T>
+Expansion<T, 4> twoTwoDiff(T a1, T a0, T b1, T b0);
+
+template <std::floating_point T>
+Expansion<T, 4> twoOneProduct(T a1, T a0, T b);
+
+template <std::floating_point T, std::size_t N, std::size_t M, std::size_t K>
+void sumExpansions(const Expansion<T, N> &e, const Expansion<T, M> &f, Expansion<T, K> &h);
+
+template <std::floating_point T, std::size_t N, std::size_t M>
+Expansion<T, N + M> sumExpansions(const Expansion<T, N> &e, const Expansion<T, M> &f);
+
+template <std::floating_point T, std::size_t N>
+Expansion<T, 2 * N> scaleExpansion(const Expansion<T, N> &e, T b);
+
+template <std::floating_point T, std::size_t N>
+T estimate(const Expansion<T, N> &e);
+
+template <std::floating_point T, std::size_t N>
+int signExpansion(const Expansion<T, N> &e);
+
+template <std::floating_point T>
+T orient2dAdapt(const Vec2<T> &a, const Vec2<T> &b, const Vec2<T> &c, T detSum);
+
+template <std::floating_point T>
+T orient3dAdapt(const Vec3<T> &a, const Vec3<T> &b, const Vec3<T> &c, const Vec3<T> &d);
+
+template <std::floating_point T>
+T orient3dExact(const Vec3<T> &a, const Vec3<T> &b, const Vec3<T> &c, const Vec3<T> &d,
+                const Expansion<T, 4> &bc, const Expansion<T, 4> &ca, const Expansion<T, 4> &ab,
+                Expansion<T, kOrient3dTerms> &fin);
+
+} // namespace geom::detail
+
+namespace geom
+{
+
+template <std::floating_point T>
+int orient2d(const Vec2<T> &a, const Vec2<T> &b, const Vec2<T> &c)
+{
+  auto detLeft = (a.x - c.x) * (b.y - c.y);
+  auto detRight = (a.y - c.y) * (b.x - c.x);
+  auto det = detLeft - detRight;
+
+  /* Products of different signs or a zero one give the exact sign at once */
+  T detSum{};
+  if (detLeft > 0)
+  {
+    if (!(detRight > 0))
+      return detail::sign(det);
+    detSum = detLeft + detRight;
+  }
+  else if (detLeft < 0)
+  {
+    if (!(detRight < 0))
+      return detail::sign(det);
+    detSum = -detLeft - detRight;
+  }
+  else
+    return detail::sign(det);
+
+  auto errBound = detail::OrientErrBound<T>::ccwA * detSum;
+  if (det >= errBound || -det >= errBound)
+    return detail::sign(det);
+
+  return detail::sign(detail::orient2dAdapt(a, b, c, detSum));
+}
+
+template <std::floating_point T>
+int orient3d(const Vec3<T> &a, const Vec3<T> &b, const Vec3<T> &c, const Vec3<T> &d)
+{
+  auto u = b - a;
+  auto v = c - a;
+  auto w = d - a;
+
+  auto vywz = v.y * w.z;
+  auto vzwy = v.z * w.y;
+  auto vzwx = v.z * w.x;
+  auto vxwz = v.x * w.z;
+  auto vxwy = v.x * w.y;
+  auto vywx = v.y * w.x;
+
+  auto det = u.x * (vywz - vzwy) + u.y * (vzwx - vxwz) + u.z * (vxwy - vywx);
+
+  auto permanent = std::abs(u.x) * (std::abs(vywz) + std::abs(vzwy)) +
+                   std::abs(u.y) * (std::abs(vzwx) + std::abs(vxwz)) +
+                   std::abs(u.z) * (std::abs(vxwy) + std::abs(vywx));
+
+  auto errBound = detail::OrientErrBound<T>::o3dA * permanent;
+  if (std::abs(det) > errBound)
+    return detail::sign(det);
+
+  /* All products are zero, e.g. for points in a coordinate plane */
+  if (!(permanent > 0))
+    return 0;
+
+  /* Shewchuk's determinant of a - d, b - d, c - d has the opposite sign */
+  return -detail::sign(detail::orient3dAdapt(a, b, c, d));
+}
+
+} // namespace geom
+
+namespace geom::detail
+{
+
+/**
+ * @brief Exact sum a + b as rounded sum and its error, |a| >= |b| is required
+ */
+template <std::floating_point T>
+std::pair<T, T> fastTwoSum(T a, T b)
+{
+  auto x = a + b;
+  auto bVirt = x - a;
+  return {x, b - bVirt};
+}
+
+/**
+ * @brief Exact sum a + b as rounded sum and its error
+ */
+template <std::floating_point T>
+std::pair<T, T> twoSum(T a, T b)
+{
+  auto x = a + b;
+  auto bVirt = x - a;
+  auto aVirt = x - bVirt;
+  return {x, (a - aVirt) + (b - bVirt)};
+}
+
+/**
+ * @brief Error of diff = a - b computed in floating point
+ */
+template <std::floating_point T>
+T twoDiffTail(T a, T b, T diff)
+{
+  auto bVirt = a - diff;
+  auto aVirt = diff + bVirt;
+  return (a - aVirt) + (bVirt - b);
+}
+
+/**
+ * @brief Exact product a * b as rounded product and its error, which fma gives exactly
+ */
+template <std::floating_point T>
+std::pair<T, T> twoProduct(T a, T b)
+{
+  auto x = a * b;
+  return {x, std::fma(a, b, -x)};
+}
+
+/**
+ * @brief Exact (a1 + a0) - (b1 + b0) as expansion of 4 components, zeros are kept
+ */
+template <std::floating_point T>
+Expansion<T, 4> twoTwoDiff(T a1, T a0, T b1, T b0)
+{
+  /* Two_One_Diff(a1, a0, b0) */
+  auto i = a0 - b0;
+  auto x0 = twoDiffTail(a0, b0, i);
+  auto [j, k] = twoSum(a1, i);
+
+  /* Two_One_Diff(j, k, b1) */
+  auto l = k - b1;
+  auto x1 = twoDiffTail(k, b1, l);
+  auto [x3, x2] = twoSum(j, l);
+
+  Expansion<T, 4> res{};
+  for (auto comp : {x0, x1, x2, x3})
+    res.push_back(comp);
+
+  return res;
+}
+
+/**
+ * @brief Exact (a1 + a0) * b as expansion of 4 components, zeros are kept
+ */
+template <std::floating_point T>
+Expansion<T, 4> twoOneProduct(T a1, T a0, T b)
+{
+  auto [i, x0] = twoProduct(a0, b);
+  auto [j, l] = twoProduct(a1, b);
+  auto [k, x1] = twoSum(i, l);
+  auto [x3, x2] = fastTwoSum(j, k);
+
+  Expansion<T, 4> res{};
+  for (auto comp : {x0, x1, x2, x3})
+    res.push_back(comp);
+
+  return res;
+}
+
+/**
+ * @brief Exact sum of expansions written to h, zero components are eliminated
+ * @details Shewchuk's FAST-EXPANSION-SUM, h must not be e or f
+ */
+template <std::floating_point T, std::size_t N, std::size_t M, std::size_t K>
+void sumExpansions(const Expansion<T, N> &e, const Expansion<T, M> &f, Expansion<T, K> &h)
+{
+  h.clear();
+
+  std::size_t ei = 0;
+  std::size_t fi = 0;
+  auto takeSmaller = [&] {
+    auto enow = e[ei];
+    auto fnow = f[fi];
+    if ((fnow > enow) == (fnow > -enow))
+    {
+      ++ei;
+      return enow;
+    }
+    ++fi;
+    return fnow;
+  };
+
+  auto q = (ei < e.size() && fi < f.size()) ? takeSmaller() : (ei < e.size() ? e[ei++] : f[fi++]);
+  auto push = [&h, &q](std::pair<T, T> sum) {
+    q = sum.first;
+    if (sign(sum.second) != 0)
+      h.push_back(sum.second);
+  };
+
+  if (ei < e.size() && fi < f.size())
+    push(fastTwoSum(takeSmaller(), q));
+
+  while (ei < e.size() && fi < f.size())
+    push(twoSum(q, takeSmaller()));
+
+  while (ei < e.size())
+    push(twoSum(q, e[ei++]));
+
+  while (fi < f.size())
+    push(twoSum(q, f[fi++]));
+
+  if (sign(q) != 0 || 0 == h.size())
+    h.push_back(q);
+}
+
+template <std::floating_point T, std::size_t N, std::size_t M>
+Expansion<T, N + M> sumExpansions(const Expansion<T, N> &e, const Expansion<T, M> &f)
+{
+  Expansion<T, N + M> res{};
+  sumExpansions(e, f, res);
+  return res;
+}
+
+/**
+ * @brief Exact product of expansion and number, zero components are eliminated
+ */
+template <std::floating_point T, std::size_t N>
+Expansion<T, 2 * N> scaleExpansion(const Expansion<T, N> &e, T b)
+{
+  Expansion<T, 2 * N> res{};
+  auto [q, low] = twoProduct(e[0], b);
+  if (sign(low) != 0)
+    res.push_back(low);
+
+  for (std::size_t i = 1; i < e.size(); ++i)
+  {
+    auto [prod1, prod0] = twoProduct(e[i], b);
+    auto [sum, err1] = twoSum(q, prod0);
+    if (sign(err1) != 0)
+      res.push_back(err1);
+
+    auto [next, err2] = fastTwoSum(prod1, sum);
+    if (sign(err2) != 0)
+      res.push_back(err2);
+    q = next;
+  }
+
+  if (sign(q) != 0 || 0 == res.size())
+    res.push_back(q);
+
+  return res;
+}
+
+/**
+ * @brief Approximate value of expansion
+ */
+template <std::floating_point T, std::size_t N>
+T estimate(const Expansion<T, N> &e)
+{
+  T res{};
+  for (std::size_t i = 0; i < e.size(); ++i)
+    res += e[i];
+
+  return res;
+}
+
+/**
+ * @brief Sign of expansion is the sign of its largest nonzero component
+ */
+template <std::floating_point T, std::size_t N>
+int signExpansion(const Expansion<T, N> &e)
+{
+  for (auto i = e.size(); i > 0; --i)
+    if (auto res = sign(e[i - 1]); res != 0)
+      return res;
+
+  return 0;
+}
+
+/**
+ * @brief Stages B to D of orient2d, returns value of the sign of the determinant
+ */
+template <std::floating_point T>
+T orient2dAdapt(const Vec2<T> &a, const Vec2<T> &b, const Vec2<T> &c, T detSum)
+{
+  using Bound = OrientErrBound<T>;
+
+  auto acx = a.x - c.x;
+  auto bcx = b.x - c.x;
+  auto acy = a.y - c.y;
+  auto bcy = b.y - c.y;
+
+  auto [detLeft, detLeftTail] = twoProduct(acx, bcy);
+  auto [detRight, detRightTail] = twoProduct(acy, bcx);
+  auto bExp = twoTwoDiff(detLeft, detLeftTail, detRight, detRightTail);
+
+  auto det = estimate(bExp);
+  auto errBound = Bound::ccwB * detSum;
+  if (det >= errBound || -det >= errBound)
+    return det;
+
+  auto acxTail = twoDiffTail(a.x, c.x, acx);
+  auto bcxTail = twoDiffTail(b.x, c.x, bcx);
+  auto acyTail = twoDiffTail(a.y, c.y, acy);
+  auto bcyTail = twoDiffTail(b.y, c.y, bcy);
+
+  if (0 == sign(acxTail) && 0 == sign(acyTail) && 0 == sign(bcxTail) && 0 == sign(bcyTail))
+    return det;
+
+  errBound = Bound::ccwC * detSum + Bound::result * std::abs(det);
+  det += (acx * bcyTail + bcy * acxTail) - (acy * bcxTail + bcx * acyTail);
+  if (det >= errBound || -det >= errBound)
+    return det;
+
+  auto crossTail = [](T lhs1, T lhs0, T rhs1, T rhs0) {
+    auto [s1, s0] = twoProduct(lhs1, lhs0);
+    auto [t1, t0] = twoProduct(rhs1, rhs0);
+    return twoTwoDiff(s1, s0, t1, t0);
+  };
+
+  auto c1 = sumExpansions(bExp, crossTail(acxTail, bcy, acyTail, bcx));
+  auto c2 = sumExpansions(c1, crossTail(acx, bcyTail, acy, bcxTail));
+  auto dExp = sumExpansions(c2, crossTail(acxTail, bcyTail, acyTail, bcxTail));
+
+  return dExp[dExp.size() - 1];
+}
+
+/**
+ * @brief Stages B and C of orient3d, returns value of the sign of Shewchuk's determinant
+ * @details Stages are bounded relative to permanent of differences with d, unlike stage A
+ */
+template <std::floating_point T>
+T orient3dAdapt(const Vec3<T> &a, const Vec3<T> &b, const Vec3<T> &c, const Vec3<T> &d)
+{
+  using Bound = OrientErrBound<T>;
+
+  auto ad = a - d;
+  auto bd = b - d;
+  auto cd = c - d;
+
+  auto permanent = (std::abs(bd.x * cd.y) + std::abs(cd.x * bd.y)) * std::abs(ad.z) +
+                   (std::abs(cd.x * ad.y) + std::abs(ad.x * cd.y)) * std::abs(bd.z) +
+                   (std::abs(ad.x * bd.y) + std::abs(bd.x * ad.y)) * std::abs(cd.z);
+
+  auto crossZ = [](T lhs1, T lhs0, T rhs1, T rhs0) {
+    auto [s1, s0] = twoProduct(lhs1, lhs0);
+    auto [t1, t0] = twoProduct(rhs1, rhs0);
+    return twoTwoDiff(s1, s0, t1, t0);
+  };
+
+  auto bc = crossZ(bd.x, cd.y, cd.x, bd.y);
+  auto ca = crossZ(cd.x, ad.y, ad.x, cd.y);
+  auto ab = crossZ(ad.x, bd.y, bd.x, ad.y);
+
+  Expansion<T, kOrient3dTerms> fin{};
+  sumExpansions(sumExpansions(scaleExpansion(bc, ad.z), scaleExpansion(ca, bd.z)),
+                scaleExpansion(ab, cd.z), fin);
+
+  auto det = estimate(fin);
+  auto errBound = Bound::o3dB * permanent;
+  if (det >= errBound || -det >= errBound)
+    return det;
+
+  auto adxTail = twoDiffTail(a.x, d.x, ad.x);
+  auto bdxTail = twoDiffTail(b.x, d.x, bd.x);
+  auto cdxTail = twoDiffTail(c.x, d.x, cd.x);
+  auto adyTail = twoDiffTail(a.y, d.y, ad.y);
+  auto bdyTail = twoDiffTail(b.y, d.y, bd.y);
+  auto cdyTail = twoDiffTail(c.y, d.y, cd.y);
+  auto adzTail = twoDiffTail(a.z, d.z, ad.z);
+  auto bdzTail = twoDiffTail(b.z, d.z, bd.z);
+  auto cdzTail = twoDiffTail(c.z, d.z, cd.z);
+
+  if (0 == sign(adxTail) && 0 == sign(bdxTail) && 0 == sign(cdxTail) && 0 == sign(adyTail) &&
+      0 == sign(bdyTail) && 0 == sign(cdyTail) && 0 == sign(adzTail) && 0 == sign(bdzTail) &&
+      0 == sign(cdzTail))
+    return det;
+
+  errBound = Bound::o3dC * permanent + Bound::result * std::abs(det);
+  det += (ad.z * ((bd.x * cdyTail + cd.y * bdxTail) - (bd.y * cdxTail + cd.x * bdyTail)) +
+          adzTail * (bd.x * cd.y - bd.y * cd.x)) +
+         (bd.z * ((cd.x * adyTail + ad.y * cdxTail) - (cd.y * adxTail + ad.x * cdyTail)) +
+          bdzTail * (cd.x * ad.y - cd.y * ad.x)) +
+         (cd.z * ((ad.x * bdyTail + bd.y * adxTail) - (ad.y * bdxTail + bd.x * adyTail)) +
+          cdzTail * (ad.x * bd.y - ad.y * bd.x));
+  if (det >= errBound || -det >= errBound)
+    return det;
+
+  return orient3dExact(a, b, c, d, bc, ca, ab, fin);
+}
+
+/**
+ * @brief Stage D of orient3d: adds terms of the tails of differences to fin, the exact
+ * determinant of rounded differences
+ * @details fin is reused as one of two ping-pong buffers, so only one more is on stack
+ */
+template <std::floating_point T>
+T orient3dExact(const Vec3<T> &a, const Vec3<T> &b, const Vec3<T> &c, const Vec3<T> &d,
+                const Expansion<T, 4> &bc, const Expansion<T, 4> &ca, const Expansion<T, 4> &ab,
+                Expansion<T, kOrient3dTerms> &fin)
+{
+  auto ad = a - d;
+  auto bd = b - d;
+  auto cd = c - d;
+
+  auto adxTail = twoDiffTail(a.x, d.x, ad.x);
+  auto bdxTail = twoDiffTail(b.x, d.x, bd.x);
+  auto cdxTail = twoDiffTail(c.x, d.x, cd.x);
+  auto adyTail = twoDiffTail(a.y, d.y, ad.y);
+  auto bdyTail = twoDiffTail(b.y, d.y, bd.y);
+  auto cdyTail = twoDiffTail(c.y, d.y, cd.y);
+  auto adzTail = twoDiffTail(a.z, d.z, ad.z);
+  auto bdzTail = twoDiffTail(b.z, d.z, bd.z);
+  auto cdzTail = twoDiffTail(c.z, d.z, cd.z);
+
+  Expansion<T, kOrient3dTerms> other{};
+  auto *cur = &fin;
+  auto *next = &other;
+  auto add = [&cur, &next](const auto &e) {
+    sumExpansions(*cur, e, *next);
+    std::swap(cur, next);
+  };
+
+  /* Exact xTail * rhsY - yTail * rhsX, i.e. z of cross product of tails with (rhsX, rhsY) */
+  auto tailCross = [](T xTail, T yTail, T rhsX, T rhsY) {
+    Expansion<T, 4> res{};
+    if (0 == sign(xTail) && 0 == sign(yTail))
+    {
+      res.push_back(T{});
+      return res;
+    }
+
+    auto [s1, s0] = twoProduct(xTail, rhsY);
+    auto [t1, t0] = twoProduct(yTail, rhsX);
+    return twoTwoDiff(s1, s0, t1, t0);
+  };
+
+  /* bct = bt_c + ct_b in Shewchuk's terms, negated cross products take negated tails */
+  auto bct = sumExpansions(tailCross(bdxTail, bdyTail, cd.x, cd.y),
+                           tailCross(-cdxTail, -cdyTail, bd.x, bd.y));
+  auto cat = sumExpansions(tailCross(cdxTail, cdyTail, ad.x, ad.y),
+                           tailCross(-adxTail, -adyTail, cd.x, cd.y));
+  auto abt = sumExpansions(tailCross(adxTail, adyTail, bd.x, bd.y),
+                           tailCross(-bdxTail, -bdyTail, ad.x, ad.y));
+
+  add(scaleExpansion(bct, ad.z));
+  add(scaleExpansion(cat, bd.z));
+  add(scaleExpansion(abt, cd.z));
+
+  if (sign(adzTail) != 0)
+    add(scaleExpansion(bc, adzTail));
+  if (sign(bdzTail) != 0)
+    add(scaleExpansion(ca, bdzTail));
+  if (sign(cdzTail) != 0)
+    add(scaleExpansion(ab, cdzTail));
+
+  /* Products of two tails: xTail * yTail * z and xTail * yTail * zTail */
+  auto addTailProduct = [&add](T xTail, T yTail, T z, T zTail) {
+    if (0 == sign(xTail) || 0 == sign(yTail))
+      return;
+
+    auto [p1, p0] = twoProduct(xTail, yTail);
+    add(twoOneProduct(p1, p0, z));
+    if (sign(zTail) != 0)
+      add(twoOneProduct(p1, p0, zTail));
+  };
+
+  addTailProduct(adxTail, bdyTail, cd.z, cdzTail);
+  addTailProduct(-adxTail, cdyTail, bd.z, bdzTail);
+  addTailProduct(bdxTail, cdyTail, ad.z, adzTail);
+  addTailProduct(-bdxTail, adyTail, cd.z, cdzTail);
+  addTailProduct(cdxTail, adyTail, bd.z, bdzTail);
+  addTailProduct(-cdxTail, bdyTail, ad.z, adzTail);
+
+  if (sign(adzTail) != 0)
+    add(scaleExpansion(bct, adzTail));
+  if (sign(bdzTail) != 0)
+    add(scaleExpansion(cat, bdzTail));
+  if (sign(cdzTail) != 0)
+    add(scaleExpansion(abt, cdzTail));
+
+  return (*cur)[cur->size() - 1];
+}
+
+} // namespace geom::detail
+
+#endif // __INCLUDE_INTERSECTION_PREDICATES_HH__
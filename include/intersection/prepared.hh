@@ -0,0 +1,79 @@
+#ifndef __INCLUDE_INTERSECTION_PREPARED_HH__
+#define __INCLUDE_INTERSECTION_PREPARED_HH__
+
+#include <concepts>
+
+#include "primitives/primitives.hh"
+
+#include "detail.hh"
+
+namespace geom
+{
+
+/**
+ * @brief Degeneracy class of a triangle
+ */
+enum class TriangleKind
+{
+  TRIANGLE, // valid triangle
+  SEGMENT,  // all vertices lie on one line
+  POINT     // all vertices coincide
+};
+
+/**
+ * @brief Data of a triangle which narrow phase needs for every test
+ * @details
+ * Computing triangle's plane takes a square root and its validity check takes a cross product,
+ * so a triangle tested against many others is cheaper to prepare once.
+ * Validity and bound box are computed with threshold given at preparation, narrow phase must
+ * be run with the same one.
+ *
+ * @tparam T - floating point type of coordinates
+ */
+template <std::floating_point T>
+struct PreparedTriangle final
+{
+  Plane<T> plane{Plane<T>::getNormalDist({0, 0, 1}, 0)}; // meaningful for valid triangles only
+  BoundBox<T> boundBox{};
+  T normErr{}; // error bound of plane's unit normal, see detail::normalError
+  TriangleKind kind{TriangleKind::POINT};
+
+  PreparedTriangle() = default;
+  explicit PreparedTriangle(const Triangle<T> &tr, T thres = ThresComp<T>::getThreshold());
+  PreparedTriangle(const Triangle<T> &tr, const BoundBox<T> &bb,
+                   T thres = ThresComp<T>::getThreshold());
+
+  bool isValid() const;
+};
+
+template <std::floating_point T>
+PreparedTriangle<T>::PreparedTriangle(const Triangle<T> &tr, T thres)
+  : PreparedTriangle(tr, tr.boundBox(thres), thres)
+{}
+
+/**
+ * @brief Prepare tr whose bound box is already known, bb must be equal to tr.boundBox(thres)
+ */
+template <std::floating_point T>
+PreparedTriangle<T>::PreparedTriangle(const Triangle<T> &tr, const BoundBox<T> &bb, T thres)
+  : boundBox(bb)
+{
+  if (tr.isValid(thres))
+  {
+    plane = tr.getPlane();
+    normErr = detail::normalError(tr);
+    kind = TriangleKind::TRIANGLE;
+  }
+  else if (!tr[0].isEqual(tr[1], thres) || !tr[0].isEqual(tr[2], thres))
+    kind = TriangleKind::SEGMENT;
+}
+
+template <std::floating_point T>
+bool PreparedTriangle<T>::isValid() const
+{
+  return TriangleKind::TRIANGLE == kind;
+}
+
+} // namespace geom
+
+#endif // __INCLUDE_INTERSECTION_PREPARED_HH__
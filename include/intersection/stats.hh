@@ -0,0 +1,302 @@
+#ifndef __INCLUDE_INTERSECTION_STATS_HH__
+#define __INCLUDE_INTERSECTION_STATS_HH__
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <mutex>
+#include <numeric>
+#include <ostream>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+/**
+ * @brief Set to 1 to count exit paths of narrow phase, counting code is compiled out otherwise
+ * @details
+ * Counting hooks live in an inline namespace named after the setting, so translation units
+ * built with and without it never share definitions of the hooks.
+ */
+#ifndef GEOM_NARROW_STATS
+#define GEOM_NARROW_STATS 0
+#endif
+
+#if GEOM_NARROW_STATS
+#define GEOM_NARROW_STATS_NS narrow_stats_on
+#else
+#define GEOM_NARROW_STATS_NS narrow_stats_off
+#endif
+
+namespace geom
+{
+
+constexpr bool kNarrowStatsEnabled = GEOM_NARROW_STATS != 0;
+
+/**
+ * @brief Paths by which narrow phase decides on a pair of triangles
+ */
+enum class NarrowExit : std::size_t
+{
+  BOX,             // bound boxes are disjoint
+  BATCH_SIDE,      // batch filter found one triangle on one side of the other's plane
+  BOTH_DEGENERATE, // both triangles are segments or points
+  ONE_DEGENERATE,  // one triangle is a segment or a point
+  FIRST_SIDE,      // second triangle is on one side of the first one's plane
+  COPLANAR,        // triangles lie in one plane, tested in 2D
+  PARALLEL,        // planes are parallel and distinct
+  SECOND_SIDE,     // first triangle is on one side of the second one's plane
+  MOLLER_HAINES    // full interval overlap test
+};
+
+constexpr std::size_t kNarrowExitCount = 9;
+
+inline std::string_view narrowExitName(NarrowExit exit)
+{
+  switch (exit)
+  {
+  case NarrowExit::BOX:
+    return "box";
+  case NarrowExit::BATCH_SIDE:
+    return "batch side";
+  case NarrowExit::BOTH_DEGENERATE:
+    return "both degenerate";
+  case NarrowExit::ONE_DEGENERATE:
+    return "one degenerate";
+  case NarrowExit::FIRST_SIDE:
+    return "first side";
+  case NarrowExit::COPLANAR:
+    return "coplanar";
+  case NarrowExit::PARALLEL:
+    return "parallel";
+  case NarrowExit::SECOND_SIDE:
+    return "second side";
+  case NarrowExit::MOLLER_HAINES:
+    return "Moller-Haines";
+  default:
+    throw std::invalid_argument("Unknown narrow phase exit");
+  }
+}
+
+/**
+ * @class NarrowStats
+ * @brief Counts of pairs which left narrow phase by every path
+ */
+struct NarrowStats final
+{
+  std::array<std::uint64_t, kNarrowExitCount> exits{};
+  std::uint64_t intersecting{}; // pairs found intersecting
+  std::uint64_t rechecked{};    // borderline pairs rechecked in double by isIntersectMixed
+
+  std::uint64_t count(NarrowExit exit) const;
+  std::uint64_t total() const;
+
+  NarrowStats &operator+=(const NarrowStats &other);
+
+  void dump(std::ostream &ost) const;
+};
+
+/**
+ * @brief Get counts of narrow phase tests made by flushed or finished threads and by the
+ * calling one
+ * @details
+ * Every thread counts into its own counters without synchronization, they are added to the
+ * totals by detail::flushNarrowStats() and when the thread exits. Pool threads of KdTree flush
+ * after every piece of a query, so after a query totals are complete. Always zero unless
+ * GEOM_NARROW_STATS is set.
+ */
+NarrowStats narrowStats();
+
+/**
+ * @brief Zero totals and counters of the calling thread
+ */
+void resetNarrowStats();
+
+namespace detail
+{
+
+/**
+ * @class NarrowCounters
+ * @brief Counters of one thread, added to totals on thread exit
+ */
+class NarrowCounters final
+{
+private:
+  NarrowStats stats_{};
+
+public:
+  NarrowCounters() = default;
+  NarrowCounters(const NarrowCounters &) = delete;
+  NarrowCounters &operator=(const NarrowCounters &) = delete;
+  NarrowCounters(NarrowCounters &&) = delete;
+  NarrowCounters &operator=(NarrowCounters &&) = delete;
+  ~NarrowCounters();
+
+  NarrowStats &stats();
+  void flush();
+
+  static NarrowCounters &local();
+};
+
+struct NarrowTotals final
+{
+  std::mutex mutex{};
+  NarrowStats stats{};
+
+  static NarrowTotals &get();
+};
+
+inline namespace GEOM_NARROW_STATS_NS
+{
+
+bool exitWith(NarrowExit exit, bool result);
+void countExits(NarrowExit exit, std::uint64_t count);
+void countRecheck();
+void flushNarrowStats();
+
+} // namespace GEOM_NARROW_STATS_NS
+} // namespace detail
+
+inline std::uint64_t NarrowStats::count(NarrowExit exit) const
+{
+  return exits[static_cast<std::size_t>(exit)];
+}
+
+/**
+ * @brief Number of pairs tested
+ */
+inline std::uint64_t NarrowStats::total() const
+{
+  return std::accumulate(exits.begin(), exits.end(), std::uint64_t{0});
+}
+
+inline NarrowStats &NarrowStats::operator+=(const NarrowStats &other)
+{
+  for (std::size_t i = 0; i < kNarrowExitCount; ++i)
+    exits[i] += other.exits[i];
+  intersecting += other.intersecting;
+  rechecked += other.rechecked;
+  return *this;
+}
+
+/**
+ * @brief Print count and share of every exit path, one per line
+ */
+inline void NarrowStats::dump(std::ostream &ost) const
+{
+  auto nPairs = total();
+  auto percent = [nPairs](std::uint64_t count) {
+    return 0 == nPairs ? 0.0 : 100.0 * static_cast<double>(count) / static_cast<double>(nPairs);
+  };
+
+  ost << "narrow phase: " << nPairs << " pairs, " << intersecting << " intersecting, "
+      << rechecked << " rechecked in double\n";
+
+  auto flags = ost.flags();
+  for (std::size_t i = 0; i < kNarrowExitCount; ++i)
+    ost << "  " << std::left << std::setw(16) << narrowExitName(static_cast<NarrowExit>(i))
+        << std::right << std::setw(14) << exits[i] << std::fixed << std::setprecision(2)
+        << std::setw(8) << percent(exits[i]) << "%\n";
+  ost.flags(flags);
+}
+
+inline NarrowStats narrowStats()
+{
+  auto &totals = detail::NarrowTotals::get();
+  std::lock_guard lock{totals.mutex};
+  auto res = totals.stats;
+  res += detail::NarrowCounters::local().stats();
+  return res;
+}
+
+inline void resetNarrowStats()
+{
+  auto &totals = detail::NarrowTotals::get();
+  std::lock_guard lock{totals.mutex};
+  totals.stats = NarrowStats{};
+  detail::NarrowCounters::local().stats() = NarrowStats{};
+}
+
+namespace detail
+{
+
+inline NarrowCounters::~NarrowCounters()
+{
+  flush();
+}
+
+inline NarrowStats &NarrowCounters::stats()
+{
+  return stats_;
+}
+
+/**
+ * @brief Move counts of the thread to the totals
+ */
+inline void NarrowCounters::flush()
+{
+  auto &totals = NarrowTotals::get();
+  std::lock_guard lock{totals.mutex};
+  totals.stats += std::exchange(stats_, NarrowStats{});
+}
+
+inline NarrowCounters &NarrowCounters::local()
+{
+  thread_local NarrowCounters counters{};
+  return counters;
+}
+
+inline NarrowTotals &NarrowTotals::get()
+{
+  static NarrowTotals totals{};
+  return totals;
+}
+
+inline namespace GEOM_NARROW_STATS_NS
+{
+
+/**
+ * @brief Count exit of one pair by given path, helper for return statements
+ * @return result
+ */
+inline bool exitWith(NarrowExit exit, bool result)
+{
+  if constexpr (kNarrowStatsEnabled)
+  {
+    auto &stats = NarrowCounters::local().stats();
+    ++stats.exits[static_cast<std::size_t>(exit)];
+    stats.intersecting += result;
+  }
+
+  return result;
+}
+
+/**
+ * @brief Count exit of count non intersecting pairs by given path
+ */
+inline void countExits([[maybe_unused]] NarrowExit exit, [[maybe_unused]] std::uint64_t count)
+{
+  if constexpr (kNarrowStatsEnabled)
+    NarrowCounters::local().stats().exits[static_cast<std::size_t>(exit)] += count;
+}
+
+inline void countRecheck()
+{
+  if constexpr (kNarrowStatsEnabled)
+    ++NarrowCounters::local().stats().rechecked;
+}
+
+/**
+ * @brief Add counts of the calling thread to the totals, for threads which outlive a query
+ */
+inline void flushNarrowStats()
+{
+  if constexpr (kNarrowStatsEnabled)
+    NarrowCounters::local().flush();
+}
+
+} // namespace GEOM_NARROW_STATS_NS
+} // namespace detail
+} // namespace geom
+
+#endif // __INCLUDE_INTERSECTION_STATS_HH__
@@ -0,0 +1,11 @@
+#ifndef __INCLUDE_IO_IO_HH__
+#define __INCLUDE_IO_IO_HH__
+
+#include "load.hh"
+#include "mapped.hh"
+#include "mesh.hh"
+#include "reader.hh"
+#include "scene.hh"
+#include "writer.hh"
+
+#endif // __INCLUDE_IO_IO_HH__
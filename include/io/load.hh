@@ -0,0 +1,90 @@
+#ifndef __INCLUDE_IO_LOAD_HH__
+#define __INCLUDE_IO_LOAD_HH__
+
+#include <concepts>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "mesh.hh"
+#include "primitives/triangle.hh"
+#include "reader.hh"
+#include "scene.hh"
+
+/**
+ * @brief load.hh
+ * Loading triangles from any supported input format
+ */
+
+namespace geom::io
+{
+
+/**
+ * @brief Input format
+ */
+enum class Format
+{
+  TEXT,   // number of triangles and their coordinates, see reader.hh
+  BINARY, // binary scene, see scene.hh
+  STL,    // binary or ASCII STL, see mesh.hh
+  OBJ,    // Wavefront OBJ, see mesh.hh
+  PLY,    // ASCII or binary PLY, see mesh.hh
+};
+
+/**
+ * @brief Get format by its name: "text", "binary", "stl", "obj" or "ply"
+ *
+ * @throw std::invalid_argument if name is unknown
+ */
+inline Format toFormat(std::string_view name)
+{
+  if ("text" == name)
+    return Format::TEXT;
+  if ("binary" == name)
+    return Format::BINARY;
+  if ("stl" == name)
+    return Format::STL;
+  if ("obj" == name)
+    return Format::OBJ;
+  if ("ply" == name)
+    return Format::PLY;
+
+  throw std::invalid_argument("Unknown input format '" + std::string{name} + "'");
+}
+
+/**
+ * @brief Load triangles from input of given format
+ *
+ * @tparam T - floating point type of coordinates
+ * @param[in] data whole input, e.g. MappedFile::view()
+ * @param[in] format format of input
+ * @param[in] nThreads number of threads to parse text with, other formats are decoded by one
+ * @return std::vector<Triangle<T>>
+ * @throw std::runtime_error if input is malformed
+ */
+template <std::floating_point T>
+std::vector<Triangle<T>> loadTriangles(std::string_view data, Format format,
+                                       std::size_t nThreads = 1)
+{
+  switch (format)
+  {
+  case Format::TEXT:
+    return parseTriangles<T>(data, nThreads);
+  case Format::BINARY:
+    return readScene<T>(data);
+  case Format::STL:
+    return loadStl<T>(data);
+  case Format::OBJ:
+    return loadObj<T>(data);
+  case Format::PLY:
+    return loadPly<T>(data);
+  default:
+    throw std::invalid_argument("Unknown input format");
+  }
+}
+
+} // namespace geom::io
+
+#endif // __INCLUDE_IO_LOAD_HH__
@@ -0,0 +1,267 @@
+#ifndef __INCLUDE_IO_MAPPED_HH__
+#define __INCLUDE_IO_MAPPED_HH__
+
+#include <cerrno>
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#if __has_include(<sys/mman.h>) && __has_include(<unistd.h>)
+#define GEOM_IO_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define GEOM_IO_HAS_MMAP 0
+#include <fstream>
+#include <iostream>
+#endif
+
+/**
+ * @brief mapped.hh
+ * Read-only view of a whole input file
+ */
+
+namespace geom::io
+{
+
+/**
+ * @class MappedFile
+ * @brief Whole contents of a file or of standard input as one contiguous character range
+ * @details
+ * Regular files are memory mapped, so no copy of the data is made. Pipes, terminals and
+ * platforms without mmap are read in large blocks into an owned buffer.
+ */
+class MappedFile final
+{
+public:
+  /**
+   * @brief Size of a block for inputs which can't be mapped
+   */
+  static constexpr std::size_t kBlockSize = std::size_t{1} << 20;
+
+private:
+  const char *data_{};
+  std::size_t size_{};
+  bool isMapped_{false};
+  std::vector<char> buffer_{};
+
+public:
+  /**
+   * @brief Map or read a file
+   *
+   * @param[in] path path to file
+   * @throw std::system_error if file can't be opened or read
+   */
+  explicit MappedFile(const std::filesystem::path &path);
+
+  /**
+   * @brief Map or read everything left in standard input
+   *
+   * @throw std::system_error if input can't be read
+   */
+  static MappedFile fromStdin();
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+  MappedFile(MappedFile &&other) noexcept;
+  MappedFile &operator=(MappedFile &&other) noexcept;
+  ~MappedFile();
+
+  /**
+   * @brief Get contents of file
+   */
+  std::string_view view() const;
+
+  std::size_t size() const;
+
+  /**
+   * @brief Check whether contents are mapped instead of copied
+   */
+  bool isMapped() const;
+
+private:
+  MappedFile() = default;
+
+  void unmap();
+
+#if GEOM_IO_HAS_MMAP
+  void load(int fd, const std::string &name);
+  void readBlocks(int fd, const std::string &name);
+#else
+  void readBlocks(std::istream &ist, const std::string &name);
+#endif
+};
+
+inline MappedFile::MappedFile(const std::filesystem::path &path)
+{
+#if GEOM_IO_HAS_MMAP
+  auto fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    throw std::system_error(errno, std::generic_category(),
+                            "MappedFile: can't open " + path.string());
+
+  try
+  {
+    load(fd, path.string());
+  }
+  catch (...)
+  {
+    ::close(fd);
+    throw;
+  }
+  ::close(fd);
+#else
+  std::ifstream ifs{path, std::ios::binary};
+  if (!ifs)
+    throw std::system_error(std::make_error_code(std::errc::no_such_file_or_directory),
+                            "MappedFile: can't open " + path.string());
+  readBlocks(ifs, path.string());
+#endif
+}
+
+inline MappedFile MappedFile::fromStdin()
+{
+  MappedFile res{};
+#if GEOM_IO_HAS_MMAP
+  res.load(STDIN_FILENO, "stdin");
+#else
+  res.readBlocks(std::cin, "stdin");
+#endif
+  return res;
+}
+
+inline MappedFile::MappedFile(MappedFile &&other) noexcept
+  : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)),
+    isMapped_(std::exchange(other.isMapped_, false)), buffer_(std::move(other.buffer_))
+{}
+
+inline MappedFile &MappedFile::operator=(MappedFile &&other) noexcept
+{
+  if (this != &other)
+  {
+    unmap();
+    data_ = std::exchange(other.data_, nullptr);
+    size_ = std::exchange(other.size_, 0);
+    isMapped_ = std::exchange(other.isMapped_, false);
+    buffer_ = std::move(other.buffer_);
+  }
+
+  return *this;
+}
+
+inline MappedFile::~MappedFile()
+{
+  unmap();
+}
+
+inline std::string_view MappedFile::view() const
+{
+  return {data_, size_};
+}
+
+inline std::size_t MappedFile::size() const
+{
+  return size_;
+}
+
+inline bool MappedFile::isMapped() const
+{
+  return isMapped_;
+}
+
+inline void MappedFile::unmap()
+{
+#if GEOM_IO_HAS_MMAP
+  if (isMapped_)
+    ::munmap(const_cast<char *>(data_), size_);
+#endif
+  isMapped_ = false;
+  data_ = nullptr;
+  size_ = 0;
+}
+
+#if GEOM_IO_HAS_MMAP
+
+/**
+ * @brief Map fd's contents starting from its current offset or read them if mapping fails
+ */
+inline void MappedFile::load(int fd, const std::string &name)
+{
+  struct stat st
+  {};
+  if (::fstat(fd, &st) != 0)
+    throw std::system_error(errno, std::generic_category(), "MappedFile: can't stat " + name);
+
+  auto offset = ::lseek(fd, 0, SEEK_CUR);
+  if (!S_ISREG(st.st_mode) || offset != 0 || st.st_size == 0)
+    return readBlocks(fd, name);
+
+  auto size = static_cast<std::size_t>(st.st_size);
+  auto *addr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (MAP_FAILED == addr)
+    return readBlocks(fd, name);
+
+  ::madvise(addr, size, MADV_SEQUENTIAL);
+  data_ = static_cast<const char *>(addr);
+  size_ = size;
+  isMapped_ = true;
+}
+
+inline void MappedFile::readBlocks(int fd, const std::string &name)
+{
+  std::size_t size = 0;
+  for (;;)
+  {
+    if (buffer_.size() < size + kBlockSize)
+      buffer_.resize(size + kBlockSize);
+
+    auto nRead = ::read(fd, buffer_.data() + size, kBlockSize);
+    if (nRead < 0)
+    {
+      if (EINTR == errno)
+        continue;
+      throw std::system_error(errno, std::generic_category(), "MappedFile: can't read " + name);
+    }
+    if (0 == nRead)
+      break;
+
+    size += static_cast<std::size_t>(nRead);
+  }
+
+  buffer_.resize(size);
+  data_ = buffer_.data();
+  size_ = size;
+}
+
+#else
+
+inline void MappedFile::readBlocks(std::istream &ist, const std::string &name)
+{
+  std::size_t size = 0;
+  while (ist)
+  {
+    buffer_.resize(size + kBlockSize);
+    ist.read(buffer_.data() + size, static_cast<std::streamsize>(kBlockSize));
+    size += static_cast<std::size_t>(ist.gcount());
+  }
+
+  if (ist.bad())
+    throw std::system_error(std::make_error_code(std::errc::io_error),
+                            "MappedFile: can't read " + name);
+
+  buffer_.resize(size);
+  data_ = buffer_.data();
+  size_ = size;
+}
+
+#endif
+
+} // namespace geom::io
+
+#endif // __INCLUDE_IO_MAPPED_HH__
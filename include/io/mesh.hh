@@ -0,0 +1,646 @@
+#ifndef __INCLUDE_IO_MESH_HH__
+#define __INCLUDE_IO_MESH_HH__
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "primitives/triangle.hh"
+#include "primitives/vec3.hh"
+#include "reader.hh"
+
+/**
+ * @brief mesh.hh
+ * Loaders of STL (binary and ASCII), OBJ and PLY (ASCII and binary) meshes. Every loader
+ * walks the whole file in memory, e.g. MappedFile::view(), and passes triangles to a callback
+ * one by one as soon as they are decoded. Polygons are split into fans of triangles.
+ */
+
+namespace geom::io
+{
+
+/**
+ * @brief Decode STL file and call emit(const Triangle<T> &) for every facet
+ * @details File is binary if its size matches facet count stored in binary header, otherwise
+ * it must be ASCII STL starting with "solid" and ending with "endsolid"
+ *
+ * @throw std::runtime_error if file is malformed
+ */
+template <std::floating_point T, std::invocable<const Triangle<T> &> Emit>
+void forEachStlTriangle(std::string_view data, Emit emit);
+
+/**
+ * @brief Decode OBJ file and call emit(const Triangle<T> &) for every triangle of its faces
+ * @details Only "v" and "f" statements are used, texture and normal indices are ignored
+ *
+ * @throw std::runtime_error if file is malformed
+ */
+template <std::floating_point T, std::invocable<const Triangle<T> &> Emit>
+void forEachObjTriangle(std::string_view data, Emit emit);
+
+/**
+ * @brief Decode PLY file and call emit(const Triangle<T> &) for every triangle of its faces
+ * @details
+ * Coordinates are taken from x, y, z properties of "vertex" element, faces from
+ * vertex_indices (or vertex_index) list of "face" element. Other elements and properties are
+ * skipped. Faces must follow vertices.
+ *
+ * @throw std::runtime_error if file is malformed
+ */
+template <std::floating_point T, std::invocable<const Triangle<T> &> Emit>
+void forEachPlyTriangle(std::string_view data, Emit emit);
+
+/**
+ * @brief Load all triangles of STL file
+ */
+template <std::floating_point T>
+std::vector<Triangle<T>> loadStl(std::string_view data);
+
+/**
+ * @brief Load all triangles of OBJ file
+ */
+template <std::floating_point T>
+std::vector<Triangle<T>> loadObj(std::string_view data);
+
+/**
+ * @brief Load all triangles of PLY file
+ */
+template <std::floating_point T>
+std::vector<Triangle<T>> loadPly(std::string_view data);
+
+} // namespace geom::io
+
+namespace geom::io::detail
+{
+
+//============================================================================================
+//                                     Common helpers
+//============================================================================================
+
+/**
+ * @brief Cut the first line off rest, line ending isn't included
+ */
+inline std::string_view nextLine(std::string_view &rest)
+{
+  auto pos = rest.find('\n');
+  auto line = rest.substr(0, pos);
+  rest.remove_prefix(std::string_view::npos == pos ? rest.size() : pos + 1);
+  if (!line.empty() && '\r' == line.back())
+    line.remove_suffix(1);
+
+  return line;
+}
+
+/**
+ * @brief Cut the first whitespace separated token off rest
+ *
+ * @return token or empty view if rest has no more tokens
+ */
+inline std::string_view nextToken(std::string_view &rest)
+{
+  auto begin = std::find_if_not(rest.begin(), rest.end(), isSpace);
+  auto end = std::find_if(begin, rest.end(), isSpace);
+  rest = std::string_view{end, rest.end()};
+  return std::string_view{begin, end};
+}
+
+template <typename U>
+U toNumber(std::string_view token, const char *what)
+{
+  if (!token.empty() && '+' == token.front())
+    token.remove_prefix(1);
+
+  U res{};
+  const auto *end = token.data() + token.size();
+  auto [ptr, ec] = std::from_chars(token.data(), end, res);
+  if (token.empty() || ec != std::errc{} || ptr != end)
+    throw std::runtime_error(std::string{"Malformed "} + what + " '" + std::string{token} + "'");
+
+  return res;
+}
+
+/**
+ * @brief Load little or big endian value of type U from unaligned memory
+ */
+template <typename U>
+U loadBytes(const char *ptr, bool isBigEndian)
+{
+  std::array<char, sizeof(U)> bytes{};
+  std::memcpy(bytes.data(), ptr, sizeof(U));
+  if (isBigEndian != (std::endian::native == std::endian::big))
+    std::reverse(bytes.begin(), bytes.end());
+
+  return std::bit_cast<U>(bytes);
+}
+
+/**
+ * @brief Emit fan triangulation of polygon given by vertex indices
+ */
+template <std::floating_point T, typename Emit>
+void emitFan(const std::vector<Vec3<T>> &vertices, const std::vector<std::size_t> &polygon,
+             Emit &emit)
+{
+  if (polygon.size() < 3)
+    throw std::runtime_error("Face with less than 3 vertices");
+
+  for (std::size_t i = 1; i + 1 < polygon.size(); ++i)
+    emit(Triangle<T>{vertices[polygon[0]], vertices[polygon[i]], vertices[polygon[i + 1]]});
+}
+
+/**
+ * @brief Check vertex index and convert it to std::size_t
+ */
+inline std::size_t checkIndex(std::int64_t idx, std::size_t nVertices)
+{
+  if (idx < 0 || static_cast<std::uint64_t>(idx) >= nVertices)
+    throw std::runtime_error("Vertex index " + std::to_string(idx) + " is out of range");
+
+  return static_cast<std::size_t>(idx);
+}
+
+//============================================================================================
+//                                          STL
+//============================================================================================
+
+constexpr std::size_t kStlHeaderSize = 84;
+constexpr std::size_t kStlFacetSize = 50;
+constexpr std::size_t kStlCountOffset = 80;
+constexpr std::size_t kStlVertexOffset = 12; // facet starts with normal
+
+inline bool isBinaryStl(std::string_view data, std::size_t &count)
+{
+  if (data.size() < kStlHeaderSize)
+    return false;
+
+  count = loadBytes<std::uint32_t>(data.data() + kStlCountOffset, false);
+  return data.size() == kStlHeaderSize + kStlFacetSize * count;
+}
+
+template <std::floating_point T, typename Emit>
+void forEachBinaryStl(std::string_view data, std::size_t count, Emit &emit)
+{
+  auto vertex = [](const char *ptr) {
+    return Vec3<T>{static_cast<T>(loadBytes<float>(ptr, false)),
+                   static_cast<T>(loadBytes<float>(ptr + 4, false)),
+                   static_cast<T>(loadBytes<float>(ptr + 8, false))};
+  };
+
+  const auto *facet = data.data() + kStlHeaderSize;
+  for (std::size_t i = 0; i < count; ++i, facet += kStlFacetSize)
+  {
+    const auto *ptr = facet + kStlVertexOffset;
+    emit(Triangle<T>{vertex(ptr), vertex(ptr + 12), vertex(ptr + 24)});
+  }
+}
+
+template <std::floating_point T, typename Emit>
+void forEachAsciiStl(std::string_view data, Emit &emit)
+{
+  auto rest = data;
+  nextLine(rest); // "solid name"
+
+  std::array<Vec3<T>, 3> vertices{Vec3<T>{}, Vec3<T>{}, Vec3<T>{}};
+  std::size_t nVertices = 0;
+  bool isEnded = false;
+  for (auto token = nextToken(rest); !token.empty(); token = nextToken(rest))
+  {
+    if ("endsolid" == token || "facet" == token)
+      isEnded = "endsolid" == token;
+    if ("endloop" == token && nVertices != 0)
+      throw std::runtime_error("STL facet must have 3 vertices");
+    if ("vertex" != token)
+      continue;
+
+    auto &vert = vertices[nVertices++];
+    vert.x = toNumber<T>(nextToken(rest), "STL coordinate");
+    vert.y = toNumber<T>(nextToken(rest), "STL coordinate");
+    vert.z = toNumber<T>(nextToken(rest), "STL coordinate");
+
+    if (3 == nVertices)
+    {
+      emit(Triangle<T>{vertices[0], vertices[1], vertices[2]});
+      nVertices = 0;
+    }
+  }
+
+  if (nVertices != 0)
+    throw std::runtime_error("STL facet must have 3 vertices");
+
+  /* Binary header may start with "solid" too, so missing end is the sign of truncated file */
+  if (!isEnded)
+    throw std::runtime_error("ASCII STL has no endsolid or binary STL is truncated");
+}
+
+//============================================================================================
+//                                          OBJ
+//============================================================================================
+
+/**
+ * @brief Convert OBJ index token "v", "v/vt", "v//vn" or "v/vt/vn" to 0-based vertex index
+ */
+inline std::size_t objIndex(std::string_view token, std::size_t nVertices)
+{
+  auto idx = toNumber<std::int64_t>(token.substr(0, token.find('/')), "OBJ index");
+  if (0 == idx)
+    throw std::runtime_error("OBJ indices start from 1");
+
+  return checkIndex(idx > 0 ? idx - 1 : static_cast<std::int64_t>(nVertices) + idx, nVertices);
+}
+
+//============================================================================================
+//                                          PLY
+//============================================================================================
+
+enum class PlyType
+{
+  INT8,
+  UINT8,
+  INT16,
+  UINT16,
+  INT32,
+  UINT32,
+  FLOAT32,
+  FLOAT64
+};
+
+enum class PlyEncoding
+{
+  ASCII,
+  BINARY_LE,
+  BINARY_BE
+};
+
+struct PlyProperty final
+{
+  std::string name{};
+  PlyType type{};
+  bool isList{false};
+  PlyType countType{}; // type of list length
+};
+
+struct PlyElement final
+{
+  std::string name{};
+  std::size_t count{};
+  std::vector<PlyProperty> props{};
+};
+
+struct PlyHeader final
+{
+  PlyEncoding encoding{};
+  std::vector<PlyElement> elements{};
+  std::size_t bodyOffset{};
+};
+
+inline PlyType toPlyType(std::string_view name)
+{
+  constexpr std::array<std::pair<std::string_view, PlyType>, 16> kNames{{
+    {"char", PlyType::INT8},       {"int8", PlyType::INT8},       {"uchar", PlyType::UINT8},
+    {"uint8", PlyType::UINT8},     {"short", PlyType::INT16},     {"int16", PlyType::INT16},
+    {"ushort", PlyType::UINT16},   {"uint16", PlyType::UINT16},   {"int", PlyType::INT32},
+    {"int32", PlyType::INT32},     {"uint", PlyType::UINT32},     {"uint32", PlyType::UINT32},
+    {"float", PlyType::FLOAT32},   {"float32", PlyType::FLOAT32}, {"double", PlyType::FLOAT64},
+    {"float64", PlyType::FLOAT64},
+  }};
+
+  auto it = std::find_if(kNames.begin(), kNames.end(),
+                         [name](auto &elem) { return elem.first == name; });
+  if (kNames.end() == it)
+    throw std::runtime_error("Unknown PLY type '" + std::string{name} + "'");
+
+  return it->second;
+}
+
+inline PlyHeader readPlyHeader(std::string_view data)
+{
+  auto rest = data;
+  if (nextLine(rest) != "ply")
+    throw std::runtime_error("Not a PLY file");
+
+  PlyHeader header{};
+  bool hasFormat = false;
+  for (;;)
+  {
+    if (rest.empty())
+      throw std::runtime_error("PLY header has no end_header");
+
+    auto line = nextLine(rest);
+    auto keyword = nextToken(line);
+    if ("end_header" == keyword)
+      break;
+
+    if ("format" == keyword)
+    {
+      auto encoding = nextToken(line);
+      if ("ascii" == encoding)
+        header.encoding = PlyEncoding::ASCII;
+      else if ("binary_little_endian" == encoding)
+        header.encoding = PlyEncoding::BINARY_LE;
+      else if ("binary_big_endian" == encoding)
+        header.encoding = PlyEncoding::BINARY_BE;
+      else
+        throw std::runtime_error("Unknown PLY format '" + std::string{encoding} + "'");
+      hasFormat = true;
+    }
+    else if ("element" == keyword)
+    {
+      PlyElement elem{};
+      elem.name = nextToken(line);
+      elem.count = toNumber<std::size_t>(nextToken(line), "PLY element count");
+      header.elements.push_back(std::move(elem));
+    }
+    else if ("property" == keyword)
+    {
+      if (header.elements.empty())
+        throw std::runtime_error("PLY property before any element");
+
+      PlyProperty prop{};
+      auto type = nextToken(line);
+      if ("list" == type)
+      {
+        prop.isList = true;
+        prop.countType = toPlyType(nextToken(line));
+        type = nextToken(line);
+      }
+      prop.type = toPlyType(type);
+      prop.name = nextToken(line);
+      header.elements.back().props.push_back(std::move(prop));
+    }
+    else if (keyword != "comment" && keyword != "obj_info" && !keyword.empty())
+      throw std::runtime_error("Unknown PLY header keyword '" + std::string{keyword} + "'");
+  }
+
+  if (!hasFormat)
+    throw std::runtime_error("PLY header has no format");
+
+  header.bodyOffset = data.size() - rest.size();
+  return header;
+}
+
+/**
+ * @class PlyAsciiSource
+ * @brief Sequence of whitespace separated values of ASCII PLY body
+ */
+class PlyAsciiSource final
+{
+private:
+  std::string_view rest_;
+
+public:
+  explicit PlyAsciiSource(std::string_view body) : rest_(body)
+  {}
+
+  /**
+   * @brief Number of bytes left, every value takes at least one
+   */
+  std::size_t remaining() const
+  {
+    return rest_.size();
+  }
+
+  double next(PlyType type)
+  {
+    auto token = nextToken(rest_);
+    if (token.empty())
+      throw std::runtime_error("Truncated PLY body");
+
+    if (PlyType::FLOAT32 == type || PlyType::FLOAT64 == type)
+      return toNumber<double>(token, "PLY value");
+
+    return static_cast<double>(toNumber<std::int64_t>(token, "PLY value"));
+  }
+};
+
+/**
+ * @class PlyBinarySource
+ * @brief Sequence of packed values of binary PLY body
+ */
+class PlyBinarySource final
+{
+private:
+  const char *cur_;
+  const char *end_;
+  bool isBigEndian_;
+
+public:
+  PlyBinarySource(std::string_view body, bool isBigEndian)
+    : cur_(body.data()), end_(body.data() + body.size()), isBigEndian_(isBigEndian)
+  {}
+
+  /**
+   * @brief Number of bytes left, every value takes at least one
+   */
+  std::size_t remaining() const
+  {
+    return static_cast<std::size_t>(end_ - cur_);
+  }
+
+  double next(PlyType type)
+  {
+    switch (type)
+    {
+    case PlyType::INT8:
+      return load<std::int8_t>();
+    case PlyType::UINT8:
+      return load<std::uint8_t>();
+    case PlyType::INT16:
+      return load<std::int16_t>();
+    case PlyType::UINT16:
+      return load<std::uint16_t>();
+    case PlyType::INT32:
+      return load<std::int32_t>();
+    case PlyType::UINT32:
+      return load<std::uint32_t>();
+    case PlyType::FLOAT32:
+      return load<float>();
+    case PlyType::FLOAT64:
+      return load<double>();
+    default:
+      throw std::logic_error("Impossible PLY type");
+    }
+  }
+
+private:
+  template <typename U>
+  double load()
+  {
+    if (static_cast<std::size_t>(end_ - cur_) < sizeof(U))
+      throw std::runtime_error("Truncated PLY body");
+
+    auto res = loadBytes<U>(cur_, isBigEndian_);
+    cur_ += sizeof(U);
+    return static_cast<double>(res);
+  }
+};
+
+inline std::int64_t plyInteger(double val)
+{
+  constexpr double kMaxInteger = 0x1p53;
+  if (!(std::abs(val) <= kMaxInteger) || std::islessgreater(std::trunc(val), val))
+    throw std::runtime_error("PLY list length or index isn't an integer");
+
+  return static_cast<std::int64_t>(val);
+}
+
+template <std::floating_point T, typename Source, typename Emit>
+void forEachPlyBody(const PlyHeader &header, Source &src, Emit &emit)
+{
+  std::vector<Vec3<T>> vertices{};
+  std::vector<std::size_t> polygon{};
+
+  for (const auto &elem : header.elements)
+  {
+    bool isVertex = "vertex" == elem.name;
+    bool isFace = "face" == elem.name;
+    /* Count comes from the header, so reserve no more vertices than the body can hold */
+    if (isVertex)
+      vertices.reserve(
+        std::min(elem.count, src.remaining() / std::max<std::size_t>(elem.props.size(), 1)));
+
+    for (std::size_t i = 0; i < elem.count; ++i)
+    {
+      Vec3<T> vert{};
+      for (const auto &prop : elem.props)
+      {
+        if (prop.isList)
+        {
+          auto len = plyInteger(src.next(prop.countType));
+          bool isIndices = isFace && ("vertex_indices" == prop.name || "vertex_index" == prop.name);
+          polygon.clear();
+          for (std::int64_t j = 0; j < len; ++j)
+          {
+            auto val = src.next(prop.type);
+            if (isIndices)
+              polygon.push_back(checkIndex(plyInteger(val), vertices.size()));
+          }
+
+          if (isIndices)
+            emitFan(vertices, polygon, emit);
+          continue;
+        }
+
+        auto val = static_cast<T>(src.next(prop.type));
+        if (!isVertex)
+          continue;
+
+        if ("x" == prop.name)
+          vert.x = val;
+        else if ("y" == prop.name)
+          vert.y = val;
+        else if ("z" == prop.name)
+          vert.z = val;
+      }
+
+      if (isVertex)
+        vertices.push_back(vert);
+    }
+  }
+}
+
+} // namespace geom::io::detail
+
+namespace geom::io
+{
+
+template <std::floating_point T, std::invocable<const Triangle<T> &> Emit>
+void forEachStlTriangle(std::string_view data, Emit emit)
+{
+  std::size_t count = 0;
+  if (detail::isBinaryStl(data, count))
+    return detail::forEachBinaryStl<T>(data, count, emit);
+
+  auto rest = data;
+  if (detail::nextToken(rest) != "solid")
+    throw std::runtime_error("Not an STL file or truncated binary STL");
+
+  detail::forEachAsciiStl<T>(data, emit);
+}
+
+template <std::floating_point T, std::invocable<const Triangle<T> &> Emit>
+void forEachObjTriangle(std::string_view data, Emit emit)
+{
+  std::vector<Vec3<T>> vertices{};
+  std::vector<std::size_t> polygon{};
+
+  for (auto rest = data; !rest.empty();)
+  {
+    auto line = detail::nextLine(rest);
+    auto keyword = detail::nextToken(line);
+    if ("v" == keyword)
+    {
+      auto x = detail::toNumber<T>(detail::nextToken(line), "OBJ coordinate");
+      auto y = detail::toNumber<T>(detail::nextToken(line), "OBJ coordinate");
+      auto z = detail::toNumber<T>(detail::nextToken(line), "OBJ coordinate");
+      vertices.emplace_back(x, y, z);
+    }
+    else if ("f" == keyword)
+    {
+      polygon.clear();
+      for (auto token = detail::nextToken(line); !token.empty(); token = detail::nextToken(line))
+        polygon.push_back(detail::objIndex(token, vertices.size()));
+
+      detail::emitFan(vertices, polygon, emit);
+    }
+  }
+}
+
+template <std::floating_point T, std::invocable<const Triangle<T> &> Emit>
+void forEachPlyTriangle(std::string_view data, Emit emit)
+{
+  auto header = detail::readPlyHeader(data);
+  auto body = data.substr(header.bodyOffset);
+
+  if (detail::PlyEncoding::ASCII == header.encoding)
+  {
+    detail::PlyAsciiSource src{body};
+    detail::forEachPlyBody<T>(header, src, emit);
+  }
+  else
+  {
+    detail::PlyBinarySource src{body, detail::PlyEncoding::BINARY_BE == header.encoding};
+    detail::forEachPlyBody<T>(header, src, emit);
+  }
+}
+
+template <std::floating_point T>
+std::vector<Triangle<T>> loadStl(std::string_view data)
+{
+  std::vector<Triangle<T>> res{};
+  if (std::size_t count = 0; detail::isBinaryStl(data, count))
+    res.reserve(count);
+
+  forEachStlTriangle<T>(data, [&res](const Triangle<T> &tr) { res.push_back(tr); });
+  return res;
+}
+
+template <std::floating_point T>
+std::vector<Triangle<T>> loadObj(std::string_view data)
+{
+  std::vector<Triangle<T>> res{};
+  forEachObjTriangle<T>(data, [&res](const Triangle<T> &tr) { res.push_back(tr); });
+  return res;
+}
+
+template <std::floating_point T>
+std::vector<Triangle<T>> loadPly(std::string_view data)
+{
+  std::vector<Triangle<T>> res{};
+  forEachPlyTriangle<T>(data, [&res](const Triangle<T> &tr) { res.push_back(tr); });
+  return res;
+}
+
+} // namespace geom::io
+
+#endif // __INCLUDE_IO_MESH_HH__
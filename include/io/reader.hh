@@ -0,0 +1,326 @@
+#ifndef __INCLUDE_IO_READER_HH__
+#define __INCLUDE_IO_READER_HH__
+
+#include <algorithm>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "primitives/triangle.hh"
+#include "primitives/trianglesoa.hh"
+#include "primitives/vec3.hh"
+
+/**
+ * @brief reader.hh
+ * Bulk parser of text triangle lists: number of triangles followed by 9 coordinates of each
+ * one, separated by any whitespace. Same format operator>> reads, but parsed with
+ * std::from_chars straight from memory, optionally by several threads. Anything after the
+ * last coordinate is ignored as operator>> based reading does.
+ */
+
+namespace geom::io
+{
+
+/**
+ * @brief Parse text triangle list
+ *
+ * @tparam T - floating point type of coordinates
+ * @param[in] text whole input, e.g. MappedFile::view()
+ * @param[in] nThreads number of threads to parse with
+ * @return std::vector<Triangle<T>> parsed triangles
+ * @throw std::runtime_error if input is malformed or has less coordinates than announced
+ */
+template <std::floating_point T>
+std::vector<Triangle<T>> parseTriangles(std::string_view text, std::size_t nThreads = 1);
+
+/**
+ * @brief Parse text triangle list straight into structure-of-arrays container
+ *
+ * @tparam T - floating point type of coordinates
+ * @param[in] text whole input, e.g. MappedFile::view()
+ * @param[in] nThreads number of threads to parse with
+ * @return TriangleSoA<T> parsed triangles
+ * @throw std::runtime_error if input is malformed or has less coordinates than announced
+ */
+template <std::floating_point T>
+TriangleSoA<T> parseTrianglesSoA(std::string_view text, std::size_t nThreads = 1);
+
+} // namespace geom::io
+
+namespace geom::io::detail
+{
+
+/**
+ * @brief Inputs shorter than this per thread are parsed by one thread
+ */
+constexpr std::size_t kMinChunkSize = std::size_t{1} << 16;
+
+constexpr std::size_t kCoordsPerTriangle = 9;
+
+inline bool isSpace(char c)
+{
+  return ' ' == c || '\n' == c || '\t' == c || '\r' == c || '\v' == c || '\f' == c;
+}
+
+inline const char *skipSpaces(const char *cur, const char *end)
+{
+  while (cur != end && isSpace(*cur))
+    ++cur;
+  return cur;
+}
+
+[[noreturn]] inline void throwMalformed(std::string_view text, const char *pos)
+{
+  auto offset = static_cast<std::size_t>(pos - text.data());
+  auto token = std::string{pos, std::find_if(pos, text.data() + text.size(), isSpace)};
+  throw std::runtime_error("Malformed number '" + token + "' at offset " + std::to_string(offset));
+}
+
+/**
+ * @brief Parse one whitespace terminated number starting at cur
+ *
+ * @return pointer past the number
+ */
+template <typename U>
+const char *parseNumber(std::string_view text, const char *cur, U &val)
+{
+  const auto *end = text.data() + text.size();
+  const auto *begin = cur;
+  if (cur != end && '+' == *cur)
+    ++cur;
+
+  auto [ptr, ec] = std::from_chars(cur, end, val);
+  if (ec != std::errc{} || (ptr != end && !isSpace(*ptr)))
+    throwMalformed(text, begin);
+
+  return ptr;
+}
+
+/**
+ * @brief Count whitespace separated tokens in [begin, end)
+ */
+inline std::size_t countTokens(const char *begin, const char *end)
+{
+  std::size_t count = 0;
+  bool isPrevSpace = true;
+  for (; begin != end; ++begin)
+  {
+    bool isCurSpace = isSpace(*begin);
+    count += static_cast<std::size_t>(isPrevSpace & !isCurSpace);
+    isPrevSpace = isCurSpace;
+  }
+
+  return count;
+}
+
+/**
+ * @brief Split [begin, end) into at most nChunks pieces which start and end on whitespace
+ *
+ * @return chunk boundaries, front() is begin and back() is end
+ */
+inline std::vector<const char *> splitChunks(const char *begin, const char *end,
+                                             std::size_t nChunks)
+{
+  std::vector<const char *> bounds{begin};
+  auto size = static_cast<std::size_t>(end - begin);
+  for (std::size_t i = 1; i < nChunks; ++i)
+  {
+    auto *bound = std::max(bounds.back(), begin + size / nChunks * i);
+    bound = std::find_if(bound, end, isSpace);
+    if (bound != bounds.back())
+      bounds.push_back(bound);
+  }
+
+  if (bounds.back() != end)
+    bounds.push_back(end);
+
+  return bounds;
+}
+
+/**
+ * @brief Parse tokens of [begin, end) as numbers and pass them to store(firstIdx + i, number)
+ * @details Parsing stops before the token with index count
+ *
+ * @return index past the last parsed number
+ */
+template <std::floating_point T, typename Store>
+std::size_t parseRange(std::string_view text, const char *begin, const char *end,
+                       std::size_t firstIdx, std::size_t count, Store &store)
+{
+  auto idx = firstIdx;
+  for (auto *cur = skipSpaces(begin, end); cur != end && idx < count; cur = skipSpaces(cur, end))
+  {
+    T val{};
+    cur = parseNumber(text, cur, val);
+    store(idx, val);
+    ++idx;
+  }
+
+  return idx;
+}
+
+/**
+ * @brief Run func(i) for every i in [0, n) on its own thread and rethrow the first exception
+ */
+template <typename Func>
+void runThreads(std::size_t n, Func func)
+{
+  std::vector<std::exception_ptr> errors(n);
+  std::vector<std::thread> threads{};
+  threads.reserve(n);
+
+  for (std::size_t i = 0; i < n; ++i)
+    threads.emplace_back([&, i] {
+      try
+      {
+        func(i);
+      }
+      catch (...)
+      {
+        errors[i] = std::current_exception();
+      }
+    });
+
+  for (auto &thread : threads)
+    thread.join();
+
+  for (auto &err : errors)
+    if (err)
+      std::rethrow_exception(err);
+}
+
+/**
+ * @brief Parse number of triangles and then their coordinates
+ * @details
+ * Parallel parse is done in 2 passes: every thread counts tokens of its chunk, then prefix
+ * sums of counts give index of the first coordinate of every chunk, and every thread parses
+ * its chunk storing coordinates by their indices.
+ *
+ * @param[in] resize callback which receives number of triangles before any store
+ * @param[in] store callback which receives index of coordinate and its value
+ */
+template <std::floating_point T, typename Resize, typename Store>
+void parseTriangleList(std::string_view text, std::size_t nThreads, Resize resize, Store store)
+{
+  const auto *end = text.data() + text.size();
+  const auto *cur = skipSpaces(text.data(), end);
+  if (cur == end)
+    throw std::runtime_error("Missing number of triangles");
+
+  std::size_t nTriangles = 0;
+  cur = parseNumber(text, cur, nTriangles);
+
+  /* Every coordinate takes a digit and a separator before it, so a bogus count is rejected
+   * before anything is allocated for it */
+  auto size = static_cast<std::size_t>(end - cur);
+  if (nTriangles > size / (2 * kCoordsPerTriangle))
+    throw std::runtime_error("Expected " + std::to_string(nTriangles) + " triangles, input has " +
+                             std::to_string(size) + " bytes left");
+
+  resize(nTriangles);
+
+  auto count = nTriangles * kCoordsPerTriangle;
+  auto nChunks = std::clamp<std::size_t>(size / kMinChunkSize, 1,
+                                         std::max<std::size_t>(nThreads, 1));
+
+  std::size_t nParsed = 0;
+  if (1 == nChunks)
+    nParsed = parseRange<T>(text, cur, end, 0, count, store);
+  else
+  {
+    auto bounds = splitChunks(cur, end, nChunks);
+    auto nRanges = bounds.size() - 1;
+
+    std::vector<std::size_t> firstIdx(nRanges + 1);
+    runThreads(nRanges,
+               [&](std::size_t i) { firstIdx[i + 1] = countTokens(bounds[i], bounds[i + 1]); });
+    for (std::size_t i = 0; i < nRanges; ++i)
+      firstIdx[i + 1] += firstIdx[i];
+
+    runThreads(nRanges, [&](std::size_t i) {
+      auto chunkStore = store;
+      parseRange<T>(text, bounds[i], bounds[i + 1], firstIdx[i], count, chunkStore);
+    });
+    nParsed = std::min(firstIdx.back(), count);
+  }
+
+  if (nParsed < count)
+    throw std::runtime_error("Expected " + std::to_string(count) + " coordinates, got " +
+                             std::to_string(nParsed));
+}
+
+template <std::floating_point T>
+void setCoord(Vec3<T> &vec, std::size_t axis, T val)
+{
+  switch (axis)
+  {
+  case 0:
+    vec.x = val;
+    break;
+  case 1:
+    vec.y = val;
+    break;
+  default:
+    vec.z = val;
+    break;
+  }
+}
+
+} // namespace geom::io::detail
+
+namespace geom::io
+{
+
+template <std::floating_point T>
+std::vector<Triangle<T>> parseTriangles(std::string_view text, std::size_t nThreads)
+{
+  std::vector<Triangle<T>> res{};
+  auto *data = &res;
+  detail::parseTriangleList<T>(
+    text, nThreads, [data](std::size_t n) { data->resize(n); },
+    [data](std::size_t idx, T val) {
+      auto coord = idx % detail::kCoordsPerTriangle;
+      detail::setCoord((*data)[idx / detail::kCoordsPerTriangle][coord / 3], coord % 3, val);
+    });
+
+  return res;
+}
+
+template <std::floating_point T>
+TriangleSoA<T> parseTrianglesSoA(std::string_view text, std::size_t nThreads)
+{
+  TriangleSoA<T> res{};
+  auto *data = &res;
+  detail::parseTriangleList<T>(
+    text, nThreads, [data](std::size_t n) { data->resize(n); },
+    [data](std::size_t idx, T val) {
+      auto tr = idx / detail::kCoordsPerTriangle;
+      auto coord = idx % detail::kCoordsPerTriangle;
+      auto vertex = coord / 3;
+      switch (coord % 3)
+      {
+      case 0:
+        data->x(vertex)[tr] = val;
+        break;
+      case 1:
+        data->y(vertex)[tr] = val;
+        break;
+      default:
+        data->z(vertex)[tr] = val;
+        break;
+      }
+    });
+
+  return res;
+}
+
+} // namespace geom::io
+
+#endif // __INCLUDE_IO_READER_HH__
@@ -0,0 +1,416 @@
+#ifndef __INCLUDE_IO_SCENE_HH__
+#define __INCLUDE_IO_SCENE_HH__
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <ostream>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "primitives/triangle.hh"
+#include "primitives/vec3.hh"
+
+/**
+ * @brief scene.hh
+ * Binary triangle scene format: 64 bytes header followed by packed coordinates
+ * x0 y0 z0 x1 y1 z1 x2 y2 z2 of every triangle in native little-endian float or double.
+ * Coordinates start at offset 64, so in a mapped file they are aligned for any vector load.
+ */
+
+namespace geom::io
+{
+
+/**
+ * @brief Precision tag of scene: number of bytes per coordinate
+ */
+enum class Precision : std::uint32_t
+{
+  FLOAT = 4,
+  DOUBLE = 8
+};
+
+/**
+ * @brief Types which a scene may store coordinates in
+ */
+template <typename T>
+concept SceneCoord = std::same_as<T, float> || std::same_as<T, double>;
+
+/**
+ * @class SceneHeader
+ * @brief Header of binary scene
+ */
+struct SceneHeader final
+{
+  static constexpr std::array<char, 8> kMagic{'T', 'R', 'I', 'S', 'C', 'E', 'N', 'E'};
+  static constexpr std::uint32_t kVersion = 1;
+  static constexpr std::uint32_t kHasChecksum = 1; // flag: checksum field is valid
+
+  std::array<char, 8> magic{kMagic};
+  std::uint32_t version{kVersion};
+  Precision precision{Precision::FLOAT};
+  std::uint64_t count{};
+  std::uint32_t flags{};
+  std::uint32_t reserved{};
+  std::uint64_t checksum{};
+  std::array<std::uint8_t, 24> padding{};
+
+  /**
+   * @brief Get size of coordinates block in bytes
+   */
+  std::uint64_t dataSize() const;
+};
+
+static_assert(sizeof(SceneHeader) == 64 && std::is_trivially_copyable_v<SceneHeader>);
+
+/**
+ * @brief Check whether data starts with scene magic
+ */
+inline bool isScene(std::string_view data);
+
+/**
+ * @brief Read and validate header of scene
+ *
+ * @param[in] data whole scene, e.g. MappedFile::view()
+ * @return SceneHeader
+ * @throw std::runtime_error if data isn't a scene of supported version or is truncated
+ */
+inline SceneHeader readSceneHeader(std::string_view data);
+
+/**
+ * @class SceneView
+ * @brief Triangles of a binary scene used in place without any parsing or copying
+ *
+ * @tparam T - type of coordinates, must match scene's precision
+ */
+template <SceneCoord T>
+class SceneView final
+{
+public:
+  class ConstIterator;
+
+private:
+  SceneHeader header_{};
+  const char *coords_{};
+
+public:
+  /**
+   * @brief Construct view of scene
+   *
+   * @param[in] data whole scene, must outlive the view
+   * @throw std::runtime_error if scene is malformed or its precision isn't T
+   */
+  explicit SceneView(std::string_view data);
+
+  std::size_t size() const;
+  const SceneHeader &header() const;
+
+  /**
+   * @brief Get idx-th triangle
+   */
+  Triangle<T> operator[](std::size_t idx) const;
+
+  /**
+   * @brief Check stored checksum
+   *
+   * @return true if scene has no checksum or checksum matches coordinates
+   */
+  bool verify() const;
+
+  ConstIterator begin() const;
+  ConstIterator end() const;
+
+  /**
+   * @class ConstIterator
+   * @brief Iterator which loads triangles from scene
+   */
+  class ConstIterator final
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = Triangle<T>;
+    using reference = Triangle<T>;
+
+  private:
+    const SceneView *view_{};
+    std::size_t idx_{};
+
+  public:
+    ConstIterator() = default;
+    ConstIterator(const SceneView *view, std::size_t idx);
+
+    ConstIterator &operator++();
+    ConstIterator operator++(int);
+
+    reference operator*() const;
+
+    bool operator==(const ConstIterator &rhs) const = default;
+  };
+
+private:
+  T coord(std::size_t idx) const;
+};
+
+/**
+ * @brief Read triangles of scene of any precision
+ *
+ * @tparam T - floating point type of coordinates to convert to
+ * @param[in] data whole scene
+ * @param[in] isVerify check stored checksum
+ * @return std::vector<Triangle<T>>
+ * @throw std::runtime_error if scene is malformed or checksum doesn't match
+ */
+template <std::floating_point T>
+std::vector<Triangle<T>> readScene(std::string_view data, bool isVerify = true);
+
+/**
+ * @brief Write triangles as binary scene
+ *
+ * @tparam T - type of coordinates to store
+ * @tparam Range - forward range of Triangle<T>
+ * @param[out] ost binary output stream
+ * @param[in] triangles triangles to write
+ * @param[in] hasChecksum whether to compute and store checksum
+ */
+template <SceneCoord T, std::ranges::forward_range Range>
+void writeScene(std::ostream &ost, const Range &triangles, bool hasChecksum = true);
+
+} // namespace geom::io
+
+namespace geom::io::detail
+{
+
+constexpr std::uint64_t kFnvOffset = 14695981039346656037ULL;
+constexpr std::uint64_t kFnvPrime = 1099511628211ULL;
+
+/**
+ * @brief FNV-1a step over the bit pattern of a coordinate
+ */
+template <SceneCoord T>
+std::uint64_t hashCoord(std::uint64_t hash, T coord)
+{
+  using Bits = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+  return (hash ^ std::bit_cast<Bits>(coord)) * kFnvPrime;
+}
+
+template <SceneCoord T>
+std::uint64_t hashTriangle(std::uint64_t hash, const Triangle<T> &tr)
+{
+  for (std::size_t k = 0; k < 3; ++k)
+  {
+    hash = hashCoord(hash, tr[k].x);
+    hash = hashCoord(hash, tr[k].y);
+    hash = hashCoord(hash, tr[k].z);
+  }
+
+  return hash;
+}
+
+template <std::floating_point T, SceneCoord U>
+std::vector<Triangle<T>> convertScene(std::string_view data, bool isVerify)
+{
+  SceneView<U> view{data};
+  if (isVerify && !view.verify())
+    throw std::runtime_error("Scene checksum mismatch");
+
+  auto convert = [](const Vec3<U> &vec) {
+    return Vec3<T>{static_cast<T>(vec.x), static_cast<T>(vec.y), static_cast<T>(vec.z)};
+  };
+
+  std::vector<Triangle<T>> res{};
+  res.reserve(view.size());
+  for (auto tr : view)
+    res.emplace_back(convert(tr[0]), convert(tr[1]), convert(tr[2]));
+
+  return res;
+}
+
+inline void checkEndian()
+{
+  if constexpr (std::endian::native != std::endian::little)
+    throw std::runtime_error("Binary scenes are supported on little-endian targets only");
+}
+
+} // namespace geom::io::detail
+
+namespace geom::io
+{
+
+inline std::uint64_t SceneHeader::dataSize() const
+{
+  return count * 9 * static_cast<std::uint64_t>(precision);
+}
+
+inline bool isScene(std::string_view data)
+{
+  return data.size() >= SceneHeader::kMagic.size() &&
+         std::equal(SceneHeader::kMagic.begin(), SceneHeader::kMagic.end(), data.begin());
+}
+
+inline SceneHeader readSceneHeader(std::string_view data)
+{
+  detail::checkEndian();
+  if (!isScene(data) || data.size() < sizeof(SceneHeader))
+    throw std::runtime_error("Not a binary triangle scene");
+
+  SceneHeader header{};
+  std::memcpy(&header, data.data(), sizeof(header));
+
+  if (header.version != SceneHeader::kVersion)
+    throw std::runtime_error("Unsupported scene version " + std::to_string(header.version));
+  if (header.precision != Precision::FLOAT && header.precision != Precision::DOUBLE)
+    throw std::runtime_error("Unsupported scene precision " +
+                             std::to_string(static_cast<std::uint32_t>(header.precision)));
+
+  auto available = data.size() - sizeof(SceneHeader);
+  if (header.count > available / 9 / static_cast<std::uint64_t>(header.precision))
+    throw std::runtime_error("Truncated scene: " + std::to_string(header.count) +
+                             " triangles announced");
+
+  return header;
+}
+
+template <std::floating_point T>
+std::vector<Triangle<T>> readScene(std::string_view data, bool isVerify)
+{
+  if (readSceneHeader(data).precision == Precision::DOUBLE)
+    return detail::convertScene<T, double>(data, isVerify);
+
+  return detail::convertScene<T, float>(data, isVerify);
+}
+
+template <SceneCoord T, std::ranges::forward_range Range>
+void writeScene(std::ostream &ost, const Range &triangles, bool hasChecksum)
+{
+  detail::checkEndian();
+
+  SceneHeader header{};
+  header.precision = static_cast<Precision>(sizeof(T));
+  header.flags = hasChecksum ? SceneHeader::kHasChecksum : 0;
+
+  std::uint64_t hash = detail::kFnvOffset;
+  for (const Triangle<T> &tr : triangles)
+  {
+    if (hasChecksum)
+      hash = detail::hashTriangle(hash, tr);
+    ++header.count;
+  }
+  header.checksum = hasChecksum ? hash : 0;
+
+  ost.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  for (const Triangle<T> &tr : triangles)
+  {
+    std::array<T, 9> coords{tr[0].x, tr[0].y, tr[0].z, tr[1].x, tr[1].y,
+                            tr[1].z, tr[2].x, tr[2].y, tr[2].z};
+    ost.write(reinterpret_cast<const char *>(coords.data()), sizeof(coords));
+  }
+}
+
+//============================================================================================
+//                                   SceneView definitions
+//============================================================================================
+
+template <SceneCoord T>
+SceneView<T>::SceneView(std::string_view data)
+  : header_(readSceneHeader(data)), coords_(data.data() + sizeof(SceneHeader))
+{
+  if (header_.precision != static_cast<Precision>(sizeof(T)))
+    throw std::runtime_error("Scene precision doesn't match requested type");
+}
+
+template <SceneCoord T>
+std::size_t SceneView<T>::size() const
+{
+  return static_cast<std::size_t>(header_.count);
+}
+
+template <SceneCoord T>
+const SceneHeader &SceneView<T>::header() const
+{
+  return header_;
+}
+
+template <SceneCoord T>
+Triangle<T> SceneView<T>::operator[](std::size_t idx) const
+{
+  auto base = idx * 9;
+  return {{coord(base + 0), coord(base + 1), coord(base + 2)},
+          {coord(base + 3), coord(base + 4), coord(base + 5)},
+          {coord(base + 6), coord(base + 7), coord(base + 8)}};
+}
+
+template <SceneCoord T>
+bool SceneView<T>::verify() const
+{
+  if (0 == (header_.flags & SceneHeader::kHasChecksum))
+    return true;
+
+  std::uint64_t hash = detail::kFnvOffset;
+  for (std::size_t i = 0, end = size() * 9; i < end; ++i)
+    hash = detail::hashCoord(hash, coord(i));
+
+  return hash == header_.checksum;
+}
+
+template <SceneCoord T>
+auto SceneView<T>::begin() const -> ConstIterator
+{
+  return ConstIterator{this, 0};
+}
+
+template <SceneCoord T>
+auto SceneView<T>::end() const -> ConstIterator
+{
+  return ConstIterator{this, size()};
+}
+
+/**
+ * @brief Load idx-th coordinate, mapped data needn't be aligned for T
+ */
+template <SceneCoord T>
+T SceneView<T>::coord(std::size_t idx) const
+{
+  T res{};
+  std::memcpy(&res, coords_ + idx * sizeof(T), sizeof(T));
+  return res;
+}
+
+template <SceneCoord T>
+SceneView<T>::ConstIterator::ConstIterator(const SceneView *view, std::size_t idx)
+  : view_(view), idx_(idx)
+{}
+
+template <SceneCoord T>
+auto SceneView<T>::ConstIterator::operator++() -> ConstIterator &
+{
+  ++idx_;
+  return *this;
+}
+
+template <SceneCoord T>
+auto SceneView<T>::ConstIterator::operator++(int) -> ConstIterator
+{
+  auto tmp = *this;
+  ++idx_;
+  return tmp;
+}
+
+template <SceneCoord T>
+auto SceneView<T>::ConstIterator::operator*() const -> reference
+{
+  return (*view_)[idx_];
+}
+
+} // namespace geom::io
+
+#endif // __INCLUDE_IO_SCENE_HH__
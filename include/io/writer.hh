@@ -0,0 +1,100 @@
+#ifndef __INCLUDE_IO_WRITER_HH__
+#define __INCLUDE_IO_WRITER_HH__
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <ostream>
+#include <stdexcept>
+#include <vector>
+
+namespace geom::io
+{
+
+/**
+ * @class IndexWriter
+ * @brief Writer of indices, one per line, which touches the stream only with large blocks
+ * @details
+ * Indices are formatted by std::to_chars into an internal buffer, which is written out
+ * when it is full. Unlike printing with std::endl nothing is flushed per line, so output
+ * of millions of indices costs a few writes.
+ */
+class IndexWriter final
+{
+public:
+  static constexpr std::size_t kDefaultBlockSize = 1 << 16;
+
+private:
+  /* Longest line is 20 digits of 64-bit index and newline */
+  static constexpr std::size_t kMaxLineSize = 21;
+
+  std::ostream *ost_{};
+  std::vector<char> buffer_{};
+  std::size_t used_{};
+
+  void writeBlock();
+
+public:
+  explicit IndexWriter(std::ostream &ost, std::size_t blockSize = kDefaultBlockSize);
+
+  IndexWriter(const IndexWriter &) = delete;
+  IndexWriter &operator=(const IndexWriter &) = delete;
+  IndexWriter(IndexWriter &&) = delete;
+  IndexWriter &operator=(IndexWriter &&) = delete;
+
+  ~IndexWriter();
+
+  void write(std::size_t index);
+  void flush();
+};
+
+inline IndexWriter::IndexWriter(std::ostream &ost, std::size_t blockSize)
+  : ost_(&ost), buffer_(std::max(blockSize, kMaxLineSize))
+{}
+
+/**
+ * @brief Write out buffered indices, errors are ignored here, call flush() to detect them
+ */
+inline IndexWriter::~IndexWriter()
+{
+  try
+  {
+    flush();
+  }
+  catch (...)
+  {}
+}
+
+inline void IndexWriter::write(std::size_t index)
+{
+  if (buffer_.size() - used_ < kMaxLineSize)
+    writeBlock();
+
+  auto *begin = buffer_.data() + used_;
+  auto *end = std::to_chars(begin, buffer_.data() + buffer_.size(), index).ptr;
+  *end++ = '\n';
+  used_ += static_cast<std::size_t>(end - begin);
+}
+
+/**
+ * @brief Write out buffered indices and flush the stream
+ * @throw std::runtime_error if stream failed
+ */
+inline void IndexWriter::flush()
+{
+  writeBlock();
+  ost_->flush();
+
+  if (!*ost_)
+    throw std::runtime_error("IndexWriter: can't write output");
+}
+
+inline void IndexWriter::writeBlock()
+{
+  ost_->write(buffer_.data(), static_cast<std::streamsize>(used_));
+  used_ = 0;
+}
+
+} // namespace geom::io
+
+#endif // __INCLUDE_IO_WRITER_HH__
@@ -53,7 +53,7 @@ public:
 
   private:
     const Container *cont_;
-    std::vector<Index>::const_iterator curIdxIt_{};
+    typename Node<T>::IndexConstIterator curIdxIt_{};
 
   public:
     ConstIterator(const Container *cont, bool isEnd = false);
@@ -105,13 +105,13 @@ typename Container<T>::ConstIterator Container<T>::end() const &
 template <std::floating_point T>
 typename Node<T>::IndexConstIterator Container<T>::indexBegin() const &
 {
-  return node_->indicies.begin();
+  return tree_->indicies_.data() + node_->idxOffset;
 }
 
 template <std::floating_point T>
 typename Node<T>::IndexConstIterator Container<T>::indexEnd() const &
 {
-  return node_->indicies.end();
+  return tree_->indicies_.data() + node_->idxOffset + node_->idxCount;
 }
 
 template <std::floating_point T>
@@ -141,13 +141,13 @@ const Triangle<T> &Container<T>::triangleByIndex(Index index) const &
 template <std::floating_point T>
 Container<T> Container<T>::left() const
 {
-  return Container<T>{tree_, node_->left.get()};
+  return Container<T>{tree_, node_->isLeaf() ? nullptr : tree_->nodeById(node_->left())};
 }
 
 template <std::floating_point T>
 Container<T> Container<T>::right() const
 {
-  return Container<T>{tree_, node_->right.get()};
+  return Container<T>{tree_, node_->isLeaf() ? nullptr : tree_->nodeById(node_->right())};
 }
 
 template <std::floating_point T>
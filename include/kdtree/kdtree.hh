@@ -1,38 +1,123 @@
 #ifndef __INCLUDE_KDTREE_KDTREE_HH__
 #define __INCLUDE_KDTREE_KDTREE_HH__
 
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <cassert>
+#include <cmath>
+#include <cstring>
 #include <functional>
 #include <initializer_list>
+#include <iterator>
+#include <limits>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <numeric>
+#include <optional>
 #include <queue>
 #include <stack>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
 #include <vector>
 
+#include "intersection/batch.hh"
+#include "intersection/intersection.hh"
 #include "primitives/primitives.hh"
 
 #include "container.hh"
 #include "node.hh"
+#include "pool.hh"
+#include "serialize.hh"
+#include "sink.hh"
+#include "split.hh"
+#include "stats.hh"
+#include "storage.hh"
 
 namespace geom::kdtree
 {
 
+/**
+ * @brief Minimal number of node's indices for its subtree to be built by a separate task
+ */
+constexpr std::uint32_t kParallelBuildGrain = 1 << 12;
+
+/**
+ * @brief Tasks are spawned up to log2(thread count) + kParallelBuildDepth levels of the tree
+ */
+constexpr std::size_t kParallelBuildDepth = 4;
+
+/**
+ * @brief Maximal number of node's triangles processed by one task of self-intersection query
+ */
+constexpr std::uint32_t kQueryGrain = 32;
+
+/**
+ * @brief Number of item's triangles tested at once with a triangle of node's subtree
+ */
+constexpr std::size_t kQueryBatchWidth = 8;
+
+/**
+ * @brief Query between two trees is split until there are this many items per thread
+ */
+constexpr std::size_t kCrossItemsPerThread = 16;
+
+/**
+ * @brief Maximal number of rounds of splitting query between two trees
+ */
+constexpr std::size_t kCrossSplitRounds = 16;
+
+/**
+ * @brief Auto tuning builds trees over a window of the scene with about this many triangles
+ */
+constexpr std::size_t kTuneSampleSize = 4096;
+
+/**
+ * @brief Node capacities tried by auto tuning
+ */
+constexpr std::array<std::size_t, 6> kTuneCapacities{1, 2, 4, 8, 16, 32};
+
+/**
+ * @brief Costs of operations in the cost model of auto tuning relative to exact test of a pair
+ */
+constexpr double kTuneVisitCost = 0.5;     // visit of a node by build or query
+constexpr double kTuneBoxCost = 0.1;       // test of triangle's box with query item's box
+constexpr double kTuneBatchCost = 1;       // batch filter of a triangle with a batch of triangles
+constexpr double kTunePartitionCost = 0.1; // classification of a triangle by a separator
+
 template <std::floating_point T>
 class KdTree final
 {
 private:
-  std::unique_ptr<Node<T>> root_{};
-  std::vector<Triangle<T>> triangles_{};
+  using NodeBuffer = std::pmr::vector<Node<T>>;
+
+  Storage<Node<T>> nodes_{};     // root is nodes_[kRootId]
+  Storage<Index> indicies_{};    // triangles' indices of all nodes, see Node
+  Storage<Triangle<T>> triangles_{};
+  Storage<PreparedTriangle<T>> prepared_{}; // narrow phase data of triangles_
   std::size_t nodeCapacity_{1};
+  SplitPolicy splitPolicy_{SplitPolicy::MIDDLE};
+  std::size_t threadCount_{1};
+  std::shared_ptr<ThreadPool> pool_{}; // shared by copies, null for sequential tree
+  T threshold_{ThresComp<T>::getThreshold()};
+  bool isMixedPrecision_{false};
+  bool isAutoTune_{false};
+  TuneProfile tuneProfile_{};
 
 public:
   KdTree(std::initializer_list<Triangle<T>> il);
-  KdTree(const KdTree &tree);
+  template <std::input_iterator It>
+  KdTree(It begin, It end);
+  explicit KdTree(const TriangleSoA<T> &soa);
+  KdTree(const KdTree &tree) = default;
   KdTree(KdTree &&tree) = default;
   KdTree() = default;
-  ~KdTree();
+  explicit KdTree(std::pmr::memory_resource *resource);
+  ~KdTree() = default;
 
-  KdTree &operator=(const KdTree &tree);
+  KdTree &operator=(const KdTree &tree) = default;
   KdTree &operator=(KdTree &&tree) = default;
 
   class ConstIterator;
@@ -48,13 +133,52 @@ public:
 
   // Modifiers
   void insert(const Triangle<T> &tr);
+  template <std::input_iterator It>
+  void build(It begin, It end);
+  void build(const TriangleSoA<T> &soa);
+  void finalize();
   void clear();
   void setNodeCapacity(std::size_t newCap);
+  void setSplitPolicy(SplitPolicy policy);
+  void setThreadCount(std::size_t nThreads);
+  void setThreshold(T thres);
+  void setMixedPrecision(bool isMixed);
+  void setAutoTune(bool isAuto);
 
   // Capacity
   bool empty() const;
   std::size_t size() const;
   std::size_t nodeCapacity() const;
+  std::size_t nodeCount() const;
+  SplitPolicy splitPolicy() const;
+  std::size_t threadCount() const;
+  T threshold() const;
+  bool isMixedPrecision() const;
+  bool isAutoTune() const;
+  std::pmr::memory_resource *memoryResource() const;
+
+  // Quality
+  T sahCost() const;
+  TreeStats<T> stats() const;
+  const TuneProfile &tuneProfile() const &;
+
+  // Persistence
+  void save(std::ostream &ost) const;
+  static KdTree load(std::string_view data, std::shared_ptr<const void> holder = {},
+                     bool isChecked = true);
+
+  // Queries
+  std::vector<Index> findIntersectingIndices() const;
+  void findIntersectingIndices(std::vector<Index> &indices) const;
+  void findIntersectingIndices(std::vector<bool> &bitmap) const;
+  void findIntersectingIndices(IndexBitmap &bitmap) const;
+  void findIntersectingPairs(std::vector<IndexPair> &pairs) const;
+  void findIntersectingPairs(PairBuffer &pairs) const;
+  template <std::invocable<Index, Index> Callback>
+  void findIntersectingPairs(Callback callback) const;
+  void findIntersectingPairs(const KdTree &other, std::vector<IndexPair> &pairs) const;
+  template <std::invocable<Index, Index> Callback>
+  void findIntersectingPairs(const KdTree &other, Callback callback) const;
 
   const Triangle<T> &triangleByIndex(Index index) const &;
 
@@ -66,13 +190,83 @@ public:
                        std::function<bool(T, T)> comparator);
 
 private:
+  friend class Container<T>;
+
+  const Node<T> *root() const;
+  const Node<T> *nodeById(NodeId id) const;
+  static NodeId pushChildren(NodeBuffer &nodes, const Node<T> &left, const Node<T> &right);
+  static void appendSubtree(NodeBuffer &nodes, NodeId parent, const NodeBuffer &descendants);
+  void pushIndex(NodeId id, Index index);
+  Index pushTriangle(const Triangle<T> &tr);
+  static std::uint32_t toOffset(std::size_t size);
+  template <typename U>
+  static Storage<U> loadSection(std::string_view data, std::uint64_t offset, std::uint64_t count,
+                                const std::shared_ptr<const void> &holder);
+  void checkLoaded() const;
+
   void expandingInsert(const Triangle<T> &tr);
   void tryExpandRight(Axis axis, const BoundBox<T> &trianBB);
   void tryExpandLeft(Axis axis, const BoundBox<T> &trianBB);
 
-  void nonExpandingInsert(Node<T> *node, const Triangle<T> &tr, Index index, bool isSubdiv = false);
-  bool isDivisable(const Node<T> *node);
-  void subdivide(Node<T> *node);
+  void nonExpandingInsert(NodeId id, const Triangle<T> &tr, Index index);
+  void buildPrepared();
+  bool isDivisable(const Node<T> &node) const;
+  std::size_t maxBuildDepth() const;
+  void subdivide(NodeId id);
+  std::optional<std::pair<Node<T>, Node<T>>> splitNode(Node<T> &node);
+  void buildDescendants(NodeBuffer &nodes, NodeId id, std::size_t depth);
+  NodeBuffer buildParallel(ThreadPool &pool, Node<T> &node, std::size_t depth);
+  Split<T> findSplit(const Node<T> &node) const;
+
+  void tune(const BoundBox<T> &sceneBB);
+  std::vector<Triangle<T>> tuneSample(const BoundBox<T> &sceneBB) const;
+  double estimateCost() const;
+
+  /**
+   * @brief Part of self-intersection query: node's triangles at [first, last) of index array
+   */
+  struct QueryItem final
+  {
+    NodeId id;
+    std::uint32_t first;
+    std::uint32_t last;
+  };
+
+  std::vector<QueryItem> splitQuery() const;
+  template <typename Buffer, typename Add>
+  std::vector<Buffer> collectIntersections(Add add, const Buffer &init = Buffer{}) const;
+  bool isIntersectPair(const Triangle<T> &tr1, const PreparedTriangle<T> &prep1,
+                       const Triangle<T> &tr2, const PreparedTriangle<T> &prep2) const;
+  using QueryBatch = TriangleBatch<T, kQueryBatchWidth>;
+  template <std::invocable<Index, Index> Report>
+  void intersectItem(const QueryItem &item, std::vector<NodeId> &stack,
+                     std::vector<QueryBatch> &batches, Report report) const;
+  static BoundBox<T> emptyBoundBox();
+
+  /**
+   * @brief Part of query between two trees: pairs of triangles of lhs and rhs nodes
+   * @details
+   * Node contributes only its own triangles if the flag is false and its whole subtree otherwise
+   */
+  struct CrossItem final
+  {
+    NodeId lhs;
+    NodeId rhs;
+    bool lhsSubtree;
+    bool rhsSubtree;
+  };
+
+  std::vector<CrossItem> splitCrossQuery(const KdTree &other) const;
+  bool splitCrossItem(const KdTree &other, const CrossItem &item,
+                      std::vector<CrossItem> &children) const;
+  template <std::invocable<Index, Index> Report>
+  void intersectCross(const KdTree &other, const CrossItem &item, std::vector<CrossItem> &stack,
+                      Report report) const;
+
+  template <typename Func>
+  static void forEachParallel(ThreadPool *pool, std::size_t size, std::size_t grain, Func func);
+  template <typename Query, typename Callback>
+  void reportByPiece(std::size_t nItems, Query query, Callback callback) const;
 
 public:
   struct ContainerPtr final
@@ -118,37 +312,40 @@ public:
 template <std::floating_point T>
 KdTree<T>::KdTree(std::initializer_list<Triangle<T>> il)
 {
-  for (const auto &tr : il)
-    insert(tr);
+  build(il.begin(), il.end());
 }
 
 template <std::floating_point T>
-KdTree<T>::KdTree(const KdTree<T> &tree)
+template <std::input_iterator It>
+KdTree<T>::KdTree(It begin, It end)
 {
-  // temporary solution
-  for (const auto &tr : tree.triangles_)
-    insert(tr);
+  build(begin, end);
 }
 
 template <std::floating_point T>
-KdTree<T>::~KdTree()
+KdTree<T>::KdTree(const TriangleSoA<T> &soa)
 {
-  clear();
+  build(soa);
 }
 
+/**
+ * @brief Make empty tree which allocates its nodes, indices and triangles from resource
+ * @details
+ * Resource may be e.g. std::pmr::monotonic_buffer_resource: arrays are then bump allocated in
+ * the resource's slabs and freed at once when it is released, deallocations by the tree itself
+ * are no-ops. Resource must outlive the tree and needn't be thread-safe, parallel build takes
+ * its temporary buffers from the default resource. Copies of the tree use the default resource.
+ */
 template <std::floating_point T>
-KdTree<T> &KdTree<T>::operator=(const KdTree<T> &tree)
-{
-  KdTree tmp{tree};
-  operator=(std::move(tmp));
-  return *this;
-}
+KdTree<T>::KdTree(std::pmr::memory_resource *resource)
+  : nodes_(resource), indicies_(resource), triangles_(resource), prepared_(resource)
+{}
 
 // ConstIterators
 template <std::floating_point T>
 typename KdTree<T>::ConstIterator KdTree<T>::cbegin() const &
 {
-  return ConstIterator{this, root_.get()};
+  return ConstIterator{this, root()};
 }
 
 template <std::floating_point T>
@@ -180,54 +377,231 @@ typename KdTree<T>::ConstIterator KdTree<T>::beginFrom(
 template <std::floating_point T>
 void KdTree<T>::insert(const Triangle<T> &tr)
 {
-  if (nullptr == root_)
+  if (nodes_.empty())
   {
-    root_ = std::unique_ptr<Node<T>>{new Node<T>{T{}, Axis::NONE, tr.boundBox(), {0}}};
-    triangles_.push_back(tr);
+    nodes_.push_back(Node<T>{tr.boundBox(threshold_)});
+    pushIndex(kRootId, pushTriangle(tr));
     return;
   }
 
-  if (!tr.belongsTo(root_->boundBox))
+  if (!tr.belongsTo(nodes_[kRootId].boundBox))
     expandingInsert(tr);
   else
+    nonExpandingInsert(kRootId, tr, pushTriangle(tr));
+}
+
+/**
+ * @brief Build the whole tree top-down from range of triangles
+ * @details
+ * Previous content of the tree is dropped. Bound box of the scene is computed once,
+ * so no expanding insertions happen, and every node is subdivided at most once
+ * while its triangles are being distributed between it and its children.
+ * Subdivision partitions node's index range in place, so the resulting index array is
+ * already packed and needs no finalize().
+ *
+ * If thread count is greater than 1, subtrees are built concurrently on a work-stealing pool.
+ * Each task builds its subtree into its own node buffer, buffers are appended to parent's one
+ * in the same order sequential build allocates nodes, so resulting tree is identical.
+ */
+template <std::floating_point T>
+template <std::input_iterator It>
+void KdTree<T>::build(It begin, It end)
+{
+  clear();
+  triangles_.assign(begin, end);
+  if (triangles_.empty())
+    return;
+
+  prepared_.resize(triangles_.size());
+
+  /* Mutable access to storage checks for borrowed data, so it is done once, not per element */
+  const auto *triangles = std::as_const(triangles_).data();
+  auto *prepared = prepared_.data();
+  forEachParallel(pool_.get(), triangles_.size(), kParallelBuildGrain,
+                  [triangles, prepared, thres = threshold_](auto first, auto last, auto) {
+                    for (auto i = first; i < last; ++i)
+                      prepared[i] = PreparedTriangle<T>{triangles[i], thres};
+                  });
+
+  buildPrepared();
+}
+
+/**
+ * @brief Build tree over triangles of soa, index of a triangle is its position in soa
+ * @details
+ * Narrow phase reads whole triangles, so tree keeps them in AoS layout: soa is gathered into it
+ * in parallel. Bound boxes are computed straight from coordinate streams of soa.
+ */
+template <std::floating_point T>
+void KdTree<T>::build(const TriangleSoA<T> &soa)
+{
+  clear();
+  if (soa.empty())
+    return;
+
+  triangles_.resize(soa.size());
+  prepared_.resize(soa.size());
+
+  auto *triangles = triangles_.data();
+  auto *prepared = prepared_.data();
+  forEachParallel(pool_.get(), soa.size(), kParallelBuildGrain,
+                  [triangles, prepared, &soa, thres = threshold_](auto first, auto last, auto) {
+                    std::array<const T *, 3> xs{soa.x(0), soa.x(1), soa.x(2)};
+                    std::array<const T *, 3> ys{soa.y(0), soa.y(1), soa.y(2)};
+                    std::array<const T *, 3> zs{soa.z(0), soa.z(1), soa.z(2)};
+
+                    for (auto i = first; i < last; ++i)
+                    {
+                      auto [minX, maxX] = std::minmax({xs[0][i], xs[1][i], xs[2][i]});
+                      auto [minY, maxY] = std::minmax({ys[0][i], ys[1][i], ys[2][i]});
+                      auto [minZ, maxZ] = std::minmax({zs[0][i], zs[1][i], zs[2][i]});
+
+                      triangles[i] = soa[i];
+                      prepared[i] = PreparedTriangle<T>{
+                        triangles[i], BoundBox<T>{minX - thres, maxX + thres, minY - thres,
+                                                   maxY + thres, minZ - thres, maxZ + thres},
+                        thres};
+                    }
+                  });
+
+  buildPrepared();
+}
+
+/**
+ * @brief Subdivide the tree over triangles_ and their prepared_ data, see build
+ */
+template <std::floating_point T>
+void KdTree<T>::buildPrepared()
+{
+  auto sceneBB = prepared_.front().boundBox;
+  for (const auto &prep : prepared_)
+    sceneBB.merge(prep.boundBox);
+
+  if (isAutoTune_)
+    tune(sceneBB);
+
+  auto size = toOffset(triangles_.size());
+  nodes_.push_back(Node<T>{sceneBB, T{}, kRootId, Axis::NONE, 0, size, size});
+  indicies_.resize(size);
+  std::iota(indicies_.begin(), indicies_.end(), Index{0});
+
+  if (!pool_)
   {
-    auto index = triangles_.size();
-    triangles_.push_back(tr);
-    nonExpandingInsert(root_.get(), tr, index);
+    buildDescendants(nodes_.mut(), kRootId, 0);
+    return;
   }
+
+  pool_->enter([this] {
+    auto descendants = buildParallel(*pool_, nodes_[kRootId], 0);
+    appendSubtree(nodes_.mut(), kRootId, descendants);
+  });
 }
 
+/**
+ * @brief Pack index array dropping spare slots left by insertions
+ * @details Ranges of nodes are laid out in depth-first order
+ */
 template <std::floating_point T>
-void KdTree<T>::clear()
+void KdTree<T>::finalize()
 {
-  if (nullptr == root_)
+  if (indicies_.size() == triangles_.size())
     return;
 
-  std::stack<std::unique_ptr<Node<T>> *> stack{};
-  stack.push(&root_);
+  std::pmr::vector<Index> packed{indicies_.resource()};
+  packed.reserve(triangles_.size());
+
+  std::stack<NodeId> stack{};
+  stack.push(kRootId);
 
   while (!stack.empty())
   {
-    auto *curNode = stack.top();
-    auto *right = &curNode->get()->right;
-    auto *left = &curNode->get()->left;
+    auto &node = nodes_[stack.top()];
+    stack.pop();
 
-    if ((nullptr == *right) && (nullptr == *left))
-    {
-      curNode->reset();
-      stack.pop();
+    auto begin = indicies_.begin() + node.idxOffset;
+    node.idxOffset = toOffset(packed.size());
+    node.idxCapacity = node.idxCount;
+    packed.insert(packed.end(), begin, begin + node.idxCount);
+
+    if (node.isLeaf())
       continue;
-    }
 
-    stack.push(right);
-    stack.push(left);
+    stack.push(node.right());
+    stack.push(node.left());
   }
+
+  indicies_ = std::move(packed);
+}
+
+template <std::floating_point T>
+void KdTree<T>::clear()
+{
+  triangles_.clear();
+  prepared_.clear();
+  indicies_.clear();
+  nodes_.clear();
+  tuneProfile_ = TuneProfile{};
 }
 
 template <std::floating_point T>
 void KdTree<T>::setNodeCapacity(std::size_t newCap)
 {
   nodeCapacity_ = newCap;
+  isAutoTune_ = false;
+}
+
+template <std::floating_point T>
+void KdTree<T>::setSplitPolicy(SplitPolicy policy)
+{
+  splitPolicy_ = policy;
+}
+
+/**
+ * @brief Set number of threads used to build the tree, 1 means sequential build
+ * @details Threads are started here once and reused by every build and query of the tree
+ */
+template <std::floating_point T>
+void KdTree<T>::setThreadCount(std::size_t nThreads)
+{
+  nThreads = std::max<std::size_t>(nThreads, 1);
+  if (nThreads == threadCount_)
+    return;
+
+  threadCount_ = nThreads;
+  pool_ = (threadCount_ > 1) ? std::make_shared<ThreadPool>(threadCount_) : nullptr;
+}
+
+/**
+ * @brief Set threshold of comparisons used by the tree, ThresComp's default one initially
+ * @details
+ * Triangles are prepared with the threshold when they are added, so it should be set before
+ * filling the tree. Queries of trees with different thresholds may run concurrently.
+ * Cross queries use threshold of the tree they are called for.
+ */
+template <std::floating_point T>
+void KdTree<T>::setThreshold(T thres)
+{
+  threshold_ = thres;
+}
+
+/**
+ * @brief Make queries recheck borderline pairs in double, see isIntersectMixed
+ * @details Rechecks use ThresComp<double>'s threshold
+ */
+template <std::floating_point T>
+void KdTree<T>::setMixedPrecision(bool isMixed)
+{
+  isMixedPrecision_ = isMixed;
+}
+
+/**
+ * @brief Make build() pick node capacity for every scene, see tune()
+ * @details Setting node capacity explicitly turns auto tuning off
+ */
+template <std::floating_point T>
+void KdTree<T>::setAutoTune(bool isAuto)
+{
+  isAutoTune_ = isAuto;
 }
 
 // Capacity
@@ -249,6 +623,416 @@ std::size_t KdTree<T>::nodeCapacity() const
   return nodeCapacity_;
 }
 
+template <std::floating_point T>
+std::size_t KdTree<T>::nodeCount() const
+{
+  return nodes_.size();
+}
+
+template <std::floating_point T>
+SplitPolicy KdTree<T>::splitPolicy() const
+{
+  return splitPolicy_;
+}
+
+template <std::floating_point T>
+std::size_t KdTree<T>::threadCount() const
+{
+  return threadCount_;
+}
+
+template <std::floating_point T>
+T KdTree<T>::threshold() const
+{
+  return threshold_;
+}
+
+template <std::floating_point T>
+bool KdTree<T>::isMixedPrecision() const
+{
+  return isMixedPrecision_;
+}
+
+template <std::floating_point T>
+bool KdTree<T>::isAutoTune() const
+{
+  return isAutoTune_;
+}
+
+template <std::floating_point T>
+std::pmr::memory_resource *KdTree<T>::memoryResource() const
+{
+  return nodes_.resource();
+}
+
+// Quality
+template <std::floating_point T>
+T KdTree<T>::sahCost() const
+{
+  if (nodes_.empty())
+    return T{};
+
+  auto rootArea = nodes_[kRootId].boundBox.surfaceArea();
+  T cost{};
+
+  for (auto cont : *this)
+  {
+    auto nodeCost = kSahIntersectionCost<T> *
+                    static_cast<T>(std::distance(cont.indexBegin(), cont.indexEnd()));
+    if (Axis::NONE != cont.sepAxis())
+      nodeCost += kSahTraversalCost<T>;
+
+    cost += cont.boundBox().surfaceArea() / rootArea * nodeCost;
+  }
+
+  return cost;
+}
+
+/**
+ * @brief Make report of tree structure and quality
+ * @details Nodes are walked once without recursion, so it takes linear time at any depth
+ */
+template <std::floating_point T>
+TreeStats<T> KdTree<T>::stats() const
+{
+  TreeStats<T> res{};
+  res.nodeCount = nodes_.size();
+  res.triangleCount = triangles_.size();
+  res.nodeBytes = nodes_.size() * sizeof(Node<T>);
+  res.indexBytes = indicies_.size() * sizeof(Index);
+  res.triangleBytes = triangles_.size() * (sizeof(Triangle<T>) + sizeof(PreparedTriangle<T>));
+  res.spareIndexCount = indicies_.size();
+
+  if (nodes_.empty())
+    return res;
+
+  auto rootArea = nodes_[kRootId].boundBox.surfaceArea();
+  std::size_t depthSum = 0;
+  std::vector<std::pair<NodeId, std::size_t>> stack{{kRootId, 0}};
+  while (!stack.empty())
+  {
+    auto [id, depth] = stack.back();
+    stack.pop_back();
+
+    const auto &node = nodes_[id];
+    std::size_t size = node.idxCount;
+    res.spareIndexCount -= size;
+
+    auto nodeCost = kSahIntersectionCost<T> * static_cast<T>(size);
+    if (!node.isLeaf())
+      nodeCost += kSahTraversalCost<T>;
+    res.sahCost += node.boundBox.surfaceArea() / rootArea * nodeCost;
+
+    if (!node.isLeaf())
+    {
+      res.straddlingCount += size;
+      res.maxStraddlingCount = std::max(res.maxStraddlingCount, size);
+      stack.emplace_back(node.right(), depth + 1);
+      stack.emplace_back(node.left(), depth + 1);
+      continue;
+    }
+
+    ++res.leafCount;
+    depthSum += depth;
+    res.maxDepth = std::max(res.maxDepth, depth);
+    res.maxLeafSize = std::max(res.maxLeafSize, size);
+
+    if (res.depthHistogram.size() <= depth)
+      res.depthHistogram.resize(depth + 1);
+    ++res.depthHistogram[depth];
+
+    auto bucket = TreeStats<T>::occupancyBucket(size);
+    if (res.occupancyHistogram.size() <= bucket)
+      res.occupancyHistogram.resize(bucket + 1);
+    ++res.occupancyHistogram[bucket];
+  }
+
+  res.averageLeafDepth = static_cast<double>(depthSum) / static_cast<double>(res.leafCount);
+  return res;
+}
+
+/**
+ * @brief Get profile of the last auto tuning, it is empty if the tree wasn't built with it
+ */
+template <std::floating_point T>
+const TuneProfile &KdTree<T>::tuneProfile() const &
+{
+  return tuneProfile_;
+}
+
+// Persistence
+/**
+ * @brief Write tree to binary stream in the layout described by TreeFileHeader
+ * @details
+ * Thread count and mixed precision flag are run-time settings and aren't saved. Threshold is
+ * saved, prepared data of triangles depends on it.
+ */
+template <std::floating_point T>
+void KdTree<T>::save(std::ostream &ost) const
+{
+  TreeFileHeader header{};
+  header.coordSize = sizeof(T);
+  header.nodeSize = sizeof(Node<T>);
+  header.indexSize = sizeof(Index);
+  header.triangleSize = sizeof(Triangle<T>);
+  header.preparedSize = sizeof(PreparedTriangle<T>);
+  header.splitPolicy = static_cast<std::uint32_t>(splitPolicy_);
+  header.nodeCapacity = nodeCapacity_;
+  header.nodeCount = nodes_.size();
+  header.indexCount = indicies_.size();
+  header.triangleCount = triangles_.size();
+  static_assert(sizeof(T) <= sizeof(header.threshold));
+  std::memcpy(header.threshold.data(), &threshold_, sizeof(T));
+
+  std::uint64_t pos = 0;
+  auto writeAt = [&ost, &pos](std::uint64_t offset, const void *data, std::size_t size) {
+    static constexpr std::array<char, kTreeFileAlign> kZeros{};
+    for (; pos < offset; pos += kTreeFileAlign)
+    {
+      auto chunk = std::min<std::uint64_t>(offset - pos, kTreeFileAlign);
+      ost.write(kZeros.data(), static_cast<std::streamsize>(chunk));
+    }
+    pos = offset + size;
+    ost.write(static_cast<const char *>(data), static_cast<std::streamsize>(size));
+  };
+
+  auto offsets = header.sectionOffsets();
+  writeAt(0, &header, sizeof(header));
+  writeAt(offsets[0], nodes_.data(), nodes_.size() * sizeof(Node<T>));
+  writeAt(offsets[1], indicies_.data(), indicies_.size() * sizeof(Index));
+  writeAt(offsets[2], triangles_.data(), triangles_.size() * sizeof(Triangle<T>));
+  writeAt(offsets[3], prepared_.data(), prepared_.size() * sizeof(PreparedTriangle<T>));
+}
+
+/**
+ * @brief Make tree from data written by save()
+ * @details
+ * Arrays which are properly aligned in data, e.g. in a mapped file, are used in place and
+ * nothing is allocated per node. The tree becomes a regular one on its first modification.
+ *
+ * @param[in] data saved tree, must stay valid while tree uses it
+ * @param[in] holder object which keeps data valid, may be empty if caller guarantees it
+ * @param[in] isChecked whether to check that nodes and indices are consistent, so that
+ * queries stay in bounds even for a corrupted file. Takes linear time
+ * @throw std::runtime_error if data isn't a tree saved for T on compatible platform
+ */
+template <std::floating_point T>
+KdTree<T> KdTree<T>::load(std::string_view data, std::shared_ptr<const void> holder, bool isChecked)
+{
+  TreeFileHeader header{};
+  if (data.size() >= sizeof(header))
+    std::memcpy(&header, data.data(), sizeof(header));
+
+  if (data.size() < sizeof(header) || header.magic != TreeFileHeader::kMagic ||
+      header.version != TreeFileHeader::kVersion)
+    throw std::runtime_error("KdTree: data isn't a saved tree of supported version");
+
+  if (header.byteOrder != TreeFileHeader::kByteOrder || header.coordSize != sizeof(T) ||
+      header.nodeSize != sizeof(Node<T>) || header.indexSize != sizeof(Index) ||
+      header.triangleSize != sizeof(Triangle<T>) ||
+      header.preparedSize != sizeof(PreparedTriangle<T>))
+    throw std::runtime_error("KdTree: tree was saved for another type or platform");
+
+  /* Every element takes at least a byte, so this also keeps offsets from overflowing */
+  if (header.nodeCount > data.size() || header.indexCount > data.size() ||
+      header.triangleCount > data.size() || header.sectionOffsets()[4] > data.size())
+    throw std::runtime_error("KdTree: saved tree is truncated");
+
+  auto offsets = header.sectionOffsets();
+  KdTree tree{};
+  tree.nodeCapacity_ = header.nodeCapacity;
+  std::memcpy(&tree.threshold_, header.threshold.data(), sizeof(T));
+  tree.splitPolicy_ = SplitPolicy::SAH == static_cast<SplitPolicy>(header.splitPolicy)
+                        ? SplitPolicy::SAH
+                        : SplitPolicy::MIDDLE;
+  tree.nodes_ = loadSection<Node<T>>(data, offsets[0], header.nodeCount, holder);
+  tree.indicies_ = loadSection<Index>(data, offsets[1], header.indexCount, holder);
+  tree.triangles_ = loadSection<Triangle<T>>(data, offsets[2], header.triangleCount, holder);
+  tree.prepared_ = loadSection<PreparedTriangle<T>>(data, offsets[3], header.triangleCount, holder);
+
+  if (isChecked)
+    tree.checkLoaded();
+
+  return tree;
+}
+
+// Queries
+/**
+ * @brief Find all triangles which intersect at least one other triangle
+ * @return std::vector<Index> sorted indices of intersecting triangles
+ */
+template <std::floating_point T>
+std::vector<Index> KdTree<T>::findIntersectingIndices() const
+{
+  std::vector<Index> res{};
+  findIntersectingIndices(res);
+  return res;
+}
+
+/**
+ * @brief Append sorted indices of intersecting triangles to indices
+ */
+template <std::floating_point T>
+void KdTree<T>::findIntersectingIndices(std::vector<Index> &indices) const
+{
+  IndexBitmap found{};
+  findIntersectingIndices(found);
+  found.forEach([&indices](auto index) { indices.push_back(index); });
+}
+
+/**
+ * @brief Mark intersecting triangles in bitmap
+ * @details Bitmap is resized to size() if it is shorter, already set flags are kept
+ */
+template <std::floating_point T>
+void KdTree<T>::findIntersectingIndices(std::vector<bool> &bitmap) const
+{
+  if (bitmap.size() < triangles_.size())
+    bitmap.resize(triangles_.size());
+
+  IndexBitmap found{};
+  findIntersectingIndices(found);
+  found.forEach([&bitmap](auto index) { bitmap[index] = true; });
+}
+
+/**
+ * @brief Mark intersecting triangles in bitmap
+ * @details
+ * Bitmap grows to size() if it is shorter, already marked indices are kept. Every thread
+ * marks its own bitmap, they are merged word by word, so nothing is sorted or allocated per
+ * found pair.
+ */
+template <std::floating_point T>
+void KdTree<T>::findIntersectingIndices(IndexBitmap &bitmap) const
+{
+  if (bitmap.size() < triangles_.size())
+    bitmap.resize(triangles_.size());
+
+  auto buffers = collectIntersections<IndexBitmap>(
+    [](auto &buffer, auto lhs, auto rhs) {
+      buffer.set(lhs);
+      buffer.set(rhs);
+    },
+    IndexBitmap{triangles_.size()});
+
+  for (const auto &buffer : buffers)
+    bitmap.merge(buffer);
+}
+
+/**
+ * @brief Append all pairs of intersecting triangles to pairs in lexicographical order
+ */
+template <std::floating_point T>
+void KdTree<T>::findIntersectingPairs(std::vector<IndexPair> &pairs) const
+{
+  auto buffers = collectIntersections<std::vector<IndexPair>>(
+    [](auto &buffer, auto lhs, auto rhs) { buffer.push_back(std::minmax(lhs, rhs)); });
+
+  auto first = pairs.size();
+  for (const auto &buffer : buffers)
+    pairs.insert(pairs.end(), buffer.begin(), buffer.end());
+
+  std::sort(pairs.begin() + static_cast<std::ptrdiff_t>(first), pairs.end());
+}
+
+/**
+ * @brief Append all pairs of intersecting triangles to pairs in no particular order, lhs < rhs
+ * @details Pairs found by threads are joined without copying or sorting
+ */
+template <std::floating_point T>
+void KdTree<T>::findIntersectingPairs(PairBuffer &pairs) const
+{
+  auto buffers = collectIntersections<PairBuffer>(
+    [](auto &buffer, auto lhs, auto rhs) { buffer.push_back(std::minmax(lhs, rhs)); });
+
+  for (auto &buffer : buffers)
+    pairs.splice(std::move(buffer));
+}
+
+/**
+ * @brief Call callback(lhs, rhs) for every pair of intersecting triangles, lhs < rhs
+ * @details
+ * Pairs are reported in no particular order as soon as a piece of query is done, see
+ * reportByPiece, so only pairs of running pieces are kept in memory. Calls are serialized,
+ * so callback needn't be thread safe even if query runs on several threads.
+ */
+template <std::floating_point T>
+template <std::invocable<Index, Index> Callback>
+void KdTree<T>::findIntersectingPairs(Callback callback) const
+{
+  auto items = splitQuery();
+  reportByPiece(
+    items.size(),
+    [this, &items](auto first, auto last, auto report) {
+      std::vector<NodeId> stack{};
+      std::vector<QueryBatch> batches{};
+      for (auto i = first; i < last; ++i)
+        intersectItem(items[i], stack, batches, [&report](auto lhs, auto rhs) {
+          auto [min, max] = std::minmax(lhs, rhs);
+          report(min, max);
+        });
+    },
+    callback);
+}
+
+/**
+ * @brief Find all pairs of intersecting triangles from this and other trees
+ * @details
+ * Both trees are descended together, so a pair of nodes whose cells are apart is skipped with
+ * all their descendants. Self-intersections inside either tree are not reported. Query runs on
+ * threadCount() threads of this tree.
+ *
+ * @param[in] other tree to check against
+ * @param[out] pairs pairs (index in this tree, index in other tree) appended in
+ * lexicographical order
+ */
+template <std::floating_point T>
+void KdTree<T>::findIntersectingPairs(const KdTree &other, std::vector<IndexPair> &pairs) const
+{
+  if (nodes_.empty() || other.nodes_.empty())
+    return;
+
+  auto items = splitCrossQuery(other);
+  auto *pool = (items.size() > 1) ? pool_.get() : nullptr;
+  std::vector<std::vector<IndexPair>> buffers(pool ? pool->size() : 1);
+  forEachParallel(pool, items.size(), 1, [&](auto first, auto last, auto thread) {
+    auto &buffer = buffers[thread];
+    auto report = [&buffer](auto lhs, auto rhs) { buffer.emplace_back(lhs, rhs); };
+    std::vector<CrossItem> stack{};
+    for (auto i = first; i < last; ++i)
+      intersectCross(other, items[i], stack, report);
+  });
+
+  auto firstNew = pairs.size();
+  for (const auto &buffer : buffers)
+    pairs.insert(pairs.end(), buffer.begin(), buffer.end());
+
+  std::sort(pairs.begin() + static_cast<std::ptrdiff_t>(firstNew), pairs.end());
+}
+
+/**
+ * @brief Call callback(lhs, rhs) for every pair of intersecting triangles from this and other
+ * trees, lhs is index in this tree
+ * @details Pairs are reported in no particular order by serialized calls, see reportByPiece
+ */
+template <std::floating_point T>
+template <std::invocable<Index, Index> Callback>
+void KdTree<T>::findIntersectingPairs(const KdTree &other, Callback callback) const
+{
+  if (nodes_.empty() || other.nodes_.empty())
+    return;
+
+  auto items = splitCrossQuery(other);
+  reportByPiece(
+    items.size(),
+    [this, &other, &items](auto first, auto last, auto report) {
+      std::vector<CrossItem> stack{};
+      for (auto i = first; i < last; ++i)
+        intersectCross(other, items[i], stack, report);
+    },
+    callback);
+}
+
 template <std::floating_point T>
 const Triangle<T> &KdTree<T>::triangleByIndex(Index index) const &
 {
@@ -259,8 +1043,8 @@ template <std::floating_point T>
 void KdTree<T>::dumpRecursive(std::ostream &ost) const
 {
   ost << "digraph kdtree {" << std::endl;
-  if (root_)
-    root_->dumpRecursive(ost);
+  for (std::size_t id = 0; id < nodes_.size(); ++id)
+    nodes_[id].dump(ost, static_cast<NodeId>(id), indicies_.data());
   ost << "}" << std::endl;
 }
 
@@ -289,11 +1073,174 @@ bool KdTree<T>::isOnSide(Axis axis, T separator, const Triangle<T> &tr,
 }
 
 template <std::floating_point T>
-void KdTree<T>::expandingInsert(const Triangle<T> &tr)
+const Node<T> *KdTree<T>::root() const
+{
+  return nodes_.empty() ? nullptr : nodes_.data();
+}
+
+template <std::floating_point T>
+const Node<T> *KdTree<T>::nodeById(NodeId id) const
+{
+  return &nodes_[id];
+}
+
+/**
+ * @brief Append pair of siblings to node array
+ *
+ * @return NodeId offset of left node
+ */
+template <std::floating_point T>
+NodeId KdTree<T>::pushChildren(NodeBuffer &nodes, const Node<T> &left, const Node<T> &right)
+{
+  auto id = toOffset(nodes.size());
+  toOffset(nodes.size() + 2);
+
+  nodes.push_back(left);
+  nodes.push_back(right);
+  return id;
+}
+
+/**
+ * @brief Append descendants of node built in separate buffer
+ * @details
+ * Offsets of children in descendants' buffer are relative to its beginning, buffer's first
+ * pair of nodes is children of parent
+ */
+template <std::floating_point T>
+void KdTree<T>::appendSubtree(NodeBuffer &nodes, NodeId parent, const NodeBuffer &descendants)
+{
+  if (descendants.empty())
+    return;
+
+  auto base = toOffset(nodes.size());
+  toOffset(nodes.size() + descendants.size());
+
+  nodes[parent].children += base;
+  for (auto node : descendants)
+  {
+    if (!node.isLeaf())
+      node.children += base;
+    nodes.push_back(node);
+  }
+}
+
+/**
+ * @brief Append index to node's range
+ * @details
+ * If range has no spare slots it grows twice: in place when it is the tail of index array,
+ * otherwise it is moved to the tail and its old slots stay unused until finalize()
+ */
+template <std::floating_point T>
+void KdTree<T>::pushIndex(NodeId id, Index index)
+{
+  auto &node = nodes_[id];
+  if (node.idxCount == node.idxCapacity)
+  {
+    std::size_t newCap = std::max<std::size_t>(2 * std::size_t{node.idxCapacity}, 1);
+    std::size_t offset = node.idxOffset;
+
+    if (offset + node.idxCapacity != indicies_.size())
+    {
+      offset = indicies_.size();
+      indicies_.resize(toOffset(offset + newCap));
+      std::copy_n(indicies_.data() + node.idxOffset, node.idxCount, indicies_.data() + offset);
+    }
+    else
+      indicies_.resize(toOffset(offset + newCap));
+
+    node.idxOffset = toOffset(offset);
+    node.idxCapacity = toOffset(newCap);
+  }
+
+  indicies_[node.idxOffset + node.idxCount++] = index;
+}
+
+template <std::floating_point T>
+Index KdTree<T>::pushTriangle(const Triangle<T> &tr)
 {
-  auto trianBB = tr.boundBox();
-  auto index = triangles_.size();
   triangles_.push_back(tr);
+  prepared_.emplace_back(tr, threshold_);
+  return triangles_.size() - 1;
+}
+
+template <std::floating_point T>
+std::uint32_t KdTree<T>::toOffset(std::size_t size)
+{
+  if (size > std::numeric_limits<std::uint32_t>::max())
+    throw std::length_error("KdTree: too many nodes or indices for 32-bit offsets");
+
+  return static_cast<std::uint32_t>(size);
+}
+
+/**
+ * @brief Borrow count elements of type U at offset of data or copy them if they are misaligned
+ */
+template <std::floating_point T>
+template <typename U>
+Storage<U> KdTree<T>::loadSection(std::string_view data, std::uint64_t offset, std::uint64_t count,
+                                  const std::shared_ptr<const void> &holder)
+{
+  const auto *ptr = data.data() + offset;
+  std::size_t size = count;
+  if (reinterpret_cast<std::uintptr_t>(ptr) % alignof(U) == 0)
+    return Storage<U>::borrow(reinterpret_cast<const U *>(ptr), size, holder);
+
+  Storage<U> res{};
+  res.resize(size);
+  std::memcpy(res.data(), ptr, size * sizeof(U));
+  return res;
+}
+
+/**
+ * @brief Check that loaded nodes form a tree and their index ranges and indices are in bounds
+ */
+template <std::floating_point T>
+void KdTree<T>::checkLoaded() const
+{
+  auto fail = [] { throw std::runtime_error("KdTree: saved tree is corrupted"); };
+
+  if (nodes_.empty() != triangles_.empty())
+    fail();
+
+  std::vector<bool> isVisited(nodes_.size());
+  std::vector<NodeId> stack{};
+  if (!nodes_.empty())
+    stack.push_back(kRootId);
+
+  while (!stack.empty())
+  {
+    auto id = stack.back();
+    stack.pop_back();
+    if (isVisited[id])
+      fail();
+    isVisited[id] = true;
+
+    const auto &node = nodes_[id];
+    if (node.idxCount > node.idxCapacity ||
+        std::uint64_t{node.idxOffset} + node.idxCapacity > indicies_.size())
+      fail();
+
+    if (node.isLeaf())
+      continue;
+
+    if (std::uint64_t{node.children} + 1 >= nodes_.size() ||
+        (node.sepAxis != Axis::X && node.sepAxis != Axis::Y && node.sepAxis != Axis::Z))
+      fail();
+
+    stack.push_back(node.right());
+    stack.push_back(node.left());
+  }
+
+  if (std::any_of(indicies_.begin(), indicies_.end(),
+                  [size = triangles_.size()](auto index) { return index >= size; }))
+    fail();
+}
+
+template <std::floating_point T>
+void KdTree<T>::expandingInsert(const Triangle<T> &tr)
+{
+  auto trianBB = tr.boundBox(threshold_);
+  auto index = pushTriangle(tr);
 
   for (auto axis : {Axis::X, Axis::Y, Axis::Z})
     tryExpandRight(axis, trianBB);
@@ -301,13 +1248,13 @@ void KdTree<T>::expandingInsert(const Triangle<T> &tr)
   for (auto axis : {Axis::X, Axis::Y, Axis::Z})
     tryExpandLeft(axis, trianBB);
 
-  root_->indicies.push_back(index);
+  pushIndex(kRootId, index);
 }
 
 template <std::floating_point T>
 void KdTree<T>::tryExpandRight(Axis axis, const BoundBox<T> &trianBB)
 {
-  const auto &rootBB = root_->boundBox;
+  auto rootBB = nodes_[kRootId].boundBox;
   if (trianBB.max(axis) <= rootBB.max(axis))
     return;
 
@@ -318,19 +1265,16 @@ void KdTree<T>::tryExpandRight(Axis axis, const BoundBox<T> &trianBB)
   auto newRootBB = rootBB;
   newRootBB.max(axis) = newRightBB.max(axis);
 
-  std::unique_ptr<Node<T>> newRight{new Node<T>{T{}, Axis::NONE, newRightBB}};
-  std::unique_ptr<Node<T>> newRoot{new Node<T>{rootBB.max(axis), axis, newRootBB}};
-
-  newRoot->right = std::move(newRight);
-  newRoot->left = std::move(root_);
-
-  root_ = std::move(newRoot);
+  /* Root always stays at kRootId, so old root is moved to the new left child */
+  auto oldRoot = nodes_[kRootId];
+  auto children = pushChildren(nodes_.mut(), oldRoot, Node<T>{newRightBB});
+  nodes_[kRootId] = Node<T>{newRootBB, rootBB.max(axis), children, axis};
 }
 
 template <std::floating_point T>
 void KdTree<T>::tryExpandLeft(Axis axis, const BoundBox<T> &trianBB)
 {
-  const auto &rootBB = root_->boundBox;
+  auto rootBB = nodes_[kRootId].boundBox;
   if (trianBB.min(axis) >= rootBB.min(axis))
     return;
 
@@ -341,59 +1285,716 @@ void KdTree<T>::tryExpandLeft(Axis axis, const BoundBox<T> &trianBB)
   BoundBox<T> newRootBB = rootBB;
   newRootBB.min(axis) = newLeftBB.min(axis);
 
-  std::unique_ptr<Node<T>> newLeft{new Node<T>{T{}, Axis::NONE, newLeftBB}};
-  std::unique_ptr<Node<T>> newRoot{new Node<T>{rootBB.min(axis), axis, newRootBB}};
+  /* Root always stays at kRootId, so old root is moved to the new right child */
+  auto oldRoot = nodes_[kRootId];
+  auto children = pushChildren(nodes_.mut(), Node<T>{newLeftBB}, oldRoot);
+  nodes_[kRootId] = Node<T>{newRootBB, rootBB.min(axis), children, axis};
+}
 
-  newRoot->left = std::move(newLeft);
-  newRoot->right = std::move(root_);
+template <std::floating_point T>
+void KdTree<T>::nonExpandingInsert(NodeId id, const Triangle<T> &tr, Index index)
+{
+  auto curId = id;
+  while (true)
+  {
+    const auto &curNode = nodes_[curId];
+    if (isOnPosSide(curNode.sepAxis, curNode.separator, tr))
+      curId = curNode.right();
+    else if (isOnNegSide(curNode.sepAxis, curNode.separator, tr))
+      curId = curNode.left();
+    else
+      break;
+  }
 
-  root_ = std::move(newRoot);
+  pushIndex(curId, index);
+  if (isDivisable(nodes_[curId]))
+    subdivide(curId);
 }
 
 template <std::floating_point T>
-void KdTree<T>::nonExpandingInsert(Node<T> *node, const Triangle<T> &tr, Index index, bool isSubdiv)
+bool KdTree<T>::isDivisable(const Node<T> &node) const
 {
-  auto curNode = node;
-  while (true)
+  return (node.idxCount > nodeCapacity_) && (node.sepAxis == Axis::NONE);
+}
+
+/**
+ * @brief Depth limit for top-down build: \f$ 8 + 1.3 \cdot \log_2 N \f$
+ * @details Keeps build time O(N log N) when triangles can't be separated (e.g. duplicates)
+ */
+template <std::floating_point T>
+std::size_t KdTree<T>::maxBuildDepth() const
+{
+  auto size = static_cast<double>(std::max<std::size_t>(triangles_.size(), 1));
+  return 8 + static_cast<std::size_t>(1.3 * std::log2(size));
+}
+
+/**
+ * @brief Pick node capacity for the scene being built
+ * @details
+ * A tree with every capacity of kTuneCapacities is built over a window of the scene which holds
+ * about kTuneSampleSize triangles at scene's own density, so leaves of the window's tree look like
+ * leaves of the whole tree. The capacity with the least estimated cost is chosen, smaller
+ * capacity wins ties. Estimate is made by a model rather than by timing, so the same scene always
+ * gets the same tree. Probe trees use the tree's threshold, so their boxes overlap like the
+ * boxes of the tree being built.
+ *
+ * @param[in] sceneBB bound box of all triangles
+ */
+template <std::floating_point T>
+void KdTree<T>::tune(const BoundBox<T> &sceneBB)
+{
+  auto sample = tuneSample(sceneBB);
+
+  TuneProfile profile{};
+  profile.sceneSize = triangles_.size();
+  profile.sampleSize = sample.size();
+  profile.maxDepth = maxBuildDepth();
+
+  auto bestCost = std::numeric_limits<double>::infinity();
+  for (auto capacity : kTuneCapacities)
   {
-    if (isOnPosSide(curNode->sepAxis, curNode->separator, tr))
-      curNode = curNode->right.get();
-    else if (isOnNegSide(curNode->sepAxis, curNode->separator, tr))
-      curNode = curNode->left.get();
+    KdTree probe{};
+    probe.setNodeCapacity(capacity);
+    probe.setSplitPolicy(splitPolicy_);
+    probe.setThreshold(threshold_);
+    probe.setMixedPrecision(isMixedPrecision_);
+    probe.build(sample.begin(), sample.end());
+
+    auto sampleSize = static_cast<double>(std::max<std::size_t>(sample.size(), 1));
+    auto cost = probe.estimateCost() / sampleSize;
+    profile.capacities.push_back(capacity);
+    profile.costs.push_back(cost);
+
+    if (cost < bestCost)
+    {
+      bestCost = cost;
+      profile.nodeCapacity = capacity;
+    }
+  }
+
+  nodeCapacity_ = profile.nodeCapacity;
+  tuneProfile_ = std::move(profile);
+}
+
+/**
+ * @brief Take triangles whose boxes' centers lie in a window around a triangle of the scene
+ * @details
+ * Window is scene's bound box shrunk along its non flat axes by the same factor, which is
+ * adjusted until window holds between a half and twice kTuneSampleSize triangles. So sample keeps
+ * scene's local density, unlike every k-th triangle. Small scenes are sampled whole.
+ */
+template <std::floating_point T>
+std::vector<Triangle<T>> KdTree<T>::tuneSample(const BoundBox<T> &sceneBB) const
+{
+  auto size = triangles_.size();
+  if (size <= 2 * kTuneSampleSize)
+    return {triangles_.begin(), triangles_.end()};
+
+  std::array<Axis, 3> axes{Axis::X, Axis::Y, Axis::Z};
+  auto isSpanned = [&sceneBB](auto axis) { return sceneBB.max(axis) > sceneBB.min(axis); };
+  auto nDims = std::count_if(axes.begin(), axes.end(), isSpanned);
+  auto dimsInv = 1.0 / static_cast<double>(std::max<std::ptrdiff_t>(nDims, 1));
+
+  const auto &centerBB = prepared_[size / 2].boundBox;
+  auto center = [](const BoundBox<T> &bb, Axis axis) { return (bb.min(axis) + bb.max(axis)) / 2; };
+
+  auto window = sceneBB;
+  auto share = static_cast<double>(kTuneSampleSize) / static_cast<double>(size);
+  std::vector<Triangle<T>> sample{};
+  for (int round = 0; round < 8; ++round)
+  {
+    auto scale = static_cast<T>(std::pow(share, dimsInv));
+    for (auto axis : axes)
+    {
+      auto half = (sceneBB.max(axis) - sceneBB.min(axis)) * scale / 2;
+      window.min(axis) = center(centerBB, axis) - half;
+      window.max(axis) = center(centerBB, axis) + half;
+    }
+
+    sample.clear();
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      const auto &bb = prepared_[i].boundBox;
+      if (std::all_of(axes.begin(), axes.end(), [&](auto axis) {
+            auto coord = center(bb, axis);
+            return window.min(axis) <= coord && coord <= window.max(axis);
+          }))
+        sample.push_back(triangles_[i]);
+    }
+
+    if (sample.size() < kTuneSampleSize / 2)
+      share = std::min(1.0, share * 2);
+    else if (sample.size() > 2 * kTuneSampleSize)
+      share /= 2;
     else
       break;
   }
 
-  curNode->indicies.push_back(index);
-  if (isDivisable(curNode) && (!isSubdiv))
-    subdivide(curNode);
+  return sample;
+}
+
+/**
+ * @brief Estimate cost of building the tree and running self-intersection query over it
+ * @details
+ * Model follows the query: triangles of every node are tested with each other, then they
+ * descend node's subtree by chunks of kQueryGrain and are tested by batches with triangles of
+ * every descendant whose cell they touch. Build partitions every triangle once per level.
+ */
+template <std::floating_point T>
+double KdTree<T>::estimateCost() const
+{
+  double cost = 0;
+  std::vector<std::pair<NodeId, std::size_t>> stack{};
+  std::vector<NodeId> subtree{};
+  if (!nodes_.empty())
+    stack.emplace_back(kRootId, 0);
+
+  while (!stack.empty())
+  {
+    auto [id, depth] = stack.back();
+    stack.pop_back();
+
+    const auto &node = nodes_[id];
+    auto nodeSize = static_cast<double>(node.idxCount);
+    cost += kTuneVisitCost + kTunePartitionCost * nodeSize * static_cast<double>(depth);
+    cost += nodeSize * (nodeSize - 1) / 2;
+
+    if (node.isLeaf())
+      continue;
+
+    stack.emplace_back(node.right(), depth + 1);
+    stack.emplace_back(node.left(), depth + 1);
+
+    auto end = node.idxOffset + node.idxCount;
+    for (auto first = node.idxOffset; first < end; first += kQueryGrain)
+    {
+      auto last = std::min(first + kQueryGrain, end);
+      auto itemBB = emptyBoundBox();
+      for (auto pos = first; pos < last; ++pos)
+        itemBB.merge(prepared_[indicies_[pos]].boundBox);
+
+      auto nBatches = static_cast<double>((last - first + kQueryBatchWidth - 1) / kQueryBatchWidth);
+      subtree.assign({node.left(), node.right()});
+      while (!subtree.empty())
+      {
+        const auto &cur = nodes_[subtree.back()];
+        subtree.pop_back();
+        if (!itemBB.overlaps(cur.boundBox))
+          continue;
+
+        cost += kTuneVisitCost;
+        for (auto pos = cur.idxOffset, curEnd = pos + cur.idxCount; pos < curEnd; ++pos)
+        {
+          cost += kTuneBoxCost;
+          if (itemBB.overlaps(prepared_[indicies_[pos]].boundBox))
+            cost += kTuneBatchCost * nBatches;
+        }
+
+        if (!cur.isLeaf())
+        {
+          subtree.push_back(cur.right());
+          subtree.push_back(cur.left());
+        }
+      }
+    }
+  }
+
+  return cost;
+}
+
+template <std::floating_point T>
+void KdTree<T>::subdivide(NodeId id)
+{
+  auto split = splitNode(nodes_[id]);
+  if (!split)
+    return;
+
+  auto children = pushChildren(nodes_.mut(), split->first, split->second);
+  nodes_[id].children = children;
+}
+
+/**
+ * @brief Choose node's separation plane and distribute its indices between node and children
+ * @details
+ * Only node's own index range is touched, so disjoint nodes can be split concurrently.
+ * Children are returned to the caller, which is responsible for linking them to the node.
+ * Nothing is returned and node is left intact if split policy keeps it a leaf.
+ */
+template <std::floating_point T>
+std::optional<std::pair<Node<T>, Node<T>>> KdTree<T>::splitNode(Node<T> &node)
+{
+  auto [axis, sep] = findSplit(node);
+  if (Axis::NONE == axis)
+    return std::nullopt;
+
+  Node<T> left{node.boundBox};
+  Node<T> right{node.boundBox};
+  right.boundBox.min(axis) = left.boundBox.max(axis) = sep;
+
+  node.sepAxis = axis;
+  node.separator = sep;
+
+  /* Partition node's range in place: [staying | left | right], spare slots go to the right */
+  auto begin = indicies_.begin() + node.idxOffset;
+  auto end = begin + node.idxCount;
+
+  const auto *triangles = std::as_const(triangles_).data();
+  auto leftBegin = std::partition(begin, end, [triangles, axis = axis, sep = sep](auto index) {
+    const auto &tr = triangles[index];
+    return !isOnPosSide(axis, sep, tr) && !isOnNegSide(axis, sep, tr);
+  });
+  auto rightBegin = std::partition(leftBegin, end, [triangles, axis = axis, sep = sep](auto index) {
+    return isOnNegSide(axis, sep, triangles[index]);
+  });
+
+  auto nStay = toOffset(static_cast<std::size_t>(leftBegin - begin));
+  auto nLeft = toOffset(static_cast<std::size_t>(rightBegin - leftBegin));
+  auto nRight = toOffset(static_cast<std::size_t>(end - rightBegin));
+
+  left.idxOffset = node.idxOffset + nStay;
+  left.idxCount = left.idxCapacity = nLeft;
+
+  right.idxOffset = left.idxOffset + nLeft;
+  right.idxCount = nRight;
+  right.idxCapacity = nRight + (node.idxCapacity - node.idxCount);
+
+  node.idxCount = node.idxCapacity = nStay;
+  return std::pair{left, right};
+}
+
+/**
+ * @brief Subdivide all descendants of node stored in nodes, new nodes are appended to nodes
+ * @param[in, out] nodes node buffer
+ * @param[in] id node's offset in nodes
+ * @param[in] depth node's depth in the whole tree
+ */
+template <std::floating_point T>
+void KdTree<T>::buildDescendants(NodeBuffer &nodes, NodeId id, std::size_t depth)
+{
+  auto maxDepth = maxBuildDepth();
+  std::vector<std::pair<NodeId, std::size_t>> stack{{id, depth}};
+
+  while (!stack.empty())
+  {
+    auto [curId, curDepth] = stack.back();
+    stack.pop_back();
+
+    if (curDepth >= maxDepth || !isDivisable(nodes[curId]))
+      continue;
+
+    auto split = splitNode(nodes[curId]);
+    if (!split)
+      continue;
+
+    auto children = pushChildren(nodes, split->first, split->second);
+    nodes[curId].children = children;
+
+    stack.emplace_back(children + 1, curDepth + 1);
+    stack.emplace_back(children, curDepth + 1);
+  }
+}
+
+/**
+ * @brief Build descendants of node concurrently
+ * @details
+ * Returned buffer has the same layout as the one sequential build appends after the node:
+ * its first pair are node's children, children offsets are relative to buffer's beginning.
+ * Left subtree is built by a pool task, the right one by the current thread, then both are
+ * appended in the order of sequential depth-first build.
+ *
+ * @param[in] pool thread pool to run tasks on
+ * @param[in, out] node node to subdivide
+ * @param[in] depth node's depth
+ * @return NodeBuffer node's descendants
+ */
+template <std::floating_point T>
+typename KdTree<T>::NodeBuffer KdTree<T>::buildParallel(ThreadPool &pool, Node<T> &node,
+                                                        std::size_t depth)
+{
+  NodeBuffer descendants{};
+  if (depth >= maxBuildDepth() || !isDivisable(node))
+    return descendants;
+
+  auto nIndices = node.idxCount;
+  auto split = splitNode(node);
+  if (!split)
+    return descendants;
+
+  node.children = pushChildren(descendants, split->first, split->second);
+
+  /* Small subtrees aren't worth a task, deep ones are already spread among threads */
+  auto maxSpawnDepth = std::bit_width(pool.size()) + kParallelBuildDepth;
+  if (depth >= maxSpawnDepth || nIndices < kParallelBuildGrain)
+  {
+    buildDescendants(descendants, 0, depth + 1);
+    buildDescendants(descendants, 1, depth + 1);
+    return descendants;
+  }
+
+  NodeBuffer leftDesc{};
+  ThreadPool::TaskGroup group{pool};
+  group.run([&] { leftDesc = buildParallel(pool, descendants[0], depth + 1); });
+  auto rightDesc = buildParallel(pool, descendants[1], depth + 1);
+  group.wait();
+
+  appendSubtree(descendants, 0, leftDesc);
+  appendSubtree(descendants, 1, rightDesc);
+  return descendants;
+}
+
+/**
+ * @brief Split self-intersection query into items of at most kQueryGrain triangles
+ * @details Items of nodes closer to the root come first, they usually are the most expensive
+ */
+template <std::floating_point T>
+std::vector<typename KdTree<T>::QueryItem> KdTree<T>::splitQuery() const
+{
+  std::vector<QueryItem> items{};
+  for (std::size_t id = 0; id < nodes_.size(); ++id)
+  {
+    const auto &node = nodes_[id];
+    auto end = node.idxOffset + node.idxCount;
+    for (auto first = node.idxOffset; first < end; first += std::min(kQueryGrain, end - first))
+      items.push_back({static_cast<NodeId>(id), first, first + std::min(kQueryGrain, end - first)});
+  }
+
+  return items;
+}
+
+/**
+ * @brief Run self-intersection query and collect its results into per-thread buffers
+ * @details
+ * Every triangle is tested with triangles stored after it in its node and with triangles of
+ * node's subtree which it may touch, so every intersecting pair is found exactly once.
+ * Query is split into node ranges, which are distributed among threadCount() threads with work
+ * stealing. Thread records pairs it finds into its own buffer, so no locking is needed.
+ *
+ * @tparam Buffer - type of per-thread buffer
+ * @tparam Add - callable as add(buffer, lhs, rhs) to record intersecting pair
+ * @param[in] init initial state of every thread's buffer
+ * @return std::vector<Buffer> filled buffers, at least one
+ */
+template <std::floating_point T>
+template <typename Buffer, typename Add>
+std::vector<Buffer> KdTree<T>::collectIntersections(Add add, const Buffer &init) const
+{
+  auto items = splitQuery();
+  auto *pool = (items.size() > 1) ? pool_.get() : nullptr;
+  std::vector<Buffer> buffers(pool ? pool->size() : 1, init);
+  forEachParallel(pool, items.size(), 1,
+                  [this, &items, &buffers, &add](auto first, auto last, auto thread) {
+                    auto &buffer = buffers[thread];
+                    auto report = [&buffer, &add](auto lhs, auto rhs) { add(buffer, lhs, rhs); };
+                    std::vector<NodeId> stack{};
+                    std::vector<QueryBatch> batches{};
+                    for (auto i = first; i < last; ++i)
+                      intersectItem(items[i], stack, batches, report);
+                  });
+
+  return buffers;
 }
 
+/**
+ * @brief Narrow phase of queries, precision depends on isMixedPrecision()
+ */
 template <std::floating_point T>
-bool KdTree<T>::isDivisable(const Node<T> *node)
+bool KdTree<T>::isIntersectPair(const Triangle<T> &tr1, const PreparedTriangle<T> &prep1,
+                                const Triangle<T> &tr2, const PreparedTriangle<T> &prep2) const
 {
-  return (node->indicies.size() > nodeCapacity_) && (node->sepAxis == Axis::NONE);
+  if (isMixedPrecision_)
+    return isIntersectMixed(tr1, prep1, tr2, prep2, threshold_);
+
+  return isIntersect(tr1, prep1, tr2, prep2, threshold_);
 }
 
+/**
+ * @brief Test item's triangles with the rest of node's triangles and with node's subtree
+ * @details
+ * Item's triangles descend the subtree together: a descendant is skipped along with its
+ * subtree by one test of item's bound box with descendant's cell, no separator classification
+ * is done per triangle. Narrow phase rejects pairs of triangles with disjoint boxes at once.
+ * Every triangle of the subtree is tested with item's triangles by batches of kQueryBatchWidth.
+ *
+ * @param[in] item triangles to test
+ * @param[in] stack scratch buffer for traversal
+ * @param[in] batches scratch buffer for item's triangles
+ * @param[in] report called with indices of every intersecting pair
+ */
 template <std::floating_point T>
-void KdTree<T>::subdivide(Node<T> *node)
+template <std::invocable<Index, Index> Report>
+void KdTree<T>::intersectItem(const QueryItem &item, std::vector<NodeId> &stack,
+                              std::vector<QueryBatch> &batches, Report report) const
 {
-  const auto &nodeBB = node->boundBox;
-  auto axis = node->sepAxis = nodeBB.getMaxDim();
-  auto sep = node->separator = nodeBB.min(axis) + (nodeBB.max(axis) - nodeBB.min(axis)) / 2;
+  const auto &node = nodes_[item.id];
+  auto nodeEnd = node.idxOffset + node.idxCount;
+
+  auto itemBB = emptyBoundBox();
+  for (auto pos = item.first; pos < item.last; ++pos)
+  {
+    auto index = indicies_[pos];
+    itemBB.merge(prepared_[index].boundBox);
+
+    for (auto other = pos + 1; other < nodeEnd; ++other)
+    {
+      auto otherIndex = indicies_[other];
+      if (isIntersectPair(triangles_[index], prepared_[index], triangles_[otherIndex],
+                          prepared_[otherIndex]))
+        report(index, otherIndex);
+    }
+  }
+
+  if (node.isLeaf())
+    return;
+
+  /* Triangles' vertices lie inside their cells, so cells are widened like triangles' boxes */
+  auto cellTestBB = itemBB;
+  for (auto axis : {Axis::X, Axis::Y, Axis::Z})
+  {
+    cellTestBB.min(axis) -= threshold_;
+    cellTestBB.max(axis) += threshold_;
+  }
+
+  batches.resize((item.last - item.first + kQueryBatchWidth - 1) / kQueryBatchWidth);
+  for (auto &batch : batches)
+    batch.clear();
+
+  for (auto pos = item.first; pos < item.last; ++pos)
+  {
+    auto index = indicies_[pos];
+    batches[(pos - item.first) / kQueryBatchWidth].push(triangles_[index], prepared_[index]);
+  }
+
+  stack.clear();
+  stack.push_back(node.right());
+  stack.push_back(node.left());
 
-  auto newRightBB = nodeBB;
-  auto newLeftBB = nodeBB;
+  while (!stack.empty())
+  {
+    const auto &cur = nodes_[stack.back()];
+    stack.pop_back();
+
+    if (!cellTestBB.overlaps(cur.boundBox))
+      continue;
+
+    for (auto other = cur.idxOffset, end = other + cur.idxCount; other < end; ++other)
+    {
+      auto otherIndex = indicies_[other];
+      const auto &otherPrep = prepared_[otherIndex];
+      if (!itemBB.overlaps(otherPrep.boundBox))
+        continue;
+
+      for (std::size_t batchIdx = 0; batchIdx < batches.size(); ++batchIdx)
+      {
+        const auto &batch = batches[batchIdx];
+        auto found =
+          isMixedPrecision_
+            ? isIntersectMixed(triangles_[otherIndex], otherPrep, batch, batch.lanes(), threshold_)
+            : isIntersect(triangles_[otherIndex], otherPrep, batch, batch.lanes(), threshold_);
+        for (; found != 0; found &= found - 1)
+        {
+          auto lane = static_cast<std::size_t>(std::countr_zero(found));
+          report(otherIndex, indicies_[item.first + batchIdx * kQueryBatchWidth + lane]);
+        }
+      }
+    }
 
-  newRightBB.min(axis) = newLeftBB.max(axis) = sep;
-  node->right.reset(new Node<T>{T{}, Axis::NONE, newRightBB});
-  node->left.reset(new Node<T>{T{}, Axis::NONE, newLeftBB});
+    if (!cur.isLeaf())
+    {
+      stack.push_back(cur.right());
+      stack.push_back(cur.left());
+    }
+  }
+}
 
-  auto indicies = node->indicies;
-  node->indicies.clear();
+/**
+ * @brief Split query between this and other trees into enough independent items to keep all
+ * threads busy
+ */
+template <std::floating_point T>
+std::vector<typename KdTree<T>::CrossItem> KdTree<T>::splitCrossQuery(const KdTree &other) const
+{
+  std::vector<CrossItem> items{{kRootId, kRootId, true, true}};
+  std::vector<CrossItem> next{};
+  auto nWanted = kCrossItemsPerThread * threadCount_;
+  for (std::size_t round = 0; round < kCrossSplitRounds && items.size() < nWanted; ++round)
+  {
+    next.clear();
+    for (const auto &item : items)
+      if (!splitCrossItem(other, item, next))
+        next.push_back(item);
 
-  for (auto index : indicies)
-    nonExpandingInsert(node, triangles_[index], index, /* isSubdiv = */ true);
+    std::swap(items, next);
+  }
+
+  return items;
+}
+
+/**
+ * @brief Replace item with items covering the same pairs of triangles
+ * @details
+ * Pairs of item are own(lhs) x own(rhs), own(lhs) x subtrees of rhs's children and subtrees of
+ * lhs's children x rhs's part. Items whose cells are apart are dropped.
+ *
+ * @param[in] other tree of rhs nodes
+ * @param[in] item item to split
+ * @param[out] children resulting items are appended here
+ * @return true if item has been split, false if it covers only own triangles of both nodes
+ */
+template <std::floating_point T>
+bool KdTree<T>::splitCrossItem(const KdTree &other, const CrossItem &item,
+                               std::vector<CrossItem> &children) const
+{
+  const auto &lhs = nodes_[item.lhs];
+  const auto &rhs = other.nodes_[item.rhs];
+  auto splitLhs = item.lhsSubtree && !lhs.isLeaf();
+  auto splitRhs = item.rhsSubtree && !rhs.isLeaf();
+  if (!splitLhs && !splitRhs)
+    return false;
+
+  /* Triangles' vertices lie inside their cells, touching ones may be both thresholds apart */
+  auto thres = threshold_ + other.threshold_;
+  auto push = [&children, &other, thres, this](const CrossItem &child) {
+    auto lhsBB = nodes_[child.lhs].boundBox;
+    for (auto axis : {Axis::X, Axis::Y, Axis::Z})
+    {
+      lhsBB.min(axis) -= thres;
+      lhsBB.max(axis) += thres;
+    }
+
+    if (lhsBB.overlaps(other.nodes_[child.rhs].boundBox))
+      children.push_back(child);
+  };
+
+  push({item.lhs, item.rhs, false, false});
+  if (splitRhs)
+  {
+    push({item.lhs, rhs.left(), false, true});
+    push({item.lhs, rhs.right(), false, true});
+  }
+
+  if (splitLhs)
+  {
+    push({lhs.left(), item.rhs, true, item.rhsSubtree});
+    push({lhs.right(), item.rhs, true, item.rhsSubtree});
+  }
+
+  return true;
+}
+
+/**
+ * @brief Report all intersecting pairs of triangles covered by item
+ *
+ * @param[in] other tree of rhs nodes
+ * @param[in] item item to process
+ * @param[in] stack scratch buffer for traversal
+ * @param[in] report called as report(lhs, rhs) for every intersecting pair
+ */
+template <std::floating_point T>
+template <std::invocable<Index, Index> Report>
+void KdTree<T>::intersectCross(const KdTree &other, const CrossItem &item,
+                               std::vector<CrossItem> &stack, Report report) const
+{
+  stack.clear();
+  stack.push_back(item);
+
+  while (!stack.empty())
+  {
+    auto cur = stack.back();
+    stack.pop_back();
+
+    if (cur.lhsSubtree || cur.rhsSubtree)
+      if (splitCrossItem(other, cur, stack))
+        continue;
+
+    const auto &lhs = nodes_[cur.lhs];
+    const auto &rhs = other.nodes_[cur.rhs];
+    for (auto lhsPos = lhs.idxOffset, lhsEnd = lhsPos + lhs.idxCount; lhsPos < lhsEnd; ++lhsPos)
+    {
+      auto lhsIndex = indicies_[lhsPos];
+      const auto &lhsTr = triangles_[lhsIndex];
+      const auto &lhsPrep = prepared_[lhsIndex];
+
+      for (auto rhsPos = rhs.idxOffset, rhsEnd = rhsPos + rhs.idxCount; rhsPos < rhsEnd; ++rhsPos)
+      {
+        auto rhsIndex = other.indicies_[rhsPos];
+        if (isIntersectPair(lhsTr, lhsPrep, other.triangles_[rhsIndex], other.prepared_[rhsIndex]))
+          report(lhsIndex, rhsIndex);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Call func(first, last, thread) for pieces of [0, size) on pool's threads
+ * @details
+ * Whole range is processed by the current thread as thread 0 if pool is null.
+ * Pool threads outlive the call, so they flush narrow phase stats after every piece.
+ */
+template <std::floating_point T>
+template <typename Func>
+void KdTree<T>::forEachParallel(ThreadPool *pool, std::size_t size, std::size_t grain, Func func)
+{
+  if (pool == nullptr)
+  {
+    func(std::size_t{0}, size, std::size_t{0});
+    return;
+  }
+
+  pool->enter([pool, size, grain, &func] {
+    pool->parallelFor(0, size, grain, [&](auto first, auto last) {
+      func(first, last, pool->workerIndex());
+      detail::flushNarrowStats();
+    });
+  });
+}
+
+/**
+ * @brief Run query(first, last, report) for pieces of [0, nItems) and pass pairs found by
+ * every piece to callback
+ * @details
+ * Piece keeps its pairs in its own buffer and hands them to callback under a lock when it is
+ * done, so memory is bounded by pairs of running pieces, not of the whole query.
+ */
+template <std::floating_point T>
+template <typename Query, typename Callback>
+void KdTree<T>::reportByPiece(std::size_t nItems, Query query, Callback callback) const
+{
+  auto *pool = (nItems > 1) ? pool_.get() : nullptr;
+  std::mutex mutex{};
+  forEachParallel(pool, nItems, 1, [&query, &callback, &mutex](auto first, auto last, auto) {
+    std::vector<IndexPair> found{};
+    query(first, last, [&found](Index lhs, Index rhs) { found.emplace_back(lhs, rhs); });
+
+    std::lock_guard lock{mutex};
+    for (auto [lhs, rhs] : found)
+      callback(lhs, rhs);
+  });
+}
+
+/**
+ * @brief Bound box which overlaps nothing and is neutral for merge
+ */
+template <std::floating_point T>
+BoundBox<T> KdTree<T>::emptyBoundBox()
+{
+  constexpr auto inf = std::numeric_limits<T>::infinity();
+  return {inf, -inf, inf, -inf, inf, -inf};
+}
+
+template <std::floating_point T>
+Split<T> KdTree<T>::findSplit(const Node<T> &node) const
+{
+  switch (splitPolicy_)
+  {
+  case SplitPolicy::SAH:
+  {
+    auto begin = indicies_.begin() + node.idxOffset;
+    return sahSplit(node.boundBox, begin, begin + node.idxCount, triangles_);
+  }
+  case SplitPolicy::MIDDLE:
+  default:
+    return middleSplit(node.boundBox);
+  }
 }
 
 //============================================================================================
@@ -424,12 +2025,10 @@ typename KdTree<T>::ConstIterator &KdTree<T>::ConstIterator::operator++()
   auto fifoEntry = fifo_.front();
   fifo_.pop();
 
-  if (Axis::NONE != fifoEntry->sepAxis)
+  if (!fifoEntry->isLeaf())
   {
-    if (nullptr != fifoEntry->left)
-      fifo_.push(fifoEntry->left.get());
-    if (nullptr != fifoEntry->right)
-      fifo_.push(fifoEntry->right.get());
+    fifo_.push(tree_->nodeById(fifoEntry->left()));
+    fifo_.push(tree_->nodeById(fifoEntry->right()));
   }
 
   node_ = (0 == fifo_.size()) ? nullptr : fifo_.front();
@@ -1,9 +1,8 @@
 #ifndef __INCLUDE_KDTREE_NODE_HH__
 #define __INCLUDE_KDTREE_NODE_HH__
 
+#include <cstdint>
 #include <iostream>
-#include <memory>
-#include <vector>
 
 #include "primitives/primitives.hh"
 
@@ -12,47 +11,86 @@ namespace geom::kdtree
 
 using Index = std::size_t;
 
+/**
+ * @brief Offset of a node in tree's node array
+ */
+using NodeId = std::uint32_t;
+
+/**
+ * @brief Offset of the root node. Root is never a child, so it also marks absent children
+ */
+constexpr NodeId kRootId = 0;
+
+/**
+ * @brief Node of KdTree
+ * @details
+ * All nodes of a tree are stored in one contiguous array. Children of a node are allocated
+ * together: left child is stored at @ref children offset and right one right after it.
+ *
+ * Indices of node's triangles are stored in tree's shared index array in range
+ * [idxOffset, idxOffset + idxCount). While tree is being modified range may have spare slots
+ * up to idxCapacity, they are dropped by KdTree::finalize().
+ *
+ * Node's cell box is stored rather than derived during descent: queries walk subtrees from a
+ * stack and pair nodes of two trees in any order, so cells are tested without the path from the
+ * root. idxCapacity keeps insertions into a built tree amortized. So node takes 48 bytes for
+ * float and 80 for double.
+ */
 template <std::floating_point T>
 struct Node final
 {
+  BoundBox<T> boundBox{};
   T separator{};            // separator's coordinate on separation axis
+  NodeId children{kRootId}; // offset of the left child, kRootId for leaves
   Axis sepAxis{Axis::NONE}; // separation axis
-  BoundBox<T> boundBox{};
-  std::vector<Index> indicies{};
+  std::uint32_t idxOffset{};
+  std::uint32_t idxCount{};
+  std::uint32_t idxCapacity{};
 
-  std::unique_ptr<Node> left{nullptr};
-  std::unique_ptr<Node> right{nullptr};
+  using IndexIterator = Index *;
+  using IndexConstIterator = const Index *;
 
-  using IndexIterator = std::vector<Index>::iterator;
-  using IndexConstIterator = std::vector<Index>::const_iterator;
+  bool isLeaf() const;
+  NodeId left() const;
+  NodeId right() const;
 
-  void dumpRecursive(std::ostream &ost) const;
+  void dump(std::ostream &ost, NodeId id, const Index *indicies) const;
 };
 
 template <std::floating_point T>
-void Node<T>::dumpRecursive(std::ostream &ost) const
+bool Node<T>::isLeaf() const
 {
-  ost << reinterpret_cast<std::uintptr_t>(this)
-      << " [shape=box,label=\"axis: " << static_cast<int>(sepAxis) << ",\\n"
-      << boundBox << ",\\nvec: {";
+  return kRootId == children;
+}
 
-  for (auto elem : indicies)
-    ost << elem << " ";
+template <std::floating_point T>
+NodeId Node<T>::left() const
+{
+  return children;
+}
+
+template <std::floating_point T>
+NodeId Node<T>::right() const
+{
+  return children + 1;
+}
+
+template <std::floating_point T>
+void Node<T>::dump(std::ostream &ost, NodeId id, const Index *indicies) const
+{
+  ost << id << " [shape=box,label=\"axis: " << static_cast<int>(sepAxis) << ",\\n" << boundBox
+      << ",\\nvec: {";
+
+  for (auto it = indicies + idxOffset, end = it + idxCount; it != end; ++it)
+    ost << *it << " ";
 
   ost << "}\"];" << std::endl;
 
-  if (left)
-  {
-    left->dumpRecursive(ost);
-    ost << reinterpret_cast<std::uintptr_t>(this) << " -> "
-        << reinterpret_cast<std::uintptr_t>(left.get()) << " [label=\"L\"];" << std::endl;
-  }
-  if (right)
-  {
-    right->dumpRecursive(ost);
-    ost << reinterpret_cast<std::uintptr_t>(this) << " -> "
-        << reinterpret_cast<std::uintptr_t>(right.get()) << " [label=\"R\"];" << std::endl;
-  }
+  if (isLeaf())
+    return;
+
+  ost << id << " -> " << left() << " [label=\"L\"];" << std::endl;
+  ost << id << " -> " << right() << " [label=\"R\"];" << std::endl;
 }
 
 } // namespace geom::kdtree
@@ -0,0 +1,344 @@
+#ifndef __INCLUDE_KDTREE_POOL_HH__
+#define __INCLUDE_KDTREE_POOL_HH__
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace geom::kdtree
+{
+
+/**
+ * @class ThreadPool
+ * @brief Work-stealing thread pool for fork-join parallelism
+ * @details
+ * Every worker owns a deque of tasks: it pops tasks from the back of its own deque and steals
+ * from the front of others' deques when own one is empty. Thread which waits for a TaskGroup
+ * executes tasks too, so nested fork-join never deadlocks. Pool of size N runs N - 1
+ * background threads, the N-th one is the thread waiting for tasks.
+ *
+ * Pool may be shared by several threads: each of them runs its fork-join region inside enter(),
+ * which admits one foreign thread at a time, so workerIndex() stays unique among running tasks.
+ */
+class ThreadPool final
+{
+public:
+  using Task = std::function<void()>;
+
+  class TaskGroup;
+
+private:
+  struct Queue final
+  {
+    std::mutex mutex{};
+    std::deque<Task> tasks{};
+  };
+
+  std::vector<Queue> queues_;
+  std::vector<std::thread> workers_{};
+
+  std::mutex sleepMutex_{};
+  std::condition_variable sleepCV_{};
+  std::atomic<std::size_t> queued_{0};
+  bool isStopped_{false};
+  std::mutex entryMutex_{};
+
+  static inline thread_local const ThreadPool *curPool_ = nullptr;
+  static inline thread_local std::size_t curQueue_ = 0;
+
+public:
+  explicit ThreadPool(std::size_t nThreads = std::thread::hardware_concurrency());
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+  ~ThreadPool();
+
+  std::size_t size() const;
+  std::size_t workerIndex() const;
+
+  template <std::invocable Func>
+  void enter(Func func);
+  void submit(Task task);
+  bool tryRunOne();
+
+  template <std::invocable<std::size_t, std::size_t> Func>
+  void parallelFor(std::size_t begin, std::size_t end, std::size_t grain, Func func);
+
+private:
+  std::size_t ownQueue() const;
+  bool tryPop(Task &task);
+  void workerLoop(std::size_t idx);
+};
+
+/**
+ * @class ThreadPool::TaskGroup
+ * @brief Set of tasks to wait for. First exception thrown by a task is rethrown by wait()
+ */
+class ThreadPool::TaskGroup final
+{
+private:
+  ThreadPool &pool_;
+  std::atomic<std::size_t> pending_{0};
+  std::mutex excMutex_{};
+  std::exception_ptr exception_{};
+
+public:
+  explicit TaskGroup(ThreadPool &pool);
+  TaskGroup(const TaskGroup &) = delete;
+  TaskGroup &operator=(const TaskGroup &) = delete;
+  ~TaskGroup();
+
+  void run(Task task);
+  void wait();
+
+private:
+  void waitPending();
+};
+
+//============================================================================================
+//                                    ThreadPool definitions
+//============================================================================================
+
+inline ThreadPool::ThreadPool(std::size_t nThreads) : queues_(std::max<std::size_t>(nThreads, 1))
+{
+  for (std::size_t i = 1; i < queues_.size(); ++i)
+    workers_.emplace_back([this, i] { workerLoop(i); });
+}
+
+inline ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard lock{sleepMutex_};
+    isStopped_ = true;
+  }
+  sleepCV_.notify_all();
+
+  for (auto &worker : workers_)
+    worker.join();
+}
+
+inline std::size_t ThreadPool::size() const
+{
+  return queues_.size();
+}
+
+/**
+ * @brief Index of current thread in [0, size()), threads outside the pool get 0
+ * @details Lets tasks address per-thread data without locking
+ */
+inline std::size_t ThreadPool::workerIndex() const
+{
+  return ownQueue();
+}
+
+/**
+ * @brief Run func on the current thread as thread 0 of the pool
+ * @details
+ * Foreign threads are admitted one by one, so tasks of concurrent callers never share index 0.
+ * Calls from pool's own threads, nested ones included, run func right away.
+ */
+template <std::invocable Func>
+void ThreadPool::enter(Func func)
+{
+  if (curPool_ == this)
+  {
+    func();
+    return;
+  }
+
+  std::lock_guard entry{entryMutex_};
+  auto *prevPool = std::exchange(curPool_, this);
+  auto prevQueue = std::exchange(curQueue_, std::size_t{0});
+  try
+  {
+    func();
+  }
+  catch (...)
+  {
+    curPool_ = prevPool;
+    curQueue_ = prevQueue;
+    throw;
+  }
+  curPool_ = prevPool;
+  curQueue_ = prevQueue;
+}
+
+inline void ThreadPool::submit(Task task)
+{
+  auto &queue = queues_[ownQueue()];
+  {
+    std::lock_guard lock{queue.mutex};
+    queue.tasks.push_back(std::move(task));
+  }
+
+  {
+    std::lock_guard lock{sleepMutex_};
+    ++queued_;
+  }
+  sleepCV_.notify_one();
+}
+
+inline bool ThreadPool::tryRunOne()
+{
+  Task task{};
+  if (!tryPop(task))
+    return false;
+
+  task();
+  return true;
+}
+
+/**
+ * @brief Call func(first, last) for subranges of [begin, end) no longer than grain
+ * @details
+ * Range is halved recursively: the first half is left for thieves, the second one is processed
+ * by the current thread. So idle threads steal the biggest available pieces of work.
+ */
+template <std::invocable<std::size_t, std::size_t> Func>
+void ThreadPool::parallelFor(std::size_t begin, std::size_t end, std::size_t grain, Func func)
+{
+  grain = std::max<std::size_t>(grain, 1);
+  if (end - begin <= grain)
+  {
+    if (begin != end)
+      func(begin, end);
+    return;
+  }
+
+  auto middle = begin + (end - begin) / 2;
+  TaskGroup group{*this};
+  group.run([this, begin, middle, grain, &func] { parallelFor(begin, middle, grain, func); });
+  parallelFor(middle, end, grain, func);
+  group.wait();
+}
+
+/**
+ * @brief Queue of current thread: worker's own one or queue 0 for foreign threads
+ */
+inline std::size_t ThreadPool::ownQueue() const
+{
+  return (curPool_ == this) ? curQueue_ : 0;
+}
+
+inline bool ThreadPool::tryPop(Task &task)
+{
+  auto own = ownQueue();
+  auto nQueues = queues_.size();
+
+  for (std::size_t i = 0; i < nQueues; ++i)
+  {
+    auto &queue = queues_[(own + i) % nQueues];
+    std::lock_guard lock{queue.mutex};
+    if (queue.tasks.empty())
+      continue;
+
+    /* Own tasks are taken LIFO, stolen ones FIFO: thieves get the biggest pieces of work */
+    if (0 == i)
+    {
+      task = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+    }
+    else
+    {
+      task = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+    }
+
+    --queued_;
+    return true;
+  }
+
+  return false;
+}
+
+inline void ThreadPool::workerLoop(std::size_t idx)
+{
+  curPool_ = this;
+  curQueue_ = idx;
+
+  while (true)
+  {
+    if (tryRunOne())
+      continue;
+
+    std::unique_lock lock{sleepMutex_};
+    sleepCV_.wait(lock, [this] { return isStopped_ || queued_ > 0; });
+    if (isStopped_)
+      return;
+  }
+}
+
+//============================================================================================
+//                              ThreadPool::TaskGroup definitions
+//============================================================================================
+
+inline ThreadPool::TaskGroup::TaskGroup(ThreadPool &pool) : pool_(pool)
+{}
+
+inline ThreadPool::TaskGroup::~TaskGroup()
+{
+  /* Tasks reference the group, so it can't die before them */
+  waitPending();
+}
+
+inline void ThreadPool::TaskGroup::run(Task task)
+{
+  ++pending_;
+  pool_.submit([this, &pool = pool_, task = std::move(task)] {
+    try
+    {
+      task();
+    }
+    catch (...)
+    {
+      std::lock_guard lock{excMutex_};
+      if (!exception_)
+        exception_ = std::current_exception();
+    }
+
+    /* Group may be gone once pending_ is zero. Waiter checks pending_ under sleepMutex_, so
+     * taking it before notification closes the lost wakeup gap */
+    if (0 == --pending_)
+    {
+      {
+        std::lock_guard lock{pool.sleepMutex_};
+      }
+      pool.sleepCV_.notify_all();
+    }
+  });
+}
+
+inline void ThreadPool::TaskGroup::wait()
+{
+  waitPending();
+
+  std::lock_guard lock{excMutex_};
+  if (exception_)
+    std::rethrow_exception(std::exchange(exception_, nullptr));
+}
+
+/**
+ * @brief Help running queued tasks until all tasks of the group finish, sleep if queue is empty
+ */
+inline void ThreadPool::TaskGroup::waitPending()
+{
+  while (pending_ > 0)
+  {
+    if (pool_.tryRunOne())
+      continue;
+
+    std::unique_lock lock{pool_.sleepMutex_};
+    pool_.sleepCV_.wait(lock, [this] { return 0 == pending_ || pool_.queued_ > 0; });
+  }
+}
+
+} // namespace geom::kdtree
+
+#endif // __INCLUDE_KDTREE_POOL_HH__
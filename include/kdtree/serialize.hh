@@ -0,0 +1,74 @@
+#ifndef __INCLUDE_KDTREE_SERIALIZE_HH__
+#define __INCLUDE_KDTREE_SERIALIZE_HH__
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace geom::kdtree
+{
+
+/**
+ * @brief Alignment of header and every array of a saved tree
+ */
+constexpr std::size_t kTreeFileAlign = 64;
+
+/**
+ * @class TreeFileHeader
+ * @brief Header of a saved KdTree
+ * @details
+ * Header is followed by node, index, triangle and prepared triangle arrays exactly as they
+ * are laid out in memory, each one starting at offset aligned to kTreeFileAlign. So a file
+ * mapped at page boundary is used in place. Sizes of element types and byte order tag make
+ * files of incompatible builds be rejected instead of misread.
+ */
+struct TreeFileHeader final
+{
+  static constexpr std::array<char, 8> kMagic{'T', 'R', 'I', 'K', 'D', 'T', 'R', 'E'};
+  static constexpr std::uint32_t kVersion = 3;
+  static constexpr std::uint32_t kByteOrder = 0x01020304;
+
+  std::array<char, 8> magic{kMagic};
+  std::uint32_t version{kVersion};
+  std::uint32_t byteOrder{kByteOrder};
+  std::uint32_t coordSize{};
+  std::uint32_t nodeSize{};
+  std::uint32_t indexSize{};
+  std::uint32_t triangleSize{};
+  std::uint32_t preparedSize{};
+  std::uint32_t splitPolicy{};
+  std::uint64_t nodeCapacity{};
+  std::uint64_t nodeCount{};
+  std::uint64_t indexCount{};
+  std::uint64_t triangleCount{};
+  std::array<std::uint8_t, 16> threshold{}; // bytes of tree's threshold, see KdTree::save
+  std::array<std::uint8_t, 40> padding{};
+
+  /**
+   * @brief Offsets of arrays in file: nodes, indices, triangles, prepared triangles and end
+   */
+  std::array<std::uint64_t, 5> sectionOffsets() const;
+};
+
+static_assert(sizeof(TreeFileHeader) % kTreeFileAlign == 0 &&
+              std::is_trivially_copyable_v<TreeFileHeader>);
+
+inline std::array<std::uint64_t, 5> TreeFileHeader::sectionOffsets() const
+{
+  auto alignUp = [](std::uint64_t offset) {
+    return (offset + kTreeFileAlign - 1) / kTreeFileAlign * kTreeFileAlign;
+  };
+
+  std::array<std::uint64_t, 5> res{};
+  res[0] = sizeof(TreeFileHeader);
+  res[1] = alignUp(res[0] + nodeCount * nodeSize);
+  res[2] = alignUp(res[1] + indexCount * indexSize);
+  res[3] = alignUp(res[2] + triangleCount * triangleSize);
+  res[4] = res[3] + triangleCount * preparedSize;
+  return res;
+}
+
+} // namespace geom::kdtree
+
+#endif // __INCLUDE_KDTREE_SERIALIZE_HH__
@@ -0,0 +1,231 @@
+#ifndef __INCLUDE_KDTREE_SINK_HH__
+#define __INCLUDE_KDTREE_SINK_HH__
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "node.hh"
+
+namespace geom::kdtree
+{
+
+/**
+ * @brief Indices of two intersecting triangles, the first one is always less
+ */
+using IndexPair = std::pair<Index, Index>;
+
+/**
+ * @class IndexBitmap
+ * @brief Dense set of triangle indices, one bit per triangle
+ * @details
+ * Marking an index is a single store without allocation or lookup, and indices are visited
+ * in ascending order by skipping empty words. So no sort or deduplication is needed.
+ */
+class IndexBitmap final
+{
+private:
+  using Word = std::uint64_t;
+  static constexpr std::size_t kWordBits = 64;
+
+  std::vector<Word> words_{};
+  std::size_t size_{};
+
+public:
+  IndexBitmap() = default;
+  explicit IndexBitmap(std::size_t size);
+
+  void resize(std::size_t size);
+  void reset();
+
+  void set(Index index);
+  bool test(Index index) const;
+  void merge(const IndexBitmap &other);
+
+  std::size_t size() const;
+  std::size_t count() const;
+
+  template <std::invocable<Index> Visit>
+  void forEach(Visit visit) const;
+};
+
+inline IndexBitmap::IndexBitmap(std::size_t size)
+  : words_((size + kWordBits - 1) / kWordBits), size_(size)
+{}
+
+/**
+ * @brief Change number of indices bitmap may hold, flags of kept indices are kept
+ */
+inline void IndexBitmap::resize(std::size_t size)
+{
+  words_.resize((size + kWordBits - 1) / kWordBits);
+  if (size < size_ && size % kWordBits != 0)
+    words_.back() &= (Word{1} << (size % kWordBits)) - 1;
+  size_ = size;
+}
+
+/**
+ * @brief Unmark all indices, memory is kept for reuse
+ */
+inline void IndexBitmap::reset()
+{
+  std::fill(words_.begin(), words_.end(), Word{0});
+}
+
+inline void IndexBitmap::set(Index index)
+{
+  words_[index / kWordBits] |= Word{1} << (index % kWordBits);
+}
+
+inline bool IndexBitmap::test(Index index) const
+{
+  return (words_[index / kWordBits] >> (index % kWordBits)) & 1;
+}
+
+/**
+ * @brief Mark all indices marked in other, bitmap grows to other's size if it is shorter
+ */
+inline void IndexBitmap::merge(const IndexBitmap &other)
+{
+  if (size_ < other.size_)
+    resize(other.size_);
+
+  for (std::size_t i = 0; i < other.words_.size(); ++i)
+    words_[i] |= other.words_[i];
+}
+
+inline std::size_t IndexBitmap::size() const
+{
+  return size_;
+}
+
+/**
+ * @brief Number of marked indices
+ */
+inline std::size_t IndexBitmap::count() const
+{
+  std::size_t res = 0;
+  for (auto word : words_)
+    res += static_cast<std::size_t>(std::popcount(word));
+
+  return res;
+}
+
+/**
+ * @brief Call visit(index) for every marked index in ascending order
+ */
+template <std::invocable<Index> Visit>
+void IndexBitmap::forEach(Visit visit) const
+{
+  for (std::size_t i = 0; i < words_.size(); ++i)
+    for (auto word = words_[i]; word != 0; word &= word - 1)
+      visit(i * kWordBits + static_cast<std::size_t>(std::countr_zero(word)));
+}
+
+/**
+ * @class PairBuffer
+ * @brief Unordered buffer of intersecting pairs stored in fixed size chunks
+ * @details
+ * Growing buffer never moves pairs already stored, unlike std::vector. Buffers of several
+ * threads are joined by moving chunks, and reset() keeps chunks, so a buffer reused by
+ * queries of similar size doesn't allocate at all.
+ */
+class PairBuffer final
+{
+public:
+  static constexpr std::size_t kChunkSize = 4096;
+
+private:
+  std::vector<std::vector<IndexPair>> chunks_{};
+  std::size_t used_{}; // chunks [0, used_) hold pairs, the rest are spare
+
+public:
+  void push_back(const IndexPair &pair);
+  void emplace_back(Index lhs, Index rhs);
+  void splice(PairBuffer &&other);
+  void reset();
+
+  std::size_t size() const;
+  bool empty() const;
+
+  template <std::invocable<Index, Index> Visit>
+  void forEach(Visit visit) const;
+};
+
+inline void PairBuffer::push_back(const IndexPair &pair)
+{
+  if (used_ == 0 || chunks_[used_ - 1].size() == kChunkSize)
+  {
+    if (used_ == chunks_.size())
+      chunks_.emplace_back().reserve(kChunkSize);
+    ++used_;
+  }
+
+  chunks_[used_ - 1].push_back(pair);
+}
+
+inline void PairBuffer::emplace_back(Index lhs, Index rhs)
+{
+  push_back(IndexPair{lhs, rhs});
+}
+
+/**
+ * @brief Move all pairs of other to this buffer without copying them, other becomes empty
+ */
+inline void PairBuffer::splice(PairBuffer &&other)
+{
+  if (this == &other)
+    return;
+
+  auto pos = chunks_.begin() + static_cast<std::ptrdiff_t>(used_);
+  auto otherUsed = other.chunks_.begin() + static_cast<std::ptrdiff_t>(other.used_);
+  chunks_.insert(pos, std::make_move_iterator(other.chunks_.begin()),
+                 std::make_move_iterator(otherUsed));
+  used_ += other.used_;
+
+  other.chunks_.erase(other.chunks_.begin(), otherUsed);
+  other.used_ = 0;
+}
+
+/**
+ * @brief Drop all pairs, chunks are kept for reuse
+ */
+inline void PairBuffer::reset()
+{
+  for (std::size_t i = 0; i < used_; ++i)
+    chunks_[i].clear();
+  used_ = 0;
+}
+
+inline std::size_t PairBuffer::size() const
+{
+  std::size_t res = 0;
+  for (std::size_t i = 0; i < used_; ++i)
+    res += chunks_[i].size();
+
+  return res;
+}
+
+inline bool PairBuffer::empty() const
+{
+  return 0 == size();
+}
+
+/**
+ * @brief Call visit(lhs, rhs) for every stored pair in order of insertion
+ */
+template <std::invocable<Index, Index> Visit>
+void PairBuffer::forEach(Visit visit) const
+{
+  for (std::size_t i = 0; i < used_; ++i)
+    for (auto [lhs, rhs] : chunks_[i])
+      visit(lhs, rhs);
+}
+
+} // namespace geom::kdtree
+
+#endif // __INCLUDE_KDTREE_SINK_HH__
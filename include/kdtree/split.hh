@@ -0,0 +1,169 @@
+#ifndef __INCLUDE_KDTREE_SPLIT_HH__
+#define __INCLUDE_KDTREE_SPLIT_HH__
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <iterator>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "primitives/primitives.hh"
+
+namespace geom::kdtree
+{
+
+/**
+ * @brief Rule used to choose separation plane of a node
+ */
+enum class SplitPolicy
+{
+  MIDDLE, // cut node's bound box at the middle of its longest dimension
+  SAH     // binned surface area heuristic
+};
+
+template <std::floating_point T>
+struct Split final
+{
+  Axis axis{Axis::NONE};
+  T separator{};
+};
+
+/**
+ * @brief Number of bins per axis used by binned SAH
+ */
+constexpr std::size_t kSahBins = 16;
+
+/**
+ * @brief SAH cost of visiting an internal node
+ */
+template <std::floating_point T>
+constexpr T kSahTraversalCost = 1;
+
+/**
+ * @brief SAH cost of one narrow phase test with a triangle stored in node
+ */
+template <std::floating_point T>
+constexpr T kSahIntersectionCost = 1;
+
+template <std::floating_point T>
+std::pair<T, T> axisExtent(const Triangle<T> &tr, Axis axis);
+
+template <std::floating_point T>
+Split<T> middleSplit(const BoundBox<T> &bb);
+
+/**
+ * @brief Find separation plane minimizing binned SAH cost
+ * @details
+ * Triangles which lie strictly on one side of the plane go to the corresponding child,
+ * others stay in the node. So cost of splitting node with bound box \f$ B \f$ is:
+ * \f[
+ * C = C_{trav} + C_{isect} \cdot \left( \frac{S(B_L)}{S(B)} N_L + \frac{S(B_R)}{S(B)} N_R + N_S
+ * \right)
+ * \f]
+ * Candidate planes are bin boundaries along every axis. Node stays a leaf if the best cost is
+ * not less than the cost of testing all its triangles \f$ C_{isect} \cdot N \f$, in particular
+ * if no candidate separates anything. Middle split is returned for nodes whose bound box has
+ * no area, SAH can't compare candidates there.
+ *
+ * @tparam T - floating point type of coordinates
+ * @tparam It - iterator over triangles' indices
+ * @param[in] bb node's bound box
+ * @param[in] begin first index of node's triangles
+ * @param[in] end index past the last one
+ * @param[in] triangles storage of triangles
+ * @return Split<T> chosen separation plane, axis is Axis::NONE if node should stay a leaf
+ */
+template <std::floating_point T, std::forward_iterator It>
+Split<T> sahSplit(const BoundBox<T> &bb, It begin, It end,
+                  std::type_identity_t<std::span<const Triangle<T>>> triangles);
+
+//============================================================================================
+
+template <std::floating_point T>
+std::pair<T, T> axisExtent(const Triangle<T> &tr, Axis axis)
+{
+  auto axisIdx = static_cast<std::size_t>(axis);
+  return std::minmax({tr[0][axisIdx], tr[1][axisIdx], tr[2][axisIdx]});
+}
+
+template <std::floating_point T>
+Split<T> middleSplit(const BoundBox<T> &bb)
+{
+  auto axis = bb.getMaxDim();
+  return {axis, bb.min(axis) + (bb.max(axis) - bb.min(axis)) / 2};
+}
+
+template <std::floating_point T, std::forward_iterator It>
+Split<T> sahSplit(const BoundBox<T> &bb, It begin, It end,
+                  std::type_identity_t<std::span<const Triangle<T>>> triangles)
+{
+  auto total = static_cast<std::size_t>(std::distance(begin, end));
+  auto area = bb.surfaceArea();
+  if (total == 0 || !(area > 0))
+    return middleSplit(bb);
+
+  Split<T> best{};
+  T bestCost{};
+
+  for (auto axis : {Axis::X, Axis::Y, Axis::Z})
+  {
+    auto low = bb.min(axis);
+    auto extent = bb.max(axis) - low;
+    if (!(extent > 0))
+      continue;
+
+    auto binOf = [low, extent](T coord) {
+      auto bin = static_cast<long long>((coord - low) / extent * static_cast<T>(kSahBins));
+      return static_cast<std::size_t>(std::clamp(bin, 0LL, static_cast<long long>(kSahBins - 1)));
+    };
+
+    /* Count triangles' minimal and maximal coordinates falling into every bin */
+    std::array<std::size_t, kSahBins> minBins{};
+    std::array<std::size_t, kSahBins> maxBins{};
+    for (auto it = begin; it != end; ++it)
+    {
+      auto [trMin, trMax] = axisExtent(triangles[*it], axis);
+      ++minBins[binOf(trMin)];
+      ++maxBins[binOf(trMax)];
+    }
+
+    std::size_t nLeft = 0;
+    std::size_t nRight = total;
+    for (std::size_t bin = 1; bin < kSahBins; ++bin)
+    {
+      nLeft += maxBins[bin - 1];
+      nRight -= minBins[bin - 1];
+
+      auto nStay = total - nLeft - nRight;
+      if (nStay == total)
+        continue;
+
+      auto sep = low + extent * static_cast<T>(bin) / static_cast<T>(kSahBins);
+      auto leftBB = bb;
+      auto rightBB = bb;
+      leftBB.max(axis) = rightBB.min(axis) = sep;
+
+      auto cost = kSahTraversalCost<T> +
+                  kSahIntersectionCost<T> * ((leftBB.surfaceArea() * static_cast<T>(nLeft) +
+                                              rightBB.surfaceArea() * static_cast<T>(nRight)) /
+                                               area +
+                                             static_cast<T>(nStay));
+
+      if (best.axis == Axis::NONE || cost < bestCost)
+      {
+        best = {axis, sep};
+        bestCost = cost;
+      }
+    }
+  }
+
+  auto leafCost = kSahIntersectionCost<T> * static_cast<T>(total);
+  return (best.axis != Axis::NONE && bestCost < leafCost) ? best : Split<T>{};
+}
+
+} // namespace geom::kdtree
+
+#endif // __INCLUDE_KDTREE_SPLIT_HH__
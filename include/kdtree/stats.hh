@@ -0,0 +1,134 @@
+#ifndef __INCLUDE_KDTREE_STATS_HH__
+#define __INCLUDE_KDTREE_STATS_HH__
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <iomanip>
+#include <ostream>
+#include <vector>
+
+namespace geom::kdtree
+{
+
+/**
+ * @class TreeStats
+ * @brief Structure and quality report of KdTree, made by KdTree::stats()
+ */
+template <std::floating_point T>
+struct TreeStats final
+{
+  std::size_t nodeCount{};
+  std::size_t leafCount{};
+  std::size_t maxDepth{};     // depth of the deepest leaf, root has depth 0
+  double averageLeafDepth{};
+
+  /* depthHistogram[d] is number of leaves at depth d */
+  std::vector<std::size_t> depthHistogram{};
+
+  /* occupancyHistogram[0] is number of empty leaves, occupancyHistogram[b] for b > 0 is number
+   * of leaves holding [2^(b - 1), 2^b) triangles */
+  std::vector<std::size_t> occupancyHistogram{};
+  std::size_t maxLeafSize{};
+
+  std::size_t triangleCount{};
+  std::size_t straddlingCount{};     // triangles stored at internal nodes
+  std::size_t maxStraddlingCount{};  // the most triangles stored at one internal node
+  std::size_t spareIndexCount{};     // reserved index slots which aren't used
+
+  std::size_t nodeBytes{};
+  std::size_t indexBytes{};
+  std::size_t triangleBytes{}; // triangles and their prepared narrow phase data
+
+  T sahCost{};
+
+  static std::size_t occupancyBucket(std::size_t leafSize);
+
+  void dump(std::ostream &ost) const;
+};
+
+template <std::floating_point T>
+std::size_t TreeStats<T>::occupancyBucket(std::size_t leafSize)
+{
+  return std::bit_width(leafSize);
+}
+
+/**
+ * @brief Print report in human readable form
+ */
+template <std::floating_point T>
+void TreeStats<T>::dump(std::ostream &ost) const
+{
+  auto flags = ost.flags();
+  ost << "nodes: " << nodeCount << ", leaves: " << leafCount << ", max depth: " << maxDepth
+      << ", average leaf depth: " << std::fixed << std::setprecision(2) << averageLeafDepth << '\n';
+  ost << "triangles: " << triangleCount << ", straddling: " << straddlingCount
+      << ", max at one internal node: " << maxStraddlingCount << '\n';
+  ost << "memory: nodes " << nodeBytes << " B, indices " << indexBytes << " B ("
+      << spareIndexCount << " spare), triangles " << triangleBytes << " B\n";
+  ost << "SAH cost: " << sahCost << '\n';
+
+  ost << "leaves by depth:\n";
+  for (std::size_t depth = 0; depth < depthHistogram.size(); ++depth)
+    if (depthHistogram[depth] != 0)
+      ost << "  " << std::setw(4) << depth << std::setw(12) << depthHistogram[depth] << '\n';
+
+  ost << "leaves by triangle count:\n";
+  for (std::size_t bucket = 0; bucket < occupancyHistogram.size(); ++bucket)
+  {
+    if (occupancyHistogram[bucket] == 0)
+      continue;
+
+    std::size_t lo = bucket == 0 ? 0 : std::size_t{1} << (bucket - 1);
+    std::size_t hi = bucket == 0 ? 0 : (std::size_t{1} << bucket) - 1;
+    ost << "  " << std::setw(8) << lo << " - " << std::left << std::setw(8) << hi << std::right
+        << std::setw(12) << occupancyHistogram[bucket] << '\n';
+  }
+  ost.flags(flags);
+}
+
+/**
+ * @class TuneProfile
+ * @brief How KdTree picked node capacity for a scene when auto tuning is on
+ * @details
+ * Trees with every candidate capacity are built over a sample of the scene and cost of their
+ * build and self-intersection query is estimated by a model, the cheapest candidate wins.
+ */
+struct TuneProfile final
+{
+  std::size_t sceneSize{};
+  std::size_t sampleSize{};
+  std::vector<std::size_t> capacities{}; // candidate node capacities
+  std::vector<double> costs{};           // estimated cost per sampled triangle of every candidate
+  std::size_t nodeCapacity{};            // chosen node capacity
+  std::size_t maxDepth{};                // depth limit of the build
+
+  bool empty() const;
+  void dump(std::ostream &ost) const;
+};
+
+inline bool TuneProfile::empty() const
+{
+  return capacities.empty();
+}
+
+inline void TuneProfile::dump(std::ostream &ost) const
+{
+  if (empty())
+  {
+    ost << "node capacity wasn't tuned\n";
+    return;
+  }
+
+  auto flags = ost.flags();
+  ost << "tuned on " << sampleSize << " of " << sceneSize << " triangles: node capacity "
+      << nodeCapacity << ", max depth " << maxDepth << '\n';
+  for (std::size_t i = 0; i < capacities.size(); ++i)
+    ost << "  capacity " << std::setw(4) << capacities[i] << std::fixed << std::setprecision(2)
+        << std::setw(12) << costs[i] << (capacities[i] == nodeCapacity ? "  *" : "") << '\n';
+  ost.flags(flags);
+}
+
+} // namespace geom::kdtree
+
+#endif // __INCLUDE_KDTREE_STATS_HH__
@@ -0,0 +1,256 @@
+#ifndef __INCLUDE_KDTREE_STORAGE_HH__
+#define __INCLUDE_KDTREE_STORAGE_HH__
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace geom::kdtree
+{
+
+/**
+ * @class Storage
+ * @brief Array which either owns its elements or borrows them from external memory
+ * @details
+ * Borrowed elements are used in place, e.g. straight from a memory mapped file which holder
+ * keeps alive. Const access never copies. The first mutable access copies borrowed elements
+ * into an owned vector (copy on write), so a borrowed tree may still be modified.
+ *
+ * Owned elements are allocated from a std::pmr memory resource given on construction, the
+ * default resource is used otherwise. As with any std::pmr container, a copy uses the default
+ * resource and a moved-to storage keeps its own one.
+ *
+ * @tparam U - trivially copyable type of elements
+ */
+template <typename U>
+class Storage final
+{
+  static_assert(std::is_trivially_copyable_v<U>);
+
+private:
+  std::pmr::vector<U> owned_{};
+  const U *borrowed_{};
+  std::size_t borrowedSize_{};
+  std::shared_ptr<const void> holder_{};
+  bool isBorrowed_{false};
+
+public:
+  using value_type = U;
+  using iterator = typename std::pmr::vector<U>::iterator;
+  using const_iterator = const U *;
+
+  Storage() = default;
+  explicit Storage(std::pmr::memory_resource *resource);
+  Storage(const Storage &) = default;
+  Storage(Storage &&) noexcept = default;
+  Storage &operator=(const Storage &) = default;
+  Storage &operator=(Storage &&) noexcept = default;
+  ~Storage() = default;
+
+  /**
+   * @brief Make storage which borrows size elements at data
+   *
+   * @param[in] data pointer to elements, must be aligned for U
+   * @param[in] size number of elements
+   * @param[in] holder object which keeps data alive, may be empty if caller guarantees it
+   */
+  static Storage borrow(const U *data, std::size_t size, std::shared_ptr<const void> holder);
+
+  Storage &operator=(std::pmr::vector<U> &&vec);
+
+  bool isBorrowed() const;
+  std::pmr::memory_resource *resource() const;
+
+  /**
+   * @brief Get owned vector, borrowed elements are copied into it first
+   */
+  std::pmr::vector<U> &mut();
+
+  const U *data() const;
+  U *data();
+  std::size_t size() const;
+  bool empty() const;
+
+  const U &operator[](std::size_t idx) const;
+  U &operator[](std::size_t idx);
+  const U &front() const;
+
+  const_iterator begin() const;
+  const_iterator end() const;
+  iterator begin();
+  iterator end();
+
+  void clear();
+  void push_back(const U &elem);
+  template <typename... Args>
+  U &emplace_back(Args &&...args);
+  void resize(std::size_t size);
+  template <typename It>
+  void assign(It begin, It end);
+};
+
+template <typename U>
+Storage<U>::Storage(std::pmr::memory_resource *resource) : owned_(resource)
+{}
+
+template <typename U>
+Storage<U> Storage<U>::borrow(const U *data, std::size_t size, std::shared_ptr<const void> holder)
+{
+  Storage res{};
+  res.borrowed_ = data;
+  res.borrowedSize_ = size;
+  res.holder_ = std::move(holder);
+  res.isBorrowed_ = true;
+  return res;
+}
+
+template <typename U>
+Storage<U> &Storage<U>::operator=(std::pmr::vector<U> &&vec)
+{
+  clear();
+  owned_ = std::move(vec);
+  return *this;
+}
+
+template <typename U>
+bool Storage<U>::isBorrowed() const
+{
+  return isBorrowed_;
+}
+
+/**
+ * @brief Get memory resource owned elements are allocated from
+ */
+template <typename U>
+std::pmr::memory_resource *Storage<U>::resource() const
+{
+  return owned_.get_allocator().resource();
+}
+
+template <typename U>
+std::pmr::vector<U> &Storage<U>::mut()
+{
+  if (isBorrowed_)
+  {
+    owned_.assign(borrowed_, borrowed_ + borrowedSize_);
+    borrowed_ = nullptr;
+    borrowedSize_ = 0;
+    holder_.reset();
+    isBorrowed_ = false;
+  }
+
+  return owned_;
+}
+
+template <typename U>
+const U *Storage<U>::data() const
+{
+  return isBorrowed_ ? borrowed_ : owned_.data();
+}
+
+template <typename U>
+U *Storage<U>::data()
+{
+  return mut().data();
+}
+
+template <typename U>
+std::size_t Storage<U>::size() const
+{
+  return isBorrowed_ ? borrowedSize_ : owned_.size();
+}
+
+template <typename U>
+bool Storage<U>::empty() const
+{
+  return 0 == size();
+}
+
+template <typename U>
+const U &Storage<U>::operator[](std::size_t idx) const
+{
+  return data()[idx];
+}
+
+template <typename U>
+U &Storage<U>::operator[](std::size_t idx)
+{
+  return mut()[idx];
+}
+
+template <typename U>
+const U &Storage<U>::front() const
+{
+  return *data();
+}
+
+template <typename U>
+auto Storage<U>::begin() const -> const_iterator
+{
+  return data();
+}
+
+template <typename U>
+auto Storage<U>::end() const -> const_iterator
+{
+  return data() + size();
+}
+
+template <typename U>
+auto Storage<U>::begin() -> iterator
+{
+  return mut().begin();
+}
+
+template <typename U>
+auto Storage<U>::end() -> iterator
+{
+  return mut().end();
+}
+
+/**
+ * @brief Drop all elements, borrowed ones are released without copying
+ */
+template <typename U>
+void Storage<U>::clear()
+{
+  owned_.clear();
+  borrowed_ = nullptr;
+  borrowedSize_ = 0;
+  holder_.reset();
+  isBorrowed_ = false;
+}
+
+template <typename U>
+void Storage<U>::push_back(const U &elem)
+{
+  mut().push_back(elem);
+}
+
+template <typename U>
+template <typename... Args>
+U &Storage<U>::emplace_back(Args &&...args)
+{
+  return mut().emplace_back(std::forward<Args>(args)...);
+}
+
+template <typename U>
+void Storage<U>::resize(std::size_t size)
+{
+  mut().resize(size);
+}
+
+template <typename U>
+template <typename It>
+void Storage<U>::assign(It begin, It end)
+{
+  clear();
+  owned_.assign(begin, end);
+}
+
+} // namespace geom::kdtree
+
+#endif // __INCLUDE_KDTREE_STORAGE_HH__
@@ -1,6 +1,7 @@
 #ifndef __INCLUDE_PRIMITIVES_BOUNDBOX_HH__
 #define __INCLUDE_PRIMITIVES_BOUNDBOX_HH__
 
+#include <algorithm>
 #include <exception>
 #include <iostream>
 
@@ -23,6 +24,8 @@ struct BoundBox final
   T maxZ{};
 
   bool belongsTo(const BoundBox<T> &bb);
+  bool overlaps(const BoundBox<T> &bb) const;
+  void merge(const BoundBox<T> &bb);
 
   T &min(Axis axis) &;
   T &max(Axis axis) &;
@@ -34,6 +37,7 @@ struct BoundBox final
   T max(Axis axis) const &;
 
   Axis getMaxDim() const;
+  T surfaceArea() const;
 
   bool operator==(const BoundBox &rhs) const;
   bool operator!=(const BoundBox &rhs) const;
@@ -46,6 +50,25 @@ bool BoundBox<T>::belongsTo(const BoundBox<T> &bb)
          (maxY <= bb.maxY) && (maxZ <= bb.maxZ);
 }
 
+template <std::floating_point T>
+bool BoundBox<T>::overlaps(const BoundBox<T> &bb) const
+{
+  return (minX <= bb.maxX) && (bb.minX <= maxX) && (minY <= bb.maxY) && (bb.minY <= maxY) &&
+         (minZ <= bb.maxZ) && (bb.minZ <= maxZ);
+}
+
+template <std::floating_point T>
+void BoundBox<T>::merge(const BoundBox<T> &bb)
+{
+  minX = std::min(minX, bb.minX);
+  minY = std::min(minY, bb.minY);
+  minZ = std::min(minZ, bb.minZ);
+
+  maxX = std::max(maxX, bb.maxX);
+  maxY = std::max(maxY, bb.maxY);
+  maxZ = std::max(maxZ, bb.maxZ);
+}
+
 #define BBFILL(minmax)                                                                             \
   do                                                                                               \
   {                                                                                                \
@@ -109,6 +132,15 @@ Axis BoundBox<T>::getMaxDim() const
   });
 }
 
+template <std::floating_point T>
+T BoundBox<T>::surfaceArea() const
+{
+  auto dx = maxX - minX;
+  auto dy = maxY - minY;
+  auto dz = maxZ - minZ;
+  return 2 * (dx * dy + dy * dz + dz * dx);
+}
+
 template <std::floating_point T>
 bool BoundBox<T>::operator==(const BoundBox &rhs) const
 {
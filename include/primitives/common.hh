@@ -24,6 +24,16 @@ enum class Axis : std::int8_t
   NONE
 };
 
+/**
+ * @class ThresComp
+ * @brief Threshold for comparisons of floating point numbers
+ * @details
+ * Threshold set here is only the default one: comparisons which are done for a scene take
+ * threshold explicitly, see KdTree::setThreshold, so concurrent queries with different
+ * tolerances don't share any state. Comparisons without explicit threshold use the default.
+ *
+ * @tparam T - type of numbers
+ */
 template <Number T>
 class ThresComp final
 {
@@ -56,15 +66,25 @@ public:
   static bool isEqual(T lhs, T rhs)
   {
     if constexpr (std::is_floating_point_v<T>)
-      return std::abs(rhs - lhs) < threshold_;
+      return isEqual(lhs, rhs, threshold_);
     else
       return lhs == rhs;
   }
 
+  static bool isEqual(T lhs, T rhs, T thres) requires std::is_floating_point_v<T>
+  {
+    return std::abs(rhs - lhs) < thres;
+  }
+
   static bool isZero(T num)
   {
     return isEqual(num, T{});
   }
+
+  static bool isZero(T num, T thres) requires std::is_floating_point_v<T>
+  {
+    return isEqual(num, T{}, thres);
+  }
 };
 
 template <Number T>
@@ -73,12 +93,24 @@ bool isEqualThreshold(T num1, T num2)
   return ThresComp<T>::isEqual(num1, num2);
 }
 
+template <std::floating_point T>
+bool isEqualThreshold(T num1, T num2, T thres)
+{
+  return ThresComp<T>::isEqual(num1, num2, thres);
+}
+
 template <Number T>
 bool isZeroThreshold(T num)
 {
   return ThresComp<T>::isZero(num);
 }
 
+template <std::floating_point T>
+bool isZeroThreshold(T num, T thres)
+{
+  return ThresComp<T>::isZero(num, thres);
+}
+
 } // namespace geom
 
 #endif // __INCLUDE_PRIMITIVES_COMMON_HH__
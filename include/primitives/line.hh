@@ -97,37 +97,41 @@ public:
    * @brief Checks is point belongs to line
    *
    * @param[in] point const reference to point vector
+   * @param[in] thres comparison threshold
    * @return true if point belongs to line
    * @return false if point doesn't belong to line
    */
-  bool belongs(const Vec3<T> &point) const;
+  bool belongs(const Vec3<T> &point, T thres = ThresComp<T>::getThreshold()) const;
 
   /**
    * @brief Checks is *this equals to another line
    *
    * @param[in] line const reference to another line
+   * @param[in] thres comparison threshold
    * @return true if lines are equal
    * @return false if lines are not equal
    */
-  bool isEqual(const Line &line) const;
+  bool isEqual(const Line &line, T thres = ThresComp<T>::getThreshold()) const;
 
   /**
    * @brief Checks is *this parallel to another line
    * @note Assumes equal lines as parallel
    * @param[in] line const reference to another line
+   * @param[in] thres comparison threshold
    * @return true if lines are parallel
    * @return false if lines are not parallel
    */
-  bool isPar(const Line &line) const;
+  bool isPar(const Line &line, T thres = ThresComp<T>::getThreshold()) const;
 
   /**
    * @brief Checks is *this is skew with another line
    *
    * @param[in] line const reference to another line
+   * @param[in] thres comparison threshold
    * @return true if lines are skew
    * @return false if lines are not skew
    */
-  bool isSkew(const Line<T> &line) const;
+  bool isSkew(const Line<T> &line, T thres = ThresComp<T>::getThreshold()) const;
 
   /**
    * @brief Get line by 2 points
@@ -157,7 +161,8 @@ std::ostream &operator<<(std::ostream &ost, const Line<T> &line)
 template <std::floating_point T>
 Line<T>::Line(const Vec3<T> &org, const Vec3<T> &dir) : org_{org}, dir_{dir}
 {
-  if (dir_ == Vec3<T>{0})
+  /* Exact check, so lines of planes not parallel under any threshold are constructible */
+  if (!(dir_.length2() > T{}))
     throw std::logic_error{"Direction vector equals zero."};
 }
 
@@ -205,28 +210,28 @@ Vec3<T> Line<T>::getPoint(nType t) const
 }
 
 template <std::floating_point T>
-bool Line<T>::belongs(const Vec3<T> &point) const
+bool Line<T>::belongs(const Vec3<T> &point, T thres) const
 {
-  return dir_.cross(point - org_) == Vec3<T>{0};
+  return dir_.cross(point - org_).isEqual(Vec3<T>{0}, thres);
 }
 
 template <std::floating_point T>
-bool Line<T>::isEqual(const Line<T> &line) const
+bool Line<T>::isEqual(const Line<T> &line, T thres) const
 {
-  return belongs(line.org_) && dir_.isPar(line.dir_);
+  return belongs(line.org_, thres) && dir_.isPar(line.dir_, thres);
 }
 
 template <std::floating_point T>
-bool Line<T>::isPar(const Line<T> &line) const
+bool Line<T>::isPar(const Line<T> &line, T thres) const
 {
-  return dir_.isPar(line.dir_);
+  return dir_.isPar(line.dir_, thres);
 }
 
 template <std::floating_point T>
-bool Line<T>::isSkew(const Line<T> &line) const
+bool Line<T>::isSkew(const Line<T> &line, T thres) const
 {
   auto res = triple(line.org_ - org_, dir_, line.dir_);
-  return !isZeroThreshold(res);
+  return !isZeroThreshold(res, thres);
 }
 
 template <std::floating_point T>
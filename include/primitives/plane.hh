@@ -86,37 +86,41 @@ public:
    * @brief Checks if point belongs to plane
    *
    * @param[in] point const referene to point vector
+   * @param[in] thres comparison threshold
    * @return true if point belongs to plane
    * @return false if point doesn't belong to plane
    */
-  bool belongs(const Vec3<T> &point) const;
+  bool belongs(const Vec3<T> &point, T thres = ThresComp<T>::getThreshold()) const;
 
   /**
    * @brief Checks if line belongs to plane
    *
    * @param[in] line const referene to line
+   * @param[in] thres comparison threshold
    * @return true if line belongs to plane
    * @return false if line doesn't belong to plane
    */
-  bool belongs(const Line<T> &line) const;
+  bool belongs(const Line<T> &line, T thres = ThresComp<T>::getThreshold()) const;
 
   /**
    * @brief Checks is *this equals to another plane
    *
    * @param[in] rhs const reference to another plane
+   * @param[in] thres comparison threshold
    * @return true if planes are equal
    * @return false if planes are not equal
    */
-  bool isEqual(const Plane &rhs) const;
+  bool isEqual(const Plane &rhs, T thres = ThresComp<T>::getThreshold()) const;
 
   /**
    * @brief Checks is *this is parallel to another plane
    *
    * @param[in] rhs const reference to another plane
+   * @param[in] thres comparison threshold
    * @return true if planes are parallel
    * @return false if planes are not parallel
    */
-  bool isPar(const Plane &rhs) const;
+  bool isPar(const Plane &rhs, T thres = ThresComp<T>::getThreshold()) const;
 
   /**
    * @brief Get plane by 3 points
@@ -175,7 +179,8 @@ std::ostream &operator<<(std::ostream &ost, const Plane<T> &pl)
 template <std::floating_point T>
 Plane<T>::Plane(const Vec3<T> &norm, T dist) : norm_(norm), dist_(dist)
 {
-  if (norm == Vec3<T>{0})
+  /* Exact check, so planes of triangles valid under any threshold are constructible */
+  if (!(norm.length2() > T{}))
     throw std::logic_error{"normal vector equals to zero"};
 }
 
@@ -210,27 +215,27 @@ Vec3<T> &&Plane<T>::norm() &&
 }
 
 template <std::floating_point T>
-bool Plane<T>::belongs(const Vec3<T> &pt) const
+bool Plane<T>::belongs(const Vec3<T> &pt, T thres) const
 {
-  return isEqualThreshold(norm_.dot(pt), dist_);
+  return isEqualThreshold(norm_.dot(pt), dist_, thres);
 }
 
 template <std::floating_point T>
-bool Plane<T>::belongs(const Line<T> &line) const
+bool Plane<T>::belongs(const Line<T> &line, T thres) const
 {
-  return norm_.isPerp(line.dir()) && belongs(line.org());
+  return norm_.isPerp(line.dir(), thres) && belongs(line.org(), thres);
 }
 
 template <std::floating_point T>
-bool Plane<T>::isEqual(const Plane &rhs) const
+bool Plane<T>::isEqual(const Plane &rhs, T thres) const
 {
-  return (norm_ * dist_ == rhs.norm_ * rhs.dist_) && (norm_.isPar(rhs.norm_));
+  return (norm_ * dist_).isEqual(rhs.norm_ * rhs.dist_, thres) && norm_.isPar(rhs.norm_, thres);
 }
 
 template <std::floating_point T>
-bool Plane<T>::isPar(const Plane &rhs) const
+bool Plane<T>::isPar(const Plane &rhs, T thres) const
 {
-  return norm_.isPar(rhs.norm_);
+  return norm_.isPar(rhs.norm_, thres);
 }
 
 template <std::floating_point T>
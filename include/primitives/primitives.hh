@@ -6,6 +6,7 @@
 #include "line.hh"
 #include "plane.hh"
 #include "triangle.hh"
+#include "trianglesoa.hh"
 #include "vec3.hh"
 
 #endif // __INCLUDE_PRIMITIVES_PRIMITIVES_HH__
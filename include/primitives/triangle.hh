@@ -107,17 +107,19 @@ public:
   /**
    * @brief Check is triangle valid
    *
+   * @param[in] thres comparison threshold
    * @return true if triangle is valid
    * @return false if triangle is invalid
    */
-  bool isValid() const;
+  bool isValid(T thres = ThresComp<T>::getThreshold()) const;
 
   /**
    * @brief Returns triangle's bound box
    *
+   * @param[in] thres box is widened by this value
    * @return BoundBox<T>
    */
-  BoundBox<T> boundBox() const;
+  BoundBox<T> boundBox(T thres = ThresComp<T>::getThreshold()) const;
 
   /**
    * @brief Checks if this Triangle belongs to BoundBox
@@ -214,26 +216,24 @@ Plane<T> Triangle<T>::getPlane() const
 }
 
 template <std::floating_point T>
-bool Triangle<T>::isValid() const
+bool Triangle<T>::isValid(T thres) const
 {
   auto edge1 = vertices_[1] - vertices_[0];
   auto edge2 = vertices_[2] - vertices_[0];
 
   auto cross12 = cross(edge1, edge2);
-  return (cross12 != Vec3<T>{});
+  return !cross12.isEqual(Vec3<T>{}, thres);
 }
 
 template <std::floating_point T>
-BoundBox<T> Triangle<T>::boundBox() const
+BoundBox<T> Triangle<T>::boundBox(T thres) const
 {
   auto minMaxX = std::minmax({vertices_[0].x, vertices_[1].x, vertices_[2].x});
   auto minMaxY = std::minmax({vertices_[0].y, vertices_[1].y, vertices_[2].y});
   auto minMaxZ = std::minmax({vertices_[0].z, vertices_[1].z, vertices_[2].z});
 
-  return {
-    minMaxX.first - ThresComp<T>::getThreshold(), minMaxX.second + ThresComp<T>::getThreshold(),
-    minMaxY.first - ThresComp<T>::getThreshold(), minMaxY.second + ThresComp<T>::getThreshold(),
-    minMaxZ.first - ThresComp<T>::getThreshold(), minMaxZ.second + ThresComp<T>::getThreshold()};
+  return {minMaxX.first - thres, minMaxX.second + thres, minMaxY.first - thres,
+          minMaxY.second + thres, minMaxZ.first - thres, minMaxZ.second + thres};
 }
 
 template <std::floating_point T>
@@ -0,0 +1,431 @@
+#ifndef __INCLUDE_PRIMITIVES_TRIANGLESOA_HH__
+#define __INCLUDE_PRIMITIVES_TRIANGLESOA_HH__
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <vector>
+
+#include "boundbox.hh"
+#include "common.hh"
+#include "triangle.hh"
+#include "vec3.hh"
+
+/**
+ * @brief trianglesoa.hh
+ * Structure-of-arrays triangle container implementation
+ */
+
+namespace geom
+{
+
+/**
+ * @brief Alignment of TriangleSoA's coordinate streams, enough for 512-bit vector loads
+ */
+constexpr std::size_t kSoAAlign = 64;
+
+/**
+ * @class AlignedAllocator
+ * @brief Allocator which returns memory aligned to Align bytes
+ *
+ * @tparam U - type of elements
+ * @tparam Align - alignment in bytes
+ */
+template <typename U, std::size_t Align>
+struct AlignedAllocator
+{
+  using value_type = U;
+
+  template <typename V>
+  struct rebind
+  {
+    using other = AlignedAllocator<V, Align>;
+  };
+
+  AlignedAllocator() = default;
+  template <typename V>
+  AlignedAllocator(const AlignedAllocator<V, Align> &)
+  {}
+
+  U *allocate(std::size_t n)
+  {
+    return static_cast<U *>(::operator new(n * sizeof(U), std::align_val_t{Align}));
+  }
+
+  void deallocate(U *ptr, std::size_t)
+  {
+    ::operator delete(ptr, std::align_val_t{Align});
+  }
+
+  template <typename V>
+  bool operator==(const AlignedAllocator<V, Align> &) const
+  {
+    return true;
+  }
+};
+
+/**
+ * @class TriangleSoA
+ * @brief Triangles stored in structure-of-arrays layout
+ * @details
+ * Every coordinate of every vertex lives in its own stream: x(k)[i] is x coordinate of k-th
+ * vertex of i-th triangle. Streams are aligned to kSoAAlign and padded up to a multiple of
+ * kWidth lanes, so a loop over paddedSize() lanes may use full vector loads and needs no tail.
+ * Padding lanes are filled with quiet NaN, so every comparison with them is false.
+ *
+ * @tparam T - floating point type of coordinates
+ */
+template <std::floating_point T>
+class TriangleSoA final
+{
+public:
+  /**
+   * @brief Number of lanes in one aligned vector of kSoAAlign bytes
+   */
+  static constexpr std::size_t kWidth = kSoAAlign / sizeof(T);
+
+  class ConstIterator;
+
+private:
+  using Stream = std::vector<T, AlignedAllocator<T, kSoAAlign>>;
+
+  std::array<Stream, 3> x_{}; // x_[k] holds x coordinates of k-th vertices
+  std::array<Stream, 3> y_{};
+  std::array<Stream, 3> z_{};
+  std::size_t size_{};
+
+public:
+  /**
+   * @brief Construct an empty container
+   */
+  TriangleSoA() = default;
+
+  /**
+   * @brief Construct container from initializer list of triangles
+   *
+   * @param[in] il initializer list
+   */
+  TriangleSoA(std::initializer_list<Triangle<T>> il);
+
+  /**
+   * @brief Construct container from range of triangles
+   *
+   * @tparam It - input iterator type
+   * @param[in] begin begin of range
+   * @param[in] end end of range
+   */
+  template <std::input_iterator It>
+  TriangleSoA(It begin, It end);
+
+  /**
+   * @brief Get number of stored triangles
+   */
+  std::size_t size() const;
+
+  /**
+   * @brief Get number of lanes in every stream including padding
+   */
+  std::size_t paddedSize() const;
+
+  bool empty() const;
+
+  /**
+   * @brief Reserve space for cap triangles
+   *
+   * @param[in] cap number of triangles
+   */
+  void reserve(std::size_t cap);
+
+  void clear();
+
+  /**
+   * @brief Change number of stored triangles
+   * @details New triangles have all coordinates equal to zero, lanes left after shrinking
+   * become padding
+   *
+   * @param[in] count new number of triangles
+   */
+  void resize(std::size_t count);
+
+  /**
+   * @brief Append triangle to the end of container
+   *
+   * @param[in] tr triangle to append
+   */
+  void push_back(const Triangle<T> &tr);
+
+  /**
+   * @brief Gather idx-th triangle from streams
+   *
+   * @param[in] idx index of triangle
+   * @return Triangle<T>
+   */
+  Triangle<T> operator[](std::size_t idx) const;
+
+  /**
+   * @brief Compute idx-th triangle's bound box as Triangle::boundBox() does
+   *
+   * @param[in] idx index of triangle
+   * @param[in] thres box is widened by this value
+   * @return BoundBox<T>
+   */
+  BoundBox<T> boundBox(std::size_t idx, T thres = ThresComp<T>::getThreshold()) const;
+
+  /**
+   * @brief Get stream of x coordinates of vertex-th vertices
+   *
+   * @param[in] vertex index of vertex
+   * @return pointer to paddedSize() coordinates aligned to kSoAAlign
+   */
+  const T *x(std::size_t vertex) const;
+  const T *y(std::size_t vertex) const;
+  const T *z(std::size_t vertex) const;
+
+  /**
+   * @brief Get mutable stream of x coordinates of vertex-th vertices
+   * @details Only first size() lanes may be written, padding lanes must stay NaN
+   */
+  T *x(std::size_t vertex);
+  T *y(std::size_t vertex);
+  T *z(std::size_t vertex);
+
+  ConstIterator begin() const;
+  ConstIterator end() const;
+
+  /**
+   * @class ConstIterator
+   * @brief Iterator which gathers triangles from streams
+   */
+  class ConstIterator final
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = Triangle<T>;
+    using reference = Triangle<T>;
+
+  private:
+    const TriangleSoA *soa_{};
+    std::size_t idx_{};
+
+  public:
+    ConstIterator() = default;
+    ConstIterator(const TriangleSoA *soa, std::size_t idx);
+
+    ConstIterator &operator++();
+    ConstIterator operator++(int);
+
+    reference operator*() const;
+
+    bool operator==(const ConstIterator &rhs) const = default;
+  };
+
+private:
+  void pad();
+};
+
+template <std::floating_point T>
+TriangleSoA<T>::TriangleSoA(std::initializer_list<Triangle<T>> il)
+  : TriangleSoA(il.begin(), il.end())
+{}
+
+template <std::floating_point T>
+template <std::input_iterator It>
+TriangleSoA<T>::TriangleSoA(It begin, It end)
+{
+  if constexpr (std::forward_iterator<It>)
+    reserve(static_cast<std::size_t>(std::distance(begin, end)));
+
+  for (; begin != end; ++begin)
+    push_back(*begin);
+}
+
+template <std::floating_point T>
+std::size_t TriangleSoA<T>::size() const
+{
+  return size_;
+}
+
+template <std::floating_point T>
+std::size_t TriangleSoA<T>::paddedSize() const
+{
+  return x_[0].size();
+}
+
+template <std::floating_point T>
+bool TriangleSoA<T>::empty() const
+{
+  return 0 == size_;
+}
+
+template <std::floating_point T>
+void TriangleSoA<T>::reserve(std::size_t cap)
+{
+  auto padded = (cap + kWidth - 1) / kWidth * kWidth;
+  for (auto *streams : {&x_, &y_, &z_})
+    for (auto &stream : *streams)
+      stream.reserve(padded);
+}
+
+template <std::floating_point T>
+void TriangleSoA<T>::clear()
+{
+  for (auto *streams : {&x_, &y_, &z_})
+    for (auto &stream : *streams)
+      stream.clear();
+
+  size_ = 0;
+}
+
+template <std::floating_point T>
+void TriangleSoA<T>::resize(std::size_t count)
+{
+  auto padded = (count + kWidth - 1) / kWidth * kWidth;
+  for (auto *streams : {&x_, &y_, &z_})
+    for (auto &stream : *streams)
+    {
+      stream.resize(padded, std::numeric_limits<T>::quiet_NaN());
+      auto *data = stream.data();
+      if (count > size_)
+        std::fill(data + size_, data + count, T{0});
+      else
+        std::fill(data + count, data + std::min(size_, padded),
+                  std::numeric_limits<T>::quiet_NaN());
+    }
+
+  size_ = count;
+}
+
+template <std::floating_point T>
+void TriangleSoA<T>::push_back(const Triangle<T> &tr)
+{
+  if (size_ == paddedSize())
+    pad();
+
+  for (std::size_t k = 0; k < 3; ++k)
+  {
+    x_[k][size_] = tr[k].x;
+    y_[k][size_] = tr[k].y;
+    z_[k][size_] = tr[k].z;
+  }
+
+  ++size_;
+}
+
+template <std::floating_point T>
+Triangle<T> TriangleSoA<T>::operator[](std::size_t idx) const
+{
+  return {{x_[0][idx], y_[0][idx], z_[0][idx]},
+          {x_[1][idx], y_[1][idx], z_[1][idx]},
+          {x_[2][idx], y_[2][idx], z_[2][idx]}};
+}
+
+template <std::floating_point T>
+BoundBox<T> TriangleSoA<T>::boundBox(std::size_t idx, T thres) const
+{
+  auto minMaxX = std::minmax({x_[0][idx], x_[1][idx], x_[2][idx]});
+  auto minMaxY = std::minmax({y_[0][idx], y_[1][idx], y_[2][idx]});
+  auto minMaxZ = std::minmax({z_[0][idx], z_[1][idx], z_[2][idx]});
+
+  return {minMaxX.first - thres, minMaxX.second + thres, minMaxY.first - thres,
+          minMaxY.second + thres, minMaxZ.first - thres, minMaxZ.second + thres};
+}
+
+template <std::floating_point T>
+const T *TriangleSoA<T>::x(std::size_t vertex) const
+{
+  return x_[vertex % 3].data();
+}
+
+template <std::floating_point T>
+const T *TriangleSoA<T>::y(std::size_t vertex) const
+{
+  return y_[vertex % 3].data();
+}
+
+template <std::floating_point T>
+const T *TriangleSoA<T>::z(std::size_t vertex) const
+{
+  return z_[vertex % 3].data();
+}
+
+template <std::floating_point T>
+T *TriangleSoA<T>::x(std::size_t vertex)
+{
+  return x_[vertex % 3].data();
+}
+
+template <std::floating_point T>
+T *TriangleSoA<T>::y(std::size_t vertex)
+{
+  return y_[vertex % 3].data();
+}
+
+template <std::floating_point T>
+T *TriangleSoA<T>::z(std::size_t vertex)
+{
+  return z_[vertex % 3].data();
+}
+
+template <std::floating_point T>
+auto TriangleSoA<T>::begin() const -> ConstIterator
+{
+  return ConstIterator{this, 0};
+}
+
+template <std::floating_point T>
+auto TriangleSoA<T>::end() const -> ConstIterator
+{
+  return ConstIterator{this, size_};
+}
+
+/**
+ * @brief Append kWidth padding lanes filled with quiet NaN to every stream
+ */
+template <std::floating_point T>
+void TriangleSoA<T>::pad()
+{
+  auto padded = paddedSize() + kWidth;
+  for (auto *streams : {&x_, &y_, &z_})
+    for (auto &stream : *streams)
+      stream.resize(padded, std::numeric_limits<T>::quiet_NaN());
+}
+
+//============================================================================================
+//                                  ConstIterator definitions
+//============================================================================================
+
+template <std::floating_point T>
+TriangleSoA<T>::ConstIterator::ConstIterator(const TriangleSoA *soa, std::size_t idx)
+  : soa_(soa), idx_(idx)
+{}
+
+template <std::floating_point T>
+auto TriangleSoA<T>::ConstIterator::operator++() -> ConstIterator &
+{
+  ++idx_;
+  return *this;
+}
+
+template <std::floating_point T>
+auto TriangleSoA<T>::ConstIterator::operator++(int) -> ConstIterator
+{
+  auto tmp = *this;
+  ++idx_;
+  return tmp;
+}
+
+template <std::floating_point T>
+auto TriangleSoA<T>::ConstIterator::operator*() const -> reference
+{
+  return (*soa_)[idx_];
+}
+
+} // namespace geom
+
+#endif // __INCLUDE_PRIMITIVES_TRIANGLESOA_HH__
@@ -189,28 +189,31 @@ struct Vec2 final
    * @brief Check if vector is parallel to another
    *
    * @param[in] rhs vector to check parallelism with
+   * @param[in] thres comparison threshold
    * @return true if vector is parallel
    * @return false otherwise
    */
-  bool isPar(const Vec2 &rhs) const;
+  bool isPar(const Vec2 &rhs, T thres = ThresComp<T>::getThreshold()) const;
 
   /**
    * @brief Check if vector is perpendicular to another
    *
    * @param[in] rhs vector to check perpendicularity with
+   * @param[in] thres comparison threshold
    * @return true if vector is perpendicular
    * @return false otherwise
    */
-  bool isPerp(const Vec2 &rhs) const;
+  bool isPerp(const Vec2 &rhs, T thres = ThresComp<T>::getThreshold()) const;
 
   /**
    * @brief Check if vector is equal to another
    *
    * @param[in] rhs vector to check equality with
+   * @param[in] thres comparison threshold
    * @return true if vector is equal
    * @return false otherwise
    */
-  bool isEqual(const Vec2 &rhs) const;
+  bool isEqual(const Vec2 &rhs, T thres = ThresComp<T>::getThreshold()) const;
 };
 
 /**
@@ -420,7 +423,8 @@ template <std::floating_point T>
 Vec2<T> &Vec2<T>::normalize() &
 {
   T len2 = length2();
-  if (isZeroThreshold(len2) || isEqualThreshold(len2, T{1}))
+  /* Only exact zero is kept as is */
+  if (!(len2 > T{}) || isEqualThreshold(len2, T{1}))
     return *this;
   return *this /= std::sqrt(len2);
 }
@@ -468,22 +472,22 @@ T &&Vec2<T>::operator[](std::size_t i) &&
 }
 
 template <std::floating_point T>
-bool Vec2<T>::isPar(const Vec2 &rhs) const
+bool Vec2<T>::isPar(const Vec2 &rhs, T thres) const
 {
   auto det = x * rhs.y - rhs.x * y;
-  return isZeroThreshold(det);
+  return isZeroThreshold(det, thres);
 }
 
 template <std::floating_point T>
-bool Vec2<T>::isPerp(const Vec2 &rhs) const
+bool Vec2<T>::isPerp(const Vec2 &rhs, T thres) const
 {
-  return isZeroThreshold(dot(rhs));
+  return isZeroThreshold(dot(rhs), thres);
 }
 
 template <std::floating_point T>
-bool Vec2<T>::isEqual(const Vec2 &rhs) const
+bool Vec2<T>::isEqual(const Vec2 &rhs, T thres) const
 {
-  return isEqualThreshold(x, rhs.x) && isEqualThreshold(y, rhs.y);
+  return isEqualThreshold(x, rhs.x, thres) && isEqualThreshold(y, rhs.y, thres);
 }
 
 } // namespace geom
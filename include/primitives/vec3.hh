@@ -191,28 +191,31 @@ struct Vec3 final
    * @brief Check if vector is parallel to another
    *
    * @param[in] rhs vector to check parallelism with
+   * @param[in] thres comparison threshold
    * @return true if vector is parallel
    * @return false otherwise
    */
-  bool isPar(const Vec3 &rhs) const;
+  bool isPar(const Vec3 &rhs, T thres = ThresComp<T>::getThreshold()) const;
 
   /**
    * @brief Check if vector is perpendicular to another
    *
    * @param[in] rhs vector to check perpendicularity with
+   * @param[in] thres comparison threshold
    * @return true if vector is perpendicular
    * @return false otherwise
    */
-  bool isPerp(const Vec3 &rhs) const;
+  bool isPerp(const Vec3 &rhs, T thres = ThresComp<T>::getThreshold()) const;
 
   /**
    * @brief Check if vector is equal to another
    *
    * @param[in] rhs vector to check equality with
+   * @param[in] thres comparison threshold
    * @return true if vector is equal
    * @return false otherwise
    */
-  bool isEqual(const Vec3 &rhs) const;
+  bool isEqual(const Vec3 &rhs, T thres = ThresComp<T>::getThreshold()) const;
 };
 
 /**
@@ -472,7 +475,9 @@ template <std::floating_point T>
 Vec3<T> &Vec3<T>::normalize() &
 {
   T len2 = length2();
-  if (isZeroThreshold(len2) || isEqualThreshold(len2, T{1}))
+  /* Only exact zero is kept, tiny vectors may be normal of a triangle valid under a small
+   * threshold */
+  if (!(len2 > T{}) || isEqualThreshold(len2, T{1}))
     return *this;
   return *this /= std::sqrt(len2);
 }
@@ -526,21 +531,22 @@ T &&Vec3<T>::operator[](std::size_t i) &&
 }
 
 template <std::floating_point T>
-bool Vec3<T>::isPar(const Vec3 &rhs) const
+bool Vec3<T>::isPar(const Vec3 &rhs, T thres) const
 {
-  return cross(rhs).isEqual(Vec3<T>{0});
+  return cross(rhs).isEqual(Vec3<T>{0}, thres);
 }
 
 template <std::floating_point T>
-bool Vec3<T>::isPerp(const Vec3 &rhs) const
+bool Vec3<T>::isPerp(const Vec3 &rhs, T thres) const
 {
-  return isZeroThreshold(dot(rhs));
+  return isZeroThreshold(dot(rhs), thres);
 }
 
 template <std::floating_point T>
-bool Vec3<T>::isEqual(const Vec3 &rhs) const
+bool Vec3<T>::isEqual(const Vec3 &rhs, T thres) const
 {
-  return isEqualThreshold(x, rhs.x) && isEqualThreshold(y, rhs.y) && isEqualThreshold(z, rhs.z);
+  return isEqualThreshold(x, rhs.x, thres) && isEqualThreshold(y, rhs.y, thres) &&
+         isEqualThreshold(z, rhs.z, thres);
 }
 
 } // namespace geom
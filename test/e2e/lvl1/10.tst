@@ -3999,5 +3999,499 @@
 3.936 2.672 75.1994
 0 -0.68 75.1994
 
-#RUN: %lvl1 < %s
-#ANSWER: unknown
+#RUN: %lvl1 < %s | %fc %s
+#CHECK:      3
+#CHECK-NEXT: 4
+#CHECK-NEXT: 9
+#CHECK-NEXT: 10
+#CHECK-NEXT: 14
+#CHECK-NEXT: 15
+#CHECK-NEXT: 23
+#CHECK-NEXT: 24
+#CHECK-NEXT: 27
+#CHECK-NEXT: 28
+#CHECK-NEXT: 29
+#CHECK-NEXT: 30
+#CHECK-NEXT: 31
+#CHECK-NEXT: 32
+#CHECK-NEXT: 33
+#CHECK-NEXT: 34
+#CHECK-NEXT: 36
+#CHECK-NEXT: 37
+#CHECK-NEXT: 41
+#CHECK-NEXT: 42
+#CHECK-NEXT: 43
+#CHECK-NEXT: 44
+#CHECK-NEXT: 45
+#CHECK-NEXT: 46
+#CHECK-NEXT: 47
+#CHECK-NEXT: 48
+#CHECK-NEXT: 50
+#CHECK-NEXT: 51
+#CHECK-NEXT: 55
+#CHECK-NEXT: 56
+#CHECK-NEXT: 60
+#CHECK-NEXT: 61
+#CHECK-NEXT: 63
+#CHECK-NEXT: 64
+#CHECK-NEXT: 70
+#CHECK-NEXT: 71
+#CHECK-NEXT: 72
+#CHECK-NEXT: 73
+#CHECK-NEXT: 75
+#CHECK-NEXT: 76
+#CHECK-NEXT: 77
+#CHECK-NEXT: 78
+#CHECK-NEXT: 79
+#CHECK-NEXT: 80
+#CHECK-NEXT: 81
+#CHECK-NEXT: 82
+#CHECK-NEXT: 86
+#CHECK-NEXT: 87
+#CHECK-NEXT: 93
+#CHECK-NEXT: 94
+#CHECK-NEXT: 97
+#CHECK-NEXT: 98
+#CHECK-NEXT: 100
+#CHECK-NEXT: 101
+#CHECK-NEXT: 102
+#CHECK-NEXT: 103
+#CHECK-NEXT: 106
+#CHECK-NEXT: 107
+#CHECK-NEXT: 111
+#CHECK-NEXT: 112
+#CHECK-NEXT: 114
+#CHECK-NEXT: 115
+#CHECK-NEXT: 116
+#CHECK-NEXT: 117
+#CHECK-NEXT: 119
+#CHECK-NEXT: 120
+#CHECK-NEXT: 123
+#CHECK-NEXT: 124
+#CHECK-NEXT: 126
+#CHECK-NEXT: 127
+#CHECK-NEXT: 129
+#CHECK-NEXT: 130
+#CHECK-NEXT: 132
+#CHECK-NEXT: 133
+#CHECK-NEXT: 135
+#CHECK-NEXT: 136
+#CHECK-NEXT: 138
+#CHECK-NEXT: 139
+#CHECK-NEXT: 142
+#CHECK-NEXT: 143
+#CHECK-NEXT: 150
+#CHECK-NEXT: 151
+#CHECK-NEXT: 152
+#CHECK-NEXT: 153
+#CHECK-NEXT: 155
+#CHECK-NEXT: 156
+#CHECK-NEXT: 160
+#CHECK-NEXT: 161
+#CHECK-NEXT: 165
+#CHECK-NEXT: 166
+#CHECK-NEXT: 169
+#CHECK-NEXT: 170
+#CHECK-NEXT: 171
+#CHECK-NEXT: 172
+#CHECK-NEXT: 174
+#CHECK-NEXT: 175
+#CHECK-NEXT: 180
+#CHECK-NEXT: 181
+#CHECK-NEXT: 183
+#CHECK-NEXT: 184
+#CHECK-NEXT: 185
+#CHECK-NEXT: 186
+#CHECK-NEXT: 190
+#CHECK-NEXT: 191
+#CHECK-NEXT: 193
+#CHECK-NEXT: 194
+#CHECK-NEXT: 196
+#CHECK-NEXT: 197
+#CHECK-NEXT: 201
+#CHECK-NEXT: 202
+#CHECK-NEXT: 208
+#CHECK-NEXT: 209
+#CHECK-NEXT: 215
+#CHECK-NEXT: 216
+#CHECK-NEXT: 222
+#CHECK-NEXT: 223
+#CHECK-NEXT: 227
+#CHECK-NEXT: 228
+#CHECK-NEXT: 232
+#CHECK-NEXT: 233
+#CHECK-NEXT: 235
+#CHECK-NEXT: 236
+#CHECK-NEXT: 242
+#CHECK-NEXT: 243
+#CHECK-NEXT: 244
+#CHECK-NEXT: 245
+#CHECK-NEXT: 246
+#CHECK-NEXT: 247
+#CHECK-NEXT: 248
+#CHECK-NEXT: 249
+#CHECK-NEXT: 256
+#CHECK-NEXT: 257
+#CHECK-NEXT: 260
+#CHECK-NEXT: 261
+#CHECK-NEXT: 264
+#CHECK-NEXT: 265
+#CHECK-NEXT: 267
+#CHECK-NEXT: 268
+#CHECK-NEXT: 269
+#CHECK-NEXT: 270
+#CHECK-NEXT: 273
+#CHECK-NEXT: 274
+#CHECK-NEXT: 278
+#CHECK-NEXT: 279
+#CHECK-NEXT: 281
+#CHECK-NEXT: 282
+#CHECK-NEXT: 291
+#CHECK-NEXT: 292
+#CHECK-NEXT: 293
+#CHECK-NEXT: 294
+#CHECK-NEXT: 299
+#CHECK-NEXT: 300
+#CHECK-NEXT: 303
+#CHECK-NEXT: 304
+#CHECK-NEXT: 306
+#CHECK-NEXT: 307
+#CHECK-NEXT: 311
+#CHECK-NEXT: 312
+#CHECK-NEXT: 313
+#CHECK-NEXT: 314
+#CHECK-NEXT: 318
+#CHECK-NEXT: 319
+#CHECK-NEXT: 320
+#CHECK-NEXT: 321
+#CHECK-NEXT: 324
+#CHECK-NEXT: 325
+#CHECK-NEXT: 333
+#CHECK-NEXT: 334
+#CHECK-NEXT: 335
+#CHECK-NEXT: 336
+#CHECK-NEXT: 340
+#CHECK-NEXT: 341
+#CHECK-NEXT: 344
+#CHECK-NEXT: 345
+#CHECK-NEXT: 349
+#CHECK-NEXT: 350
+#CHECK-NEXT: 353
+#CHECK-NEXT: 354
+#CHECK-NEXT: 355
+#CHECK-NEXT: 356
+#CHECK-NEXT: 357
+#CHECK-NEXT: 358
+#CHECK-NEXT: 361
+#CHECK-NEXT: 362
+#CHECK-NEXT: 363
+#CHECK-NEXT: 364
+#CHECK-NEXT: 366
+#CHECK-NEXT: 367
+#CHECK-NEXT: 371
+#CHECK-NEXT: 372
+#CHECK-NEXT: 375
+#CHECK-NEXT: 376
+#CHECK-NEXT: 377
+#CHECK-NEXT: 378
+#CHECK-NEXT: 380
+#CHECK-NEXT: 381
+#CHECK-NEXT: 388
+#CHECK-NEXT: 389
+#CHECK-NEXT: 393
+#CHECK-NEXT: 394
+#CHECK-NEXT: 395
+#CHECK-NEXT: 396
+#CHECK-NEXT: 397
+#CHECK-NEXT: 398
+#CHECK-NEXT: 406
+#CHECK-NEXT: 407
+#CHECK-NEXT: 408
+#CHECK-NEXT: 409
+#CHECK-NEXT: 412
+#CHECK-NEXT: 413
+#CHECK-NEXT: 418
+#CHECK-NEXT: 419
+#CHECK-NEXT: 421
+#CHECK-NEXT: 422
+#CHECK-NEXT: 429
+#CHECK-NEXT: 430
+#CHECK-NEXT: 431
+#CHECK-NEXT: 432
+#CHECK-NEXT: 439
+#CHECK-NEXT: 440
+#CHECK-NEXT: 447
+#CHECK-NEXT: 448
+#CHECK-NEXT: 451
+#CHECK-NEXT: 452
+#CHECK-NEXT: 453
+#CHECK-NEXT: 454
+#CHECK-NEXT: 455
+#CHECK-NEXT: 456
+#CHECK-NEXT: 457
+#CHECK-NEXT: 458
+#CHECK-NEXT: 462
+#CHECK-NEXT: 463
+#CHECK-NEXT: 465
+#CHECK-NEXT: 466
+#CHECK-NEXT: 468
+#CHECK-NEXT: 469
+#CHECK-NEXT: 473
+#CHECK-NEXT: 474
+#CHECK-NEXT: 477
+#CHECK-NEXT: 478
+#CHECK-NEXT: 484
+#CHECK-NEXT: 485
+#CHECK-NEXT: 486
+#CHECK-NEXT: 487
+#CHECK-NEXT: 490
+#CHECK-NEXT: 491
+#CHECK-NEXT: 496
+#CHECK-NEXT: 497
+#CHECK-NEXT: 499
+#CHECK-NEXT: 500
+#CHECK-NEXT: 504
+#CHECK-NEXT: 505
+#CHECK-NEXT: 509
+#CHECK-NEXT: 510
+#CHECK-NEXT: 517
+#CHECK-NEXT: 518
+#CHECK-NEXT: 525
+#CHECK-NEXT: 526
+#CHECK-NEXT: 528
+#CHECK-NEXT: 529
+#CHECK-NEXT: 530
+#CHECK-NEXT: 531
+#CHECK-NEXT: 533
+#CHECK-NEXT: 534
+#CHECK-NEXT: 536
+#CHECK-NEXT: 537
+#CHECK-NEXT: 538
+#CHECK-NEXT: 539
+#CHECK-NEXT: 540
+#CHECK-NEXT: 541
+#CHECK-NEXT: 543
+#CHECK-NEXT: 544
+#CHECK-NEXT: 547
+#CHECK-NEXT: 548
+#CHECK-NEXT: 549
+#CHECK-NEXT: 550
+#CHECK-NEXT: 556
+#CHECK-NEXT: 557
+#CHECK-NEXT: 561
+#CHECK-NEXT: 562
+#CHECK-NEXT: 578
+#CHECK-NEXT: 579
+#CHECK-NEXT: 588
+#CHECK-NEXT: 589
+#CHECK-NEXT: 592
+#CHECK-NEXT: 593
+#CHECK-NEXT: 596
+#CHECK-NEXT: 597
+#CHECK-NEXT: 602
+#CHECK-NEXT: 603
+#CHECK-NEXT: 605
+#CHECK-NEXT: 606
+#CHECK-NEXT: 608
+#CHECK-NEXT: 609
+#CHECK-NEXT: 611
+#CHECK-NEXT: 612
+#CHECK-NEXT: 613
+#CHECK-NEXT: 614
+#CHECK-NEXT: 615
+#CHECK-NEXT: 616
+#CHECK-NEXT: 617
+#CHECK-NEXT: 618
+#CHECK-NEXT: 620
+#CHECK-NEXT: 621
+#CHECK-NEXT: 623
+#CHECK-NEXT: 624
+#CHECK-NEXT: 625
+#CHECK-NEXT: 626
+#CHECK-NEXT: 628
+#CHECK-NEXT: 629
+#CHECK-NEXT: 640
+#CHECK-NEXT: 641
+#CHECK-NEXT: 642
+#CHECK-NEXT: 643
+#CHECK-NEXT: 644
+#CHECK-NEXT: 645
+#CHECK-NEXT: 653
+#CHECK-NEXT: 654
+#CHECK-NEXT: 656
+#CHECK-NEXT: 657
+#CHECK-NEXT: 658
+#CHECK-NEXT: 659
+#CHECK-NEXT: 668
+#CHECK-NEXT: 669
+#CHECK-NEXT: 670
+#CHECK-NEXT: 671
+#CHECK-NEXT: 676
+#CHECK-NEXT: 677
+#CHECK-NEXT: 679
+#CHECK-NEXT: 680
+#CHECK-NEXT: 683
+#CHECK-NEXT: 684
+#CHECK-NEXT: 689
+#CHECK-NEXT: 690
+#CHECK-NEXT: 696
+#CHECK-NEXT: 697
+#CHECK-NEXT: 698
+#CHECK-NEXT: 699
+#CHECK-NEXT: 701
+#CHECK-NEXT: 702
+#CHECK-NEXT: 703
+#CHECK-NEXT: 704
+#CHECK-NEXT: 706
+#CHECK-NEXT: 707
+#CHECK-NEXT: 712
+#CHECK-NEXT: 713
+#CHECK-NEXT: 719
+#CHECK-NEXT: 720
+#CHECK-NEXT: 722
+#CHECK-NEXT: 723
+#CHECK-NEXT: 725
+#CHECK-NEXT: 726
+#CHECK-NEXT: 727
+#CHECK-NEXT: 728
+#CHECK-NEXT: 729
+#CHECK-NEXT: 730
+#CHECK-NEXT: 732
+#CHECK-NEXT: 733
+#CHECK-NEXT: 739
+#CHECK-NEXT: 740
+#CHECK-NEXT: 743
+#CHECK-NEXT: 744
+#CHECK-NEXT: 745
+#CHECK-NEXT: 746
+#CHECK-NEXT: 749
+#CHECK-NEXT: 750
+#CHECK-NEXT: 752
+#CHECK-NEXT: 753
+#CHECK-NEXT: 754
+#CHECK-NEXT: 755
+#CHECK-NEXT: 756
+#CHECK-NEXT: 757
+#CHECK-NEXT: 760
+#CHECK-NEXT: 761
+#CHECK-NEXT: 765
+#CHECK-NEXT: 766
+#CHECK-NEXT: 768
+#CHECK-NEXT: 769
+#CHECK-NEXT: 771
+#CHECK-NEXT: 772
+#CHECK-NEXT: 776
+#CHECK-NEXT: 777
+#CHECK-NEXT: 778
+#CHECK-NEXT: 779
+#CHECK-NEXT: 780
+#CHECK-NEXT: 781
+#CHECK-NEXT: 785
+#CHECK-NEXT: 786
+#CHECK-NEXT: 789
+#CHECK-NEXT: 790
+#CHECK-NEXT: 791
+#CHECK-NEXT: 792
+#CHECK-NEXT: 794
+#CHECK-NEXT: 795
+#CHECK-NEXT: 796
+#CHECK-NEXT: 797
+#CHECK-NEXT: 798
+#CHECK-NEXT: 799
+#CHECK-NEXT: 800
+#CHECK-NEXT: 801
+#CHECK-NEXT: 802
+#CHECK-NEXT: 803
+#CHECK-NEXT: 805
+#CHECK-NEXT: 806
+#CHECK-NEXT: 808
+#CHECK-NEXT: 809
+#CHECK-NEXT: 810
+#CHECK-NEXT: 811
+#CHECK-NEXT: 819
+#CHECK-NEXT: 820
+#CHECK-NEXT: 825
+#CHECK-NEXT: 826
+#CHECK-NEXT: 830
+#CHECK-NEXT: 831
+#CHECK-NEXT: 833
+#CHECK-NEXT: 834
+#CHECK-NEXT: 837
+#CHECK-NEXT: 838
+#CHECK-NEXT: 842
+#CHECK-NEXT: 843
+#CHECK-NEXT: 847
+#CHECK-NEXT: 848
+#CHECK-NEXT: 853
+#CHECK-NEXT: 854
+#CHECK-NEXT: 859
+#CHECK-NEXT: 860
+#CHECK-NEXT: 865
+#CHECK-NEXT: 866
+#CHECK-NEXT: 869
+#CHECK-NEXT: 870
+#CHECK-NEXT: 873
+#CHECK-NEXT: 874
+#CHECK-NEXT: 875
+#CHECK-NEXT: 876
+#CHECK-NEXT: 877
+#CHECK-NEXT: 878
+#CHECK-NEXT: 880
+#CHECK-NEXT: 881
+#CHECK-NEXT: 882
+#CHECK-NEXT: 883
+#CHECK-NEXT: 886
+#CHECK-NEXT: 887
+#CHECK-NEXT: 888
+#CHECK-NEXT: 889
+#CHECK-NEXT: 892
+#CHECK-NEXT: 893
+#CHECK-NEXT: 896
+#CHECK-NEXT: 897
+#CHECK-NEXT: 900
+#CHECK-NEXT: 901
+#CHECK-NEXT: 904
+#CHECK-NEXT: 905
+#CHECK-NEXT: 913
+#CHECK-NEXT: 914
+#CHECK-NEXT: 915
+#CHECK-NEXT: 916
+#CHECK-NEXT: 918
+#CHECK-NEXT: 919
+#CHECK-NEXT: 924
+#CHECK-NEXT: 925
+#CHECK-NEXT: 926
+#CHECK-NEXT: 927
+#CHECK-NEXT: 929
+#CHECK-NEXT: 930
+#CHECK-NEXT: 932
+#CHECK-NEXT: 933
+#CHECK-NEXT: 935
+#CHECK-NEXT: 936
+#CHECK-NEXT: 939
+#CHECK-NEXT: 940
+#CHECK-NEXT: 941
+#CHECK-NEXT: 942
+#CHECK-NEXT: 945
+#CHECK-NEXT: 946
+#CHECK-NEXT: 948
+#CHECK-NEXT: 949
+#CHECK-NEXT: 951
+#CHECK-NEXT: 952
+#CHECK-NEXT: 955
+#CHECK-NEXT: 956
+#CHECK-NEXT: 960
+#CHECK-NEXT: 961
+#CHECK-NEXT: 962
+#CHECK-NEXT: 963
+#CHECK-NEXT: 966
+#CHECK-NEXT: 967
+#CHECK-NEXT: 976
+#CHECK-NEXT: 977
+#CHECK-NEXT: 983
+#CHECK-NEXT: 984
+#CHECK-NEXT: 987
+#CHECK-NEXT: 988
+#CHECK-NEXT: 996
+#CHECK-NEXT: 997
+#CHECK-NOT:  {{[0-9]+}}
@@ -160,5 +160,23 @@
 2.252 3.904 3
 0 -1.516 3
 
-#RUN: %lvl1 < %s
-#ANSWER: unknown
+#RUN: %lvl1 < %s | %fc %s
+#CHECK:      3
+#CHECK-NEXT: 4
+#CHECK-NEXT: 9
+#CHECK-NEXT: 10
+#CHECK-NEXT: 14
+#CHECK-NEXT: 15
+#CHECK-NEXT: 23
+#CHECK-NEXT: 24
+#CHECK-NEXT: 27
+#CHECK-NEXT: 28
+#CHECK-NEXT: 29
+#CHECK-NEXT: 30
+#CHECK-NEXT: 31
+#CHECK-NEXT: 32
+#CHECK-NEXT: 33
+#CHECK-NEXT: 34
+#CHECK-NEXT: 36
+#CHECK-NEXT: 37
+#CHECK-NOT:  {{[0-9]+}}
@@ -404,5 +404,25 @@
 -2.5 -9.55 49
 3.5 0 49
 
-#RUN: %lvl1 < %s
-#ANSWER: unknown
+#RUN: %lvl1 < %s | %fc %s
+#CHECK:      0
+#CHECK-NEXT: 53
+#CHECK-NEXT: 54
+#CHECK-NEXT: 55
+#CHECK-NEXT: 56
+#CHECK-NEXT: 57
+#CHECK-NEXT: 58
+#CHECK-NEXT: 59
+#CHECK-NEXT: 60
+#CHECK-NEXT: 61
+#CHECK-NEXT: 62
+#CHECK-NEXT: 63
+#CHECK-NEXT: 64
+#CHECK-NEXT: 65
+#CHECK-NEXT: 66
+#CHECK-NEXT: 67
+#CHECK-NEXT: 68
+#CHECK-NEXT: 69
+#CHECK-NEXT: 70
+#CHECK-NEXT: 71
+#CHECK-NOT:  {{[0-9]+}}
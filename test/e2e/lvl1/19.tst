@@ -1,5 +1,25 @@
 100
 8 -10 8 1 -15 13 0 -10 11 12 -22 -12 13 -20 -10 15 -13 -2 -6 -7 -3 -8 -7 -1 -7 -14 0 -5 -18 0 -7 -22 0 -7 -12 -6 -14 -18 4 -13 -25 11 -9 -26 9 7 -20 -20 10 -20 -12 8 -18 -14 21 11 0 25 11 0 16 13 -2 -6 -16 -21 -4 -13 -14 -3 -16 -20 -9 20 14 -3 23 20 -10 23 21 17 21 18 18 19 21 20 21 13 7 9 -4 11 3 2 5 3 3 -20 -1 -12 -22 -10 -7 -16 -6 -15 -17 -11 7 -14 -4 2 -20 -14 10 -20 21 -2 -11 19 -5 -19 20 -5 -21 -7 -20 -21 -5 -21 -21 -3 -19 -20 23 3 -19 25 3 -21 19 7 17 -13 1 14 -19 0 20 -14 -3 0 20 -11 1 26 -11 4 23 -16 -16 -6 11 -20 -7 7 -16 1 5 -3 12 15 -4 11 23 -6 13 14 -19 8 15 -27 7 13 -27 8 11 14 6 -3 11 6 -4 12 14 -9 -13 -15 -12 -18 -11 -18 -17 -9 -12 10 -24 4 10 -27 -3 19 -25 -2 -24 -25 -23 -26 -22 -23 -21 -25 -20 18 -19 8 17 -18 2 13 -14 7 -18 -8 12 -13 -14 16 -19 -14 8 5 -3 23 8 -2 25 11 -4 25 -26 11 0 -28 6 0 -24 7 8 12 -26 -12 15 -27 -18 5 -25 -17 8 21 -1 8 15 -1 8 23 4 -13 -2 17 -13 0 14 -19 -2 21 11 -22 -12 12 -30 -20 10 -29 -14 -10 11 -10 -3 8 -12 -2 12 -12 22 -6 16 26 -4 17 23 -4 16 -6 1 -24 0 -2 -20 -4 -1 -19 -23 -2 7 -20 -3 5 -19 -6 13 4 16 -6 2 12 -2 -2 17 -10 -2 21 0 3 23 2 -6 19 -5 -9 -22 -2 -4 -28 -4 -3 -27 -2 -1 16 6 1 18 13 8 9 4 -15 -21 -28 -10 -28 -20 -9 -22 -26 16 28 15 20 24 20 18 27 16 20 -20 -9 21 -15 -1 19 -13 -9 13 16 -6 7 9 -9 4 17 -4 -24 -20 -2 -20 -12 -6 -20 -13 -1 16 23 -12 16 22 -19 19 16 -19 -8 -8 17 -6 1 18 -9 0 15 -11 19 12 -13 14 6 -14 20 6 12 19 26 11 20 21 12 29 21 -15 15 23 -22 8 27 -16 10 23 19 24 -23 12 21 -27 12 18 -27 -26 13 6 -17 4 8 -16 10 12 2 -24 -18 8 -25 -15 5 -26 -15 -5 11 22 3 16 16 -6 12 23 -6 -16 -21 -5 -21 -17 -9 -17 -18 -21 -10 -2 -18 -5 -6 -19 -7 -3 -1 -5 18 4 0 22 6 5 22 -12 15 16 -19 14 21 -18 18 14 -9 -2 -6 -5 4 -14 -11 -5 -15 2 -23 4 -2 -24 4 -5 -18 4 28 -15 -5 26 -11 -4 28 -9 -10 13 19 -12 15 20 -17 15 19 -9 13 3 -6 12 5 -12 14 6 -10 -14 -15 14 -16 -16 9 -20 -8 11 -12 8 -26 -4 16 -28 -5 11 -21 -5 -8 -12 -11 -8 -14 -5 -1 -8 2 22 2 -5 13 1 0 14 -4 12 4 -13 22 -1 -11 13 -1 -5 1 -21 18 -5 -12 10 -1 -13 19 8 27 -4 10 22 -4 5 24 -2 -10 -11 8 -11 -15 2 -7 -13 -1 -9 -16 -25 -3 -18 -21 -5 -16 -22 -2 -20 25 3 -16 22 -6 -14 23 18 2 -19 8 7 -14 12 6 -13 15 8 -20 15 4 -20 15 6 -17 -13 7 -10 -10 15 -8 -8 11 -14 1 19 23 2 18 17 7 19 23 -25 -9 -3 -22 -17 -1 -22 -15 -9 -11 -2 18 -16 6 17 -6 0 15 6 -11 15 1 -9 10 5 -11 14 3 1 11 -3 1 9 -2 3 13 6 -6 -24 7 -4 -29 9 -2 -22 20 0 0 13 -2 -4 16 2 -10 -14 20 -1 -14 24 -6 -14 23 3 -23 11 14 -26 14 15 -24 10 7 5 1 11 6 -2 17 5 -1 21 -23 -11 -15 -23 -13 -17 -28 -17 -8 -15 10 -27 -6 16 -28 -12 15 -24 15 -18 6 14 -15 7 17 -18 13 -16 2 -7 -19 -2 -10 -12 -4 -8 -4 15 -26 -8 14 -29 -2 11 -23 12 1 -9 15 0 -4 14 -2 -2 23 5 25 21 5 18 27 13 26 24 4 -26 22 7 -28 22 7 -27 -16 -23 13 -12 -25 12 -14 -20 10 -12 -8 -20 -18 -5 -17 -15 -11 -25 3 -15 22 1 -11 17 -4 -14 24 -13 20 21 -8 14 17 -7 21 15 -4 14 -20 -10 11 -19 -9 9 -14 
 
-#RUN: %lvl1 < %s
-#ANSWER: unknown
+#RUN: %lvl1 < %s | %fc %s
+#CHECK:      7
+#CHECK-NEXT: 8
+#CHECK-NEXT: 12
+#CHECK-NEXT: 25
+#CHECK-NEXT: 26
+#CHECK-NEXT: 29
+#CHECK-NEXT: 32
+#CHECK-NEXT: 45
+#CHECK-NEXT: 47
+#CHECK-NEXT: 55
+#CHECK-NEXT: 64
+#CHECK-NEXT: 65
+#CHECK-NEXT: 68
+#CHECK-NEXT: 78
+#CHECK-NEXT: 79
+#CHECK-NEXT: 83
+#CHECK-NEXT: 89
+#CHECK-NEXT: 91
+#CHECK-NEXT: 92
+#CHECK-NEXT: 98
+#CHECK-NOT:  {{[0-9]+}}
@@ -1,5 +1,619 @@
 1000
 -13 81 41 -33 103 7 -43 103 37 66 -70 65 90 -88 56 94 -87 65 -71 -38 -49 -89 -44 -46 -104 -56 -48 29 65 -78 26 80 -71 15 68 -89 9 65 82 -3 92 95 27 95 103 74 45 -5 81 48 -28 88 56 -34 -16 -60 -8 -5 -92 1 -14 -98 -10 14 -34 -52 54 -26 -60 47 -53 -64 -12 18 -45 0 18 -55 -10 30 -76 -66 56 73 -50 63 88 -69 51 89 69 -45 -25 63 -66 -24 87 -53 -39 -69 -109 26 -102 -87 36 -99 -92 48 -10 -27 72 28 -25 72 25 -15 98 48 -18 -22 52 -1 -25 80 -15 3 26 48 80 39 60 86 46 75 77 -26 46 -54 -27 44 -68 -33 34 -81 -89 -31 -53 -94 -52 -35 -107 -40 -34 68 -83 66 73 -81 65 87 -96 32 79 -2 -40 101 -4 -26 114 -37 -3 -54 95 -75 -20 101 -93 -54 103 -76 53 -48 69 53 -58 80 57 -65 75 -21 -62 -39 3 -63 -52 -30 -80 -39 -53 -6 -2 -61 -18 -2 -71 -10 -19 -32 -63 -81 -59 -45 -92 -45 -69 -91 -21 -74 -34 -7 -85 -43 4 -89 -51 -69 -13 51 -58 -30 67 -75 -19 65 74 96 9 101 99 1 96 117 17 -80 15 86 -77 1 107 -98 -4 100 61 64 46 73 53 65 87 69 56 96 -7 -87 90 -16 -93 86 8 -112 57 -59 -27 44 -76 -30 41 -91 -11 89 -76 25 58 -95 45 92 -79 37 59 -21 97 70 -25 92 88 -27 83 81 50 -75 100 48 -59 107 51 -72 14 -84 86 43 -75 90 18 -98 96 26 -60 24 32 -78 13 49 -70 26 -32 36 -52 -36 35 -78 -57 47 -80 72 -19 -92 97 -20 -72 94 -41 -71 12 -35 9 10 3 39 -18 -27 35 -6 -90 51 20 -87 71 0 -91 89 -42 -25 3 -33 -26 35 -32 -36 33 -64 -5 15 -70 -8 18 -60 -12 45 76 -78 -54 78 -68 -78 103 -59 -75 -41 60 -75 -51 61 -94 -79 71 -113 -30 -105 -52 -11 -99 -74 -6 -98 -81 -74 69 -6 -90 60 -31 -102 55 -38 31 19 -64 46 23 -65 33 13 -86 15 -34 -41 20 -12 -63 -16 -27 -65 70 38 -19 75 22 -54 97 21 -20 54 -5 1 75 -11 17 78 -28 2 68 -32 6 80 6 3 87 5 -10 -59 40 48 -49 55 47 -77 59 49 -31 66 -23 -17 86 -14 -15 74 -53 31 96 -3 45 99 -18 57 103 -33 33 -7 48 39 12 56 64 26 60 -98 17 -13 -101 35 -19 -111 37 -17 33 -61 -22 35 -70 -21 40 -64 -45 60 11 86 63 22 93 62 0 111 -34 35 36 -54 27 53 -55 25 59 -59 71 -61 -44 70 -85 -31 99 -73 -31 -84 -70 -28 -98 -52 -24 -112 -75 25 -2 74 17 -5 89 11 -26 96 1 44 2 2 55 -3 5 51 30 -39 -50 -26 -2 -68 -23 -6 -75 -8 -1 -7 40 -4 -20 68 30 -27 61 24 -53 -14 23 -53 -26 46 -76 -29 51 88 -67 73 66 -84 54 104 -86 96 49 -18 86 84 -8 105 76 7 59 -41 -79 55 -64 -81 70 -69 -67 -6 -41 -26 -1 -53 -21 1 -48 -35 -58 41 -70 -59 35 -75 -78 50 -59 11 11 49 8 -1 61 -18 -3 70 -21 -65 -56 -40 -73 -73 -46 -83 -75 15 15 -73 45 10 -63 27 27 -80 86 -50 67 89 -60 77 105 -53 84 33 14 14 40 21 20 28 53 -13 83 -86 38 85 -108 38 95 -89 70 -32 -38 -86 -51 -39 -84 -69 -46 -82 -21 37 17 -15 40 38 -24 60 51 25 64 -74 32 57 -84 11 69 -99 -69 37 -5 -78 43 -20 -79 64 18 2 58 -57 17 52 -65 5 66 -67 49 -30 -72 53 -57 -62 44 -48 -84 -36 -87 -83 -60 -86 -97 -32 -94 -107 88 -5 64 92 22 86 109 -14 69 45 79 -45 48 102 -50 71 102 -55 86 -49 6 100 -44 35 115 -54 11 -45 -51 16 -64 -62 20 -64 -57 40 6 -22 -67 12 -33 -77 32 -15 -104 -57 93 37 -62 90 39 -80 77 49 55 -62 3 65 -82 14 84 -67 28 -21 10 35 7 39 45 9 41 47 -7 80 84 21 84 101 22 91 100 -32 -73 -6 -35 -85 -15 -51 -76 -21 -76 70 73 -72 56 92 -66 62 110 -74 -93 -29 -92 -89 -14 -96 -98 -23 17 76 -25 11 78 -26 24 97 2 5 72 -28 -11 76 -43 -1 94 -52 10 60 -76 29 80 -50 24 71 -65 -34 -30 -16 -23 -50 -5 -50 -50 -31 -37 38 -62 -67 40 -32 -51 69 -51 -3 -42 -76 4 -44 -93 28 -59 -87 -54 93 -1 -83 99 16 -78 112 24 26 53 -6 53 86 -14 56 91 -1 -26 70 20 -15 87 30 -23 94 56 27 44 37 16 57 31 37 71 41 -28 47 -34 -16 43 -56 -37 42 -50 -21 88 -78 -15 63 -114 -15 75 -113 41 48 62 31 48 71 45 72 68 -30 28 -48 -31 62 -64 -52 60 -54 34 -66 94 47 -65 89 46 -70 88 49 35 -3 66 36 5 72 18 21 51 26 -40 83 33 -33 71 45 -48 57 -4 85 91 -11 97 85 6 106 18 19 50 20 34 71 10 56 72 -23 -25 29 -22 -17 40 12 -23 54 34 -33 68 22 -17 88 37 -16 89 -105 24 -31 -97 47 -59 -97 48 -65 84 -58 -2 79 -76 -1 109 -82 1 -28 -49 -66 -39 -61 -68 -49 -61 -64 -16 29 0 -19 31 7 3 64 1 55 55 -85 82 33 -79 87 30 -75 0 33 -62 25 26 -68 28 54 -77 -62 3 49 -64 9 50 -54 -10 82 -96 48 -66 -80 73 -81 -82 68 -98 94 25 -17 99 46 -6 102 51 -9 -16 39 56 -17 63 53 -22 51 69 49 -48 -65 46 -70 -67 46 -39 -91 -52 -77 -29 -24 -89 -40 -29 -85 -48 -9 -32 65 -34 -53 49 -39 -63 42 37 32 89 26 51 97 37 68 84 21 -72 66 24 -58 87 40 -91 93 22 93 2 32 103 -14 32 106 6 -13 -38 -53 -2 -56 -84 -35 -40 -87 -29 -4 17 -22 -30 41 -45 -19 41 62 34 39 72 51 33 74 52 43 39 27 -9 56 39 24 43 58 15 -32 88 -81 -64 77 -83 -62 98 -68 -65 74 -59 -68 88 -73 -70 96 -74 56 -47 7 83 -20 -7 58 -60 30 -45 41 36 -61 10 58 -68 6 57 -70 83 37 -97 90 30 -100 103 -1 39 -23 -70 45 -16 -75 31 -22 -94 49 57 41 58 54 53 45 81 57 -61 65 33 -62 75 22 -71 79 20 55 -16 81 61 -27 88 69 -24 93 19 -71 -46 34 -65 -63 16 -78 -68 -63 91 -46 -89 83 -42 -89 101 -40 -3 -28 -23 5 -39 -19 -4 -24 -45 -48 -39 -2 -68 -37 1 -69 -32 -16 67 -13 33 81 -48 39 64 -53 70 -56 102 -48 -59 103 -73 -70 100 -73 6 48 -79 8 48 -80 -7 82 -70 49 -69 35 53 -89 51 44 -108 61 60 68 -75 87 77 -54 85 78 -71 -2 -7 -67 -3 -38 -89 16 -40 -95 68 -31 -71 62 -32 -85 87 -49 -86 -93 -17 -37 -79 -45 -63 -101 -42 -51 -54 65 16 -80 33 8 -79 54 44 11 -38 48 5 -34 73 -11 -53 84 51 -84 34 82 -84 11 84 -84 20 -4 93 -45 25 89 -54 27 96 -58 48 -48 -92 65 -15 -97 66 -41 -89 84 35 11 97 31 12 98 29 18 -30 50 63 -25 69 83 -36 67 87 87 20 66 88 11 89 100 19 97 -21 -28 46 -11 -36 47 -2 -54 32 20 -71 79 25 -75 80 35 -81 73 -61 -54 -76 -58 -75 -82 -69 -75 -74 13 49 14 3 54 -9 -10 57 -12 -78 -81 -38 -39 -110 -23 -52 -109 -37 -21 -23 -50 -21 1 -61 -21 -10 -69 62 20 -72 49 14 -85 80 11 -95 36 -78 -56 75 -39 -72 36 -74 -79 46 -56 -28 76 -32 -52 78 -61 -48 12 -77 -13 -8 -74 -31 9 -82 -27 -36 86 -68 -34 76 -89 -15 107 -65 -26 -74 -91 -60 -82 -81 -56 -104 -69 94 66 -51 95 70 -83 109 65 -91 -92 -30 -59 -93 -32 -69 -104 -61 -46 -27 55 -62 -11 73 -62 -4 58 -86 -42 66 -61 -21 56 -80 -29 64 -81 -87 -17 54 -88 -6 69 -102 -23 71 7 -42 58 19 -46 64 44 -63 57 60 -1 -11 67 9 -1 69 13 -21 23 -115 71 34 -116 72 38 -109 87 40 8 59 48 0 77 64 24 62 -43 -30 36 -39 -29 53 -37 -66 16 -40 11 -106 -54 25 -100 -47 32 -106 80 -54 52 87 -78 20 102 -92 52 21 33 -29 46 53 -47 45 60 -54 32 54 71 21 45 95 26 45 94 -38 -64 28 -41 -72 18 -43 -87 25 -12 6 60 -16 34 80 -24 39 78 -92 -79 59 -67 -107 61 -95 -105 56 -49 25 -63 -58 2 -78 -73 37 -78 -64 91 26 -93 73 44 -81 97 48 -82 -45 -33 -99 -45 -40 -96 -41 -57 69 22 79 86 44 71 91 49 79 2 -25 -53 2 -42 -74 -7 -50 -85 -19 -74 70 -19 -61 91 -40 -68 96 83 -95 11 103 -82 7 102 -83 17 -55 -39 58 -51 -39 67 -54 -40 75 61 -32 -85 81 -27 -82 86 -27 -88 -55 -50 -70 -66 -66 -88 -70 -61 -104 -50 87 -7 -22 99 -1 -28 98 -20 59 -16 82 66 -10 95 84 -49 68 -45 54 -32 -58 45 -42 -74 62 -54 12 -12 -29 19 8 -47 13 -17 -51 34 -61 -74 54 -73 -56 42 -85 -87 46 60 -61 53 79 -68 51 96 -64 84 -94 -30 103 -92 -48 106 -112 -55 74 -14 73 72 1 82 57 9 95 50 -3 0 75 -19 -32 75 -15 -37 -93 -89 -53 -103 -94 -59 -116 -80 -71 -14 -78 0 17 -77 -13 -9 -80 -11 45 59 -59 57 41 -70 64 60 -67 47 24 -74 64 28 -66 72 11 -75 -79 -23 19 -83 -44 15 -101 -43 15 5 89 80 6 89 91 9 99 102 82 55 -87 116 53 -77 111 64 -82 51 -30 -88 87 -21 -66 77 -22 -81 55 -25 45 61 3 63 68 -7 59 71 1 41 96 2 35 83 -9 70 60 74 64 62 84 55 60 98 88 29 -53 12 35 -78 22 27 -91 15 30 12 45 51 17 27 57 4 56 -18 -71 79 -5 -49 102 -34 -61 90 -24 39 18 -57 39 42 -46 60 40 -40 -91 31 -54 -81 58 -49 -80 67 5 8 80 -1 33 94 30 19 111 -35 -31 -77 -58 -39 -84 -55 -21 -110 -15 4 -19 -24 5 -28 -24 -19 -33 99 -68 26 91 -101 4 102 -97 1 -69 44 1 -78 45 26 -88 60 4 74 -41 -77 107 -61 -77 100 -77 -94 50 9 68 57 27 76 62 20 90 12 27 -60 38 19 -53 11 32 -60 -75 68 27 -83 74 13 -100 64 16 16 -26 -23 14 -58 -5 44 -52 -28 -42 67 -8 -25 84 -20 -42 98 -10 -49 -26 4 -55 -40 36 -60 -46 27 -51 51 -63 -59 53 -80 -59 69 -71 -77 22 -78 -91 37 -54 -85 39 -75 80 -58 32 102 -54 31 95 -51 56 58 -44 -34 53 -45 -60 79 -40 -43 -2 -86 104 -15 -84 112 -10 -108 110 -19 15 -72 -39 5 -93 -25 -11 -107 57 -22 -14 55 -32 -13 62 -33 -34 57 5 -29 80 0 -42 81 10 -40 14 17 51 13 34 49 27 48 29 92 -79 73 114 -74 66 114 -94 79 -4 25 -80 -20 29 -111 -39 16 -119 79 79 3 96 107 -1 117 96 -20 83 67 50 115 43 46 116 51 60 -74 82 79 -86 76 81 -89 98 104 24 -2 84 20 37 83 -14 1 93 -25 -90 22 -39 -99 11 -34 -102 45 53 -26 20 47 -40 14 62 -37 17 -36 -45 -26 -38 -50 -47 -33 -58 -51 -13 46 -83 -23 61 -87 -21 53 -100 -71 -6 -91 -54 -34 -98 -75 -31 -108 103 28 47 111 30 66 95 37 86 74 -71 87 64 -76 108 85 -81 98 -33 -69 -78 -20 -89 -74 -28 -88 -74 5 87 -60 -19 102 -61 18 89 -82 -10 -62 -61 -13 -72 -55 -7 -67 -78 85 -50 -48 101 -63 -44 102 -72 -38 -33 74 57 -22 54 84 -24 77 69 -36 6 -69 -16 32 -76 -28 18 -98 80 -40 -11 85 -37 -19 102 -33 -11 -31 91 11 -43 92 -2 -46 106 7 34 45 -39 60 47 -46 56 67 -47 -60 -97 -62 -93 -93 -63 -82 -102 -74 -4 4 2 11 0 1 -16 1 20 -79 -78 -29 -83 -92 -27 -105 -92 -8 65 75 -69 34 104 -54 63 87 -61 -40 18 51 -58 7 65 -45 7 85 8 -6 -42 -28 -22 -53 -24 -37 -59 81 -9 -14 87 -13 11 108 -6 -26 -92 45 16 -115 49 -13 -117 74 -22 4 -38 39 -2 -46 30 10 -60 14 -51 -75 -6 -35 -102 0 -65 -90 27 -73 24 -1 -90 24 0 -84 51 4 50 -76 -26 52 -89 -32 83 -92 -13 36 1 18 42 1 26 57 14 -11 43 -60 -14 66 -46 -47 79 -67 -27 -10 -67 53 -20 -92 21 -37 -83 34 60 -11 11 67 -14 8 88 -35 8 -67 -49 2 -94 -12 29 -107 -30 23 -45 5 46 -46 -17 53 -34 8 69 -36 -65 65 -39 -87 45 -74 -68 56 7 46 -55 22 61 -47 39 67 -60 65 -84 -86 78 -83 -82 55 -84 -101 65 5 -66 80 -1 -54 82 -31 -55 -3 36 -72 -14 46 -78 -10 56 -95 87 38 49 101 27 47 102 59 55 -3 77 -41 9 78 -43 10 91 -38 -2 -55 3 3 -75 -10 0 -79 -13 20 -84 -28 12 -80 -60 24 -90 -51 1 35 -77 -7 1 -96 -6 15 -101 -86 -62 -48 -76 -52 -81 -107 -50 -61 -31 20 53 -27 40 57 -30 30 77 -28 -77 -33 -48 -55 -58 -29 -81 -47 -57 97 14 -61 96 14 -63 105 11 29 -75 76 29 -75 114 -1 -107 106 -23 37 -16 4 34 -39 -30 40 -41 -63 -10 114 -74 -23 116 -90 -23 114 -52 -7 -7 -52 -14 2 -72 -40 6 54 -25 0 71 -3 -11 72 -22 -27 3 76 75 2 76 77 7 100 64 81 -53 -16 82 -68 -24 95 -61 -19 40 21 44 37 30 56 41 48 53 0 89 73 3 79 90 8 89 84 51 -10 -80 35 -41 -91 55 -32 -97 20 54 45 56 26 42 33 66 24 44 -30 -33 35 -29 -51 65 -58 -31 -17 -27 -15 -34 -37 -25 -15 -50 -42 64 81 -68 69 99 -65 63 108 -85 4 -44 -34 14 -34 -49 5 -52 -43 0 45 -20 -18 43 -21 0 53 -21 -32 73 46 -37 89 21 -55 102 32 30 -60 7 35 -68 -4 45 -88 4 -21 -66 55 -20 -59 70 -42 -93 69 -84 38 26 -90 42 54 -91 60 45 13 -8 42 7 19 55 19 20 60 84 69 -33 89 88 -15 77 104 -31 66 -86 72 95 -76 68 65 -108 87 59 -21 -73 83 -36 -85 77 -32 -92 -34 -15 42 -2 -35 63 -36 -48 49 -62 -91 -28 -75 -86 -38 -91 -75 -54 -35 11 -57 -36 9 -59 -29 14 -68 60 -55 92 49 -61 97 78 -66 100 -76 -1 -20 -98 18 -37 -110 6 -17 19 -66 84 21 -81 95 33 -82 102 -14 -21 -17 -35 -19 7 -10 -41 -10 -76 52 57 -84 60 71 -102 80 57 67 64 -100 49 96 -88 77 97 -78 -43 -42 66 -69 -23 68 -74 -25 72 -58 38 43 -62 44 49 -86 74 34 8 16 43 17 -6 51 47 22 27 37 -35 -11 50 -65 -21 65 -57 -26 79 -7 -1 87 -37 23 102 -25 18 -90 53 -55 -83 62 -61 -82 79 -59 61 48 76 74 21 105 87 22 108 -106 -77 -75 -84 -86 -94 -102 -85 -95 56 77 79 48 94 78 55 87 88 0 -48 -73 -31 -25 -92 -33 -23 -101 95 25 -55 105 16 -48 117 24 -73 65 -49 91 78 -40 91 92 -68 88 78 70 14 105 46 1 105 68 7 55 82 18 45 94 34 85 108 26 -49 -61 -14 -57 -68 -37 -58 -80 -11 -57 4 -60 -71 -8 -47 -76 16 -69 65 10 -55 73 9 -89 80 -14 -83 -8 -30 12 -7 -37 -10 -10 -59 -25 25 -53 38 28 -66 42 6 -67 66 -100 26 32 -112 29 15 -114 32 18 81 20 -39 88 12 -39 72 39 -63 15 -61 -50 20 -77 -74 -17 -90 -63 54 -80 36 61 -90 65 50 -113 47 -26 3 77 -17 -21 87 -29 -19 93 61 22 -82 93 28 -85 90 -4 -108 65 -44 -15 80 -35 -7 89 -22 -12 16 61 22 24 71 38 47 87 45 -87 25 -24 -97 10 -36 -101 -7 -51 -11 -2 -43 -1 -5 -62 -3 -1 -79 -17 -78 66 -40 -70 67 -16 -99 66 -20 -6 -29 -58 -1 -12 -48 -6 -41 -21 18 9 -24 38 -4 9 50 -16 80 96 -52 99 78 -52 101 112 -30 46 33 35 53 10 47 79 7 11 -1 80 55 18 80 55 6 89 70 -96 -53 52 -79 -72 64 -114 -40 59 -43 -82 89 -67 -74 99 -51 -83 103 64 -44 -75 90 -33 -62 83 -30 -82 105 -50 -53 97 -61 -63 77 -73 -81 -73 24 -71 -79 21 -73 -73 33 -91 -50 -13 -107 -51 -32 -108 -58 -20 -110 22 -35 95 56 -46 83 43 -22 103 -63 -97 -101 -91 -88 -95 -94 -95 -113 18 54 53 33 47 56 6 67 58 -94 -86 49 -117 -84 59 -112 -84 70 44 -45 56 53 -69 58 66 -61 60 -106 -46 86 -117 -46 71 -112 -47 97 -76 33 -2 -105 25 -9 -109 6 3 95 -14 -76 88 -2 -94 97 -5 -105 -6 -55 61 -10 -51 87 3 -57 90 -37 41 -5 -52 53 10 -60 50 -2 -48 44 68 -55 68 84 -76 73 82 -71 53 -23 -62 78 -8 -75 68 -25 -69 11 -82 -32 22 -106 -53 37 -114 39 -42 5 21 -53 16 43 -40 8 37 78 3 68 96 11 68 106 -10 -25 71 6 -25 81 -2 -41 84 13 8 -40 -86 -7 -39 -109 -19 -57 -104 -28 -67 -34 -26 -72 -27 -41 -49 -56 -30 -52 32 -12 -72 20 -30 -65 36 60 -42 84 44 -71 105 43 -78 101 -5 -24 -49 -12 -30 -66 -7 -35 -79 71 65 39 72 73 22 86 79 33 -79 57 -80 -77 41 -99 -80 71 -96 -55 53 -33 -72 70 -59 -80 60 -67 71 -22 -8 73 -28 -7 73 -32 -9 -41 4 20 -34 27 29 -27 28 41 -69 -12 88 -89 12 85 -90 2 91 -73 46 17 -88 45 5 -77 61 20 -49 88 62 -72 69 66 -84 83 93 13 -77 -81 6 -103 -67 -5 -101 -76 42 10 -13 60 18 -17 58 46 -15 -7 -14 -69 -30 -19 -75 -31 2 -84 -83 56 41 -82 77 39 -79 90 57 3 -59 -52 -7 -55 -74 8 -66 -65 78 -12 -40 100 -6 -38 105 -12 -52 -57 -75 -27 -73 -77 -5 -70 -97 -28 71 44 40 60 38 61 65 68 74 84 -9 51 96 -16 63 105 -9 52 -61 -80 40 -96 -68 10 -96 -66 23 -61 -18 58 -75 -30 61 -83 -43 54 7 65 -78 -12 74 -106 -13 89 -114 28 -25 19 35 -17 21 61 -8 55 -11 53 -59 -8 58 -84 -42 42 -88 73 51 98 75 75 94 74 73 115 -71 -21 -8 -93 -14 -13 -97 -8 -16 75 12 35 85 42 25 94 16 25 -78 -109 -60 -84 -103 -76 -106 -96 -68 -36 -27 -27 -41 -41 -30 -16 -51 -45 1 -4 1 21 -11 -14 23 7 -23 24 -3 20 21 5 39 49 26 32 -65 86 -50 -65 105 -47 -100 93 -43 -60 -41 19 -58 -36 39 -77 -13 38 5 78 -85 12 78 -86 36 115 -79 -28 29 -51 -43 9 -69 -41 0 -71 -32 -57 10 -25 -66 -15 -39 -76 0 36 37 52 37 47 49 51 65 38 -14 -9 -64 -38 -26 -56 -40 -12 -77 -74 21 49 -92 -1 65 -104 26 46 -5 40 -41 15 45 -36 0 56 -48 -12 63 49 -9 59 64 -35 73 37 -48 12 10 -49 14 -10 -54 -12 9 64 56 -85 98 50 -80 76 60 -110 57 -82 43 49 -99 27 65 -78 58 8 25 -66 42 7 -78 12 -6 -99 -29 16 84 -31 11 94 -43 -21 114 -3 -6 65 -1 10 67 -9 -7 74 72 59 -3 84 56 20 96 80 31 -30 45 -35 -44 56 -58 -46 71 -44 44 -8 65 68 -15 53 45 -6 78 -45 95 -19 -64 107 -33 -63 109 -40 -52 75 4 -73 71 7 -89 83 3 59 63 50 69 47 56 76 49 59 -79 -44 -29 -56 -63 -54 -82 -61 -49 49 8 -13 52 35 0 63 22 -17 -1 -35 74 6 -25 104 -6 -33 105 -89 42 -35 -89 54 -22 -103 31 -16 21 30 42 24 31 72 20 65 55 42 35 -59 49 43 -71 62 74 -73 -14 22 17 -35 40 21 -20 47 30 75 -5 -76 73 -19 -77 81 -32 -107 -22 -55 3 -49 -51 13 -46 -51 35 -44 52 16 -49 53 12 -60 51 -12 -95 -101 58 -99 -103 72 -114 -95 79 37 50 -7 55 72 14 69 79 31 -75 -45 25 -66 -37 51 -78 -44 20 -5 9 -55 10 16 -65 -28 27 -65 -71 -34 -24 -59 -53 -24 -89 -42 -25 -49 85 -74 -47 70 -105 -54 87 -90 43 28 9 48 20 40 47 45 35 -82 14 -16 -101 21 -34 -104 49 -30 -36 -36 19 -45 -33 37 -39 -62 23 -56 12 -70 -37 34 -77 -60 31 -67 20 4 80 15 4 105 53 -2 114 -32 69 39 -11 86 56 -15 105 53 -49 -39 28 -86 -24 33 -79 -38 66 -56 64 59 -59 54 68 -59 60 70 -81 35 -83 -90 61 -85 -97 70 -71 11 -24 -47 21 -43 -47 18 -23 -64 -58 -67 -6 -58 -89 7 -65 -100 -13 -40 62 -78 -15 78 -82 -43 49 -99 -2 -55 35 -16 -64 64 6 -84 62 -23 -60 -69 -10 -58 -74 -38 -88 -63 -12 66 62 -33 80 88 -49 90 74 -62 -33 95 -56 -32 105 -82 -18 109 8 59 62 22 66 53 23 64 58 -74 47 89 -69 60 92 -103 55 67 9 -26 -39 26 -13 -78 45 -32 -78 22 49 58 49 36 63 46 37 76 -68 -10 -85 -68 -1 -92 -70 -20 -103 -81 4 83 -104 3 86 -99 28 99 -95 -99 -60 -74 -112 -71 -106 -88 -73 -56 -72 64 -61 -82 49 -45 -107 77 12 -73 -44 -2 -82 -41 18 -69 -71 -56 -71 -83 -83 -92 -68 -58 -86 -106 -17 -21 8 -16 -33 0 -28 -54 6 29 -78 -75 27 -58 -99 52 -59 -96 68 14 29 73 17 34 93 -16 34 74 83 30 70 96 34 101 81 17 -84 -41 -21 -96 -46 -17 -112 -22 4 32 37 2 45 45 -12 34 66 8 -92 53 18 -98 51 -2 -87 86 8 -61 17 -44 -72 19 -46 -85 21 -63 -10 54 16 -21 48 26 6 45 46 -31 -23 3 -17 -42 22 -2 -52 4 19 39 -5 35 47 -15 19 60 -13 -58 66 13 -50 76 35 -44 88 19 -50 -70 76 -57 -91 80 -33 -95 105 -4 -90 82 -12 -92 87 3 -77 105 23 -88 -19 46 -99 3 18 -110 14 -29 20 -77 -22 15 -86 -36 2 -84 55 -13 14 68 -15 -8 79 -8 1 78 68 -13 98 98 -5 98 97 15 45 -33 -34 51 -47 -37 51 -36 -49 -72 15 38 -71 3 49 -90 19 39 -50 -61 7 -72 -48 25 -78 -74 -2 -65 -17 -66 -93 13 -38 -88 11 -58 -32 -69 90 -6 -81 86 -32 -91 103 -75 -8 -44 -83 -25 -44 -97 -5 -32 32 -79 -21 40 -78 -47 63 -90 -48 44 33 -29 58 61 -31 56 67 -56 -39 -19 -71 -11 -14 -84 -22 -44 -80 -19 75 63 -53 62 91 -51 79 97 51 -46 67 41 -50 73 55 -56 81 18 -18 -30 0 -11 -38 40 6 -20 75 -28 33 82 -21 56 86 -27 52 41 96 3 54 94 24 53 117 6 50 76 61 53 89 60 39 82 93 45 -47 -66 36 -69 -80 71 -57 -73 82 75 -72 94 71 -74 82 61 -105 -46 -79 -43 -44 -86 -48 -47 -108 -49 76 -14 -19 82 -16 -46 93 -29 -21 -28 52 33 -32 65 8 -53 49 25 36 45 -15 28 60 -3 51 57 0 -14 -58 -79 -2 -63 -86 -4 -77 -96 -2 -33 -52 4 -54 -59 5 -51 -69 37 -35 6 51 -35 -8 25 -60 -14 -85 -39 -36 -78 -55 -38 -89 -38 -42 -62 -75 85 -97 -55 71 -82 -65 88 -72 -39 57 -91 -59 74 -102 -71 57 -47 16 -31 -50 16 -34 -83 21 -27 3 26 49 -14 31 70 13 50 72 11 -30 65 29 -3 69 22 -10 85 72 -91 2 104 -73 20 102 -81 6 23 48 74 42 41 70 29 77 68 23 67 -57 32 69 -59 27 96 -56 -5 -16 24 17 -11 23 -13 -35 6 19 47 -44 48 69 -27 28 79 -56 -1 66 -60 35 77 -44 32 84 -53 -43 -20 -5 -45 -18 -8 -59 -43 19 91 -56 83 83 -58 92 98 -52 113 -25 -49 23 -49 -63 25 -50 -75 2 -31 -30 69 -6 -63 66 -18 -63 80 -54 59 -59 -66 72 -44 -35 75 -77 30 -59 -7 36 -66 9 36 -78 -1 27 21 40 36 9 40 28 13 56 57 -77 -65 60 -69 -79 60 -99 -74 84 8 37 98 6 36 110 11 40 -77 52 -2 -79 49 -26 -93 45 -13 52 -47 63 63 -57 61 60 -44 80 12 2 -7 28 10 -5 36 0 -6 -58 -22 24 -78 -37 28 -72 -43 48 -81 -14 -52 -92 -4 -62 -96 -32 -51 74 -54 -30 88 -62 -4 106 -32 -17 39 67 42 25 80 53 41 87 60 -44 21 49 -77 8 48 -65 -6 79 3 -51 -74 9 -18 -90 5 -46 -86 67 -103 1 94 -84 -2 86 -108 -10 11 39 21 2 51 23 -24 58 -13 -12 -79 81 -8 -100 77 -29 -103 81 -19 78 53 -35 72 73 -14 89 64 21 11 87 26 16 85 11 25 110 40 -17 45 48 -18 39 57 -19 45 -6 4 8 -24 5 15 5 31 32 76 18 -79 77 11 -101 83 14 -105 73 13 -72 59 47 -73 50 41 -100 91 -14 -71 84 -43 -80 105 -36 -71 80 74 -52 86 83 -33 100 92 -56 -58 59 62 -60 76 79 -68 68 91 -86 -97 -39 -106 -101 -31 -104 -110 -42 -45 81 -1 -61 71 18 -68 70 -6 71 44 -20 59 42 -48 69 62 -18 -46 -69 -23 -44 -80 -12 -71 -64 -30 29 -10 -64 8 3 -76 20 20 -80 -16 -40 42 -20 -39 43 -23 -54 54 25 -40 46 37 -33 62 32 -63 56 61 56 9 98 61 13 86 74 40 23 -45 18 25 -44 20 -2 -44 33 92 3 70 97 -18 68 102 -10 76 49 38 36 38 54 40 62 43 43 16 49 -84 6 70 -82 -16 79 -89 -55 -93 27 -81 -73 53 -88 -76 39 -31 87 33 -45 80 37 -21 96 34 -86 72 -34 -87 72 -48 -101 59 -40 -57 -56 -16 -59 -62 -30 -73 -73 -46 -34 -86 -28 -41 -82 -34 -51 -80 -37 -22 -12 33 -41 -10 15 -40 -5 21 75 46 22 71 54 31 101 82 2 86 -27 -80 97 -30 -95 99 -31 -109 69 70 40 63 92 15 84 74 45 17 15 -78 25 16 -101 17 4 -110 -38 -81 -3 -37 -104 -11 -12 -113 -16 -55 83 63 -51 101 75 -56 117 87 51 -35 13 60 -29 -14 44 -54 3 -21 -19 12 -27 -36 -17 -12 -42 -23 90 -76 -8 92 -94 -25 92 -91 -43 -54 72 39 -15 64 76 -40 80 67 -37 -68 55 -37 -90 65 -20 -90 74 -22 -42 90 -36 -23 98 -15 -27 111 82 60 33 61 82 43 96 84 53 67 80 -54 66 94 -37 74 90 -46 110 -11 73 91 -25 107 99 -42 103 26 64 -83 17 87 -103 6 94 -107 67 -26 -64 53 -49 -71 54 -53 -84 -20 -46 -81 -24 -35 -86 -31 -42 -89 -37 -87 -96 -52 -69 -106 -41 -86 -117 -51 -72 -77 -56 -63 -88 -48 -94 -71 83 17 59 104 18 62 108 29 66 -3 23 29 6 17 40 -13 34 49 -73 -78 54 -85 -67 72 -111 -66 59 90 11 62 62 31 90 89 34 64 63 88 -65 82 96 -41 80 112 -58 90 -80 49 87 -96 35 87 -97 42 -79 45 -20 -105 20 -21 -98 53 -38 -12 -8 -2 -7 -19 -8 -24 -5 30 -15 75 -47 -21 105 -41 13 101 -70 48 89 -46 58 110 -26 72 113 -30 -62 -3 -68 -58 -18 -70 -79 5 -85 12 53 -59 1 79 -68 -14 86 -62 68 -50 50 63 -66 80 76 -73 72 -51 -94 -100 -58 -114 -100 -69 -102 -107 -39 29 11 -52 21 -16 -27 52 -3 -108 -72 -36 -107 -87 -46 -111 -88 -33 52 61 -79 34 49 -107 55 53 -106 -42 49 -9 -50 48 -11 -62 51 -20 -51 34 29 -71 19 31 -83 34 40 73 12 31 78 7 22 99 -5 31 23 -31 -49 -3 -56 -53 18 -70 -38 -17 66 45 -27 72 48 -23 95 68 20 32 -30 24 53 0 26 56 -5 30 -82 74 18 -105 60 31 -105 70 -73 14 85 -55 34 103 -71 40 95 -59 5 -51 -78 15 -38 -86 -5 -28 28 -68 -10 22 -84 -26 7 -91 -24 58 42 49 78 23 55 69 42 57 -75 -80 -18 -87 -89 -6 -80 -107 -4 -93 2 64 -84 9 77 -107 28 63 -35 -60 47 -22 -55 77 -52 -76 59 18 76 -86 11 85 -95 39 73 -101 -28 23 -33 -21 12 -45 -20 41 -33 -68 64 -75 -63 56 -92 -85 36 -109 51 18 -67 76 22 -59 71 12 -92 -98 34 -71 -75 50 -97 -103 47 -72 -74 69 -57 -78 88 -56 -88 84 -54 -47 49 -66 -38 68 -54 -42 66 -84 61 13 -78 49 34 -100 55 20 -109 -83 -46 78 -106 -35 70 -111 -47 81 -44 57 54 -59 42 82 -70 45 73 21 -41 78 46 -46 88 32 -36 112 -48 -52 89 -56 -49 104 -33 -67 106 -56 -64 -33 -61 -60 -55 -70 -57 -50 49 49 0 47 53 -5 57 56 -9 94 73 34 94 99 33 100 101 26 68 -4 -13 85 23 -1 89 3 3 -38 90 25 -26 99 0 -50 90 27 -46 -2 73 -61 -10 64 -67 7 60 -73 -50 -37 -75 -60 -42 -99 -55 -44 -12 -70 35 -3 -98 28 -2 -104 37 60 59 69 54 73 72 62 76 69 -44 -94 42 -50 -90 70 -51 -82 80 76 91 -61 112 72 -56 96 97 -72 50 38 -7 31 63 15 55 43 17 72 -82 70 81 -58 86 91 -88 74 43 3 -87 25 0 -101 43 -14 -116 -79 72 74 -94 71 77 -90 72 101 -1 -17 -77 -11 -2 -79 -15 -3 -96 -28 -12 -52 -18 -8 -66 -19 7 -70 92 48 9 82 74 10 92 59 42 70 -79 58 98 -77 76 98 -83 76 100 78 -8 105 94 -27 108 101 -6 4 -23 -49 22 -37 -51 40 -59 -52 12 -42 -74 14 -54 -90 26 -74 -111 -13 85 -27 2 106 -41 17 110 -37 107 42 -4 92 82 -33 118 75 -22 -89 -74 19 -80 -93 6 -80 -86 39 -23 50 20 -27 49 22 -42 45 20 26 59 -10 29 63 -21 6 82 -32 17 -44 53 22 -64 50 43 -54 57 -70 -12 82 -77 20 98 -82 18 97 -12 -14 13 -16 -16 13 -13 -33 37 -84 -9 64 -95 -17 55 -100 -7 77 30 33 -89 33 19 -101 19 52 -93 92 27 -73 75 37 -89 98 27 -69 56 -74 41 59 -84 52 66 -94 48 103 -75 -77 106 -78 -72 90 -70 -102 38 -2 7 55 0 7 65 31 13 -20 68 66 -23 78 76 11 99 100 -74 -4 36 -91 -20 60 -102 15 45 24 -41 -15 28 -42 -10 16 -62 -21 19 -23 -11 15 -34 -15 -19 -49 -6 87 -80 -49 99 -85 -61 94 -99 -73 44 -3 -7 28 7 -38 49 13 -38 -73 -7 -29 -109 11 -15 -110 -23 -18 -103 70 -41 -94 70 -76 -113 68 -56 26 -56 59 30 -41 75 19 -50 88 -4 85 -48 17 113 -34 -18 103 -59 72 86 -39 96 105 -31 110 107 -22 95 -20 16 87 -46 34 114 -13 46 -40 -17 -45 -53 -17 -36 -75 5 -19 0 -36 12 26 -68 28 -1 -66 43 -41 58 -47 -60 59 -43 -65 46 -60 49 44 23 50 49 7 59 55 19 -50 9 17 -87 1 0 -90 15 18 -58 10 4 -61 21 -8 -78 6 -27 -20 -48 -15 -6 -55 -5 -34 -63 -10 -82 32 34 -85 38 37 -87 65 39 87 74 -39 92 75 -44 86 93 -36 57 27 -79 69 53 -94 80 46 -114 -15 14 -22 -11 17 -25 -12 26 -41 -54 -76 15 -76 -77 14 -42 -106 3 23 2 15 19 -3 30 26 -16 42 9 -15 -41 4 -15 -45 -7 -26 -61 -25 67 65 -48 61 70 -33 87 69 64 -58 60 90 -50 73 90 -75 80 25 93 -17 59 86 -10 62 94 -26 -69 -38 -77 -68 -60 -90 -79 -77 -100 -26 -61 51 -29 -77 42 -24 -79 42 -36 -40 6 -43 -22 27 -26 -49 -11 38 71 67 47 94 56 33 87 81 36 37 -1 33 52 -19 52 44 11 52 -3 20 61 -1 40 62 1 45 -48 9 -89 -61 -9 -87 -42 11 -103 -12 29 12 9 34 -8 -10 56 -24 49 -74 -72 53 -61 -84 54 -55 -108 82 37 -67 83 73 -67 77 49 -96 -96 -22 44 -110 -23 56 -117 -28 48 -79 85 59 -96 83 41 -93 93 35 78 39 -74 94 13 -87 97 34 -80 36 -38 20 31 -34 36 43 -45 23 -78 -75 78 -78 -82 74 -86 -110 70 -79 55 -33 -72 62 -63 -66 87 -33 -4 -28 -43 0 -52 -29 0 -35 -56 -50 -23 3 -81 -11 -4 -79 3 -31 34 78 46 33 79 47 18 100 18 -88 -55 -29 -88 -64 -38 -101 -72 -37 -83 -19 -10 -86 -19 -31 -97 -14 -8 25 61 15 51 42 25 28 63 30 107 2 85 112 8 90 115 28 86 57 -72 -61 44 -71 -79 72 -84 -88 -1 -21 27 -24 -8 29 -32 -39 15 -77 -49 52 -63 -48 73 -71 -44 79 30 -31 -19 32 -41 -20 51 -29 16 54 -24 92 56 -35 88 69 -23 113 12 -34 -20 15 -61 -7 -21 -73 10 54 19 20 76 5 9 78 2 -2 -9 -82 46 -3 -94 34 -4 -106 39 -54 -13 -38 -46 -13 -68 -44 -46 -71 -61 -18 106 -81 -16 99 -89 -53 102 32 91 0 41 107 -7 41 110 17 56 46 38 77 62 60 83 60 57 -93 -1 -27 -96 -19 -21 -96 0 -34 -6 -26 11 -23 7 35 -30 -11 47 24 78 -46 25 97 -20 9 107 -18 -30 18 -10 -26 -19 -24 -28 -5 -42 -29 79 68 -37 71 73 -59 97 90 16 76 -91 -14 72 -107 -4 98 -91 71 89 25 98 68 17 90 104 18 -52 -48 -11 -62 -41 -11 -72 -29 -51 -2 -46 -30 -23 -49 -15 -12 -81 -32 -28 67 29 -58 69 36 -51 64 61 64 29 7 44 42 43 60 47 46 113 24 63 95 29 89 109 29 86 36 10 92 26 0 98 35 20 106 80 -54 53 79 -60 67 95 -74 40 -44 74 -55 -51 107 -59 -35 104 -80 -75 62 -9 -78 82 -9 -84 83 -33 46 -73 -24 43 -77 -28 40 -100 -13 -10 19 -25 5 12 -36 -17 49 -44 -72 -49 -73 -93 -20 -73 -70 -37 -91 -83 24 -42 -81 43 -51 -83 47 -44 66 17 32 85 28 23 94 2 -2 20 -48 43 39 -44 56 60 -67 53 -74 -44 -75 -95 -42 -77 -83 -79 -88 42 50 -62 51 76 -69 69 81 -61 -46 90 -36 -55 88 -33 -41 110 -40 67 40 23 84 21 18 99 53 29 -56 -19 54 -45 -8 67 -64 -18 85 51 -63 -12 54 -73 -46 59 -81 -51 -84 22 63 -84 38 75 -74 43 85 2 5 -69 7 7 -89 -1 -33 -94 68 -39 27 92 -32 19 96 -39 10 84 -79 34 85 -102 42 89 -102 39 -71 -4 47 -74 5 47 -110 -23 70 49 -51 33 65 -24 48 80 -18 42 11 58 25 9 43 48 6 67 31 -70 6 -60 -60 19 -84 -80 4 -86 63 -6 20 56 -12 36 59 -18 32 61 63 57 31 97 65 62 95 66 93 -93 83 115 -64 85 86 -99 114 -80 54 48 -101 89 27 -112 73 42 46 20 -55 61 21 -82 82 46 -86 -71 -34 91 -73 -51 91 -50 -42 111 -28 31 38 -48 34 40 -29 49 47 -67 -38 25 -77 -35 29 -63 -51 59 -40 -35 -50 -15 -68 -26 -37 -68 -39 53 -83 78 63 -77 80 82 -116 66 27 31 -68 28 27 -82 8 0 -91 67 -10 -85 90 -27 -67 84 -12 -89 -5 -33 69 -35 -21 65 -1 -22 88 66 -67 -82 72 -64 -93 69 -52 -108 -43 6 -34 -29 25 -57 -46 18 -54 68 -43 48 84 -43 36 82 -51 40 -3 79 7 -17 80 -1 -1 83 8 -7 46 94 -19 38 96 -17 66 81 6 -25 1 -4 -30 9 15 -50 -18 43 -55 -21 62 -38 -11 70 -40 -8 48 -65 25 72 -68 26 57 -88 10 104 -30 70 103 -30 83 104 -48 91 -94 72 7 -89 95 5 -99 97 12 70 -14 -27 76 -7 -19 86 -1 -47 13 -69 51 12 -83 51 9 -104 81 -84 -60 -72 -101 -59 -69 -93 -48 -98 52 52 54 74 23 76 83 29 64 19 91 -48 25 100 -24 12 95 -62 32 -58 10 26 -71 -2 14 -81 26 -73 6 13 -66 11 36 -93 43 22 39 28 -77 32 14 -95 18 35 -109 -18 0 73 -49 0 63 -31 10 80 63 48 10 78 37 12 73 51 -2 68 17 11 93 14 25 105 2 46 -26 59 -16 -44 62 -28 -41 76 -12 -26 13 57 -21 16 67 -1 21 76 76 59 -14 96 64 -15 101 91 -25 -96 -65 56 -104 -49 60 -87 -78 82 -71 -28 29 -82 2 25 -110 -1 20 -39 -44 -1 -67 -28 -6 -33 -65 16 -29 -1 -52 -12 -24 -60 1 -30 -61 41 -51 -18 14 -81 -35 49 -75 1 -34 45 43 -38 58 49 -47 63 63 -26 58 25 -35 57 27 -14 81 42 8 15 68 27 16 68 12 0 79 69 -8 -27 85 6 1 108 -14 3 -33 -37 80 -36 -53 72 -61 -34 73 -106 94 44 -103 111 44 -104 110 69 -15 -53 39 -9 -25 66 -37 -56 70 63 -93 80 35 -93 108 72 -92 104 -28 -71 -83 -12 -84 -92 -43 -96 -115 69 19 8 80 38 -22 86 42 0 38 42 -13 47 52 -10 57 56 -14 73 -15 -51 89 10 -27 84 15 -60 35 -11 -58 15 -2 -92 43 -25 -81 -35 18 4 -49 -6 -5 -62 15 15 -74 60 -68 -89 34 -70 -102 62 -43 37 -10 68 49 2 72 59 -27 70 -17 -54 81 11 -55 93 -3 -81 97 60 15 94 66 14 92 55 4 105 -31 40 26 -37 36 28 -34 51 58 -80 77 12 -83 83 23 -112 53 16 -104 -72 39 -68 -106 44 -83 -93 57 73 32 -60 74 34 -60 83 28 -95 -76 60 -23 -104 50 -8 -96 73 1 42 75 -86 47 86 -96 40 101 -111 -19 -40 91 -49 -63 85 -30 -63 108 34 -18 -20 43 -12 -24 48 -14 -21 83 -44 79 94 -26 83 94 -9 102 -93 -1 103 -115 4 82 -105 -16 110 54 -21 -80 46 1 -119 51 -10 -118 -91 -88 82 -69 -110 84 -100 -106 91 -11 -38 9 -17 -38 -4 -24 -61 -3 7 -17 -1 6 -25 -27 9 -41 -2 33 -70 -60 34 -91 -70 23 -89 -87 2 9 -87 -30 30 -88 -29 6 -115 63 -52 -43 47 -62 -63 64 -70 -40 71 3 2 72 12 -26 94 -8 -17 -61 -46 76 -69 -67 73 -74 -48 96 -67 43 7 -70 77 -7 -81 75 1 -4 77 6 4 80 3 -8 101 2 8 10 36 18 14 46 18 32 37 26 -64 -79 27 -76 -74 32 -50 -94 -12 64 -63 -2 102 -78 16 101 -80 100 8 9 108 12 -11 118 8 3 48 -72 -26 60 -66 -43 64 -76 -30 -19 -12 -32 -29 0 -35 -42 -27 -42 20 -62 -11 14 -68 -3 22 -92 6 63 -6 85 72 -30 93 66 -27 112 -26 42 57 -38 49 71 -6 78 62 68 32 63 70 35 66 81 34 70 85 -66 -53 116 -56 -46 118 -84 -28 -1 -56 87 -8 -79 79 -3 -69 104 -52 -69 -72 -61 -89 -72 -55 -92 -78 32 73 -84 27 61 -101 25 56 -106 -67 -80 -78 -62 -114 -48 -55 -105 -73 -81 -45 47 -71 -44 66 -81 -54 85 3 38 41 -4 32 46 9 47 56 -66 -38 5 -66 -47 26 -99 -33 1 63 -14 -63 70 25 -62 71 -1 -75 -72 -40 87 -105 -60 79 -106 -25 114 31 -18 14 35 -16 28 69 -20 34 79 73 14 93 72 6 95 77 25 -22 109 -76 5 104 -89 6 93 -101 -91 65 -20 -89 76 -28 -113 64 -7 -53 -67 -64 -55 -52 -86 -65 -47 -103 87 -3 86 94 5 79 86 -12 88 -64 -13 47 -81 11 39 -90 14 74 -40 -95 59 -41 -81 82 -24 -112 68 64 -5 -32 82 -22 -22 99 -31 -29 30 38 -65 57 61 -28 58 62 -30 -15 -83 60 -35 -95 61 -43 -66 98 52 14 27 65 28 22 87 14 25 75 48 -29 91 40 -20 110 27 -40 28 -82 0 21 -92 -23 20 -108 -14 -37 -74 86 -33 -71 103 -21 -90 92 1 29 -37 -28 32 -44 3 48 -48 -74 54 -75 -99 50 -75 -113 45 -87 36 -73 -106 3 -93 -103 10 -102 -115 54 -82 72 74 -102 68 58 -112 68 -62 84 86 -76 78 86 -99 77 89 -3 37 13 -1 37 27 -30 42 18 73 -21 50 66 -49 66 57 -51 77 -104 45 25 -112 55 5 -117 56 4 21 81 1 44 71 -11 23 86 1 8 -43 -52 33 -62 -51 48 -42 -63 49 20 71 30 18 83 43 9 98 -71 -38 70 -53 -37 85 -87 -64 70 -74 44 33 -83 21 41 -93 12 39 73 -63 14 70 -66 20 72 -75 25 11 78 -32 32 92 -29 43 96 -9 -15 -78 -29 -13 -84 -27 -15 -90 -17 -70 -31 31 -94 -36 10 -71 -68 42 69 8 57 85 18 45 87 0 55 19 66 -28 31 75 -5 -1 89 -28 27 36 -79 33 35 -83 44 31 -87 38 13 45 55 5 68 67 24 55 26 75 -78 34 73 -78 40 67 -106 -99 40 -4 -85 67 -15 -116 39 -19 67 105 -3 66 111 16 98 106 7 23 9 -33 10 2 -45 40 -24 -48 74 -85 31 51 -88 59 65 -84 52 44 -22 6 33 -37 -18 45 -37 4 85 -88 69 93 -84 101 109 -69 97 13 -54 69 13 -54 83 50 -66 73 13 78 78 9 78 90 26 103 69 57 -29 33 63 -5 63 85 5 53 84 33 78 84 29 110 98 28 113 22 -81 -78 -8 -102 -86 2 -110 -77 -30 -49 19 -34 -50 15 -38 -53 10 -81 49 51 -93 72 31 -106 65 19 82 73 -76 103 57 -66 98 69 -74 0 -78 1 30 -72 -5 35 -93 31 84 35 -8 107 12 -10 104 30 -22 28 -37 -65 -1 -35 -79 22 -62 -88 -21 37 15 -10 55 -6 -37 72 15 17 -2 35 17 -16 55 42 11 50 -4 28 33 -3 51 42 25 48 64 46 -49 68 77 -53 65 78 -54 83 -10 -12 -16 -11 -9 -34 -18 12 -36 41 -90 -35 43 -103 -45 51 -111 -11 -42 -81 80 -17 -90 92 -15 -85 114 3 24 52 1 10 75 6 3 79 46 45 44 47 66 33 79 78 48 23 59 89 15 62 99 40 71 94 28 -43 -49 0 -61 -40 3 -62 -42 -74 85 44 -73 74 74 -69 91 82 -25 -45 63 -44 -62 64 -56 -43 74 15 -109 -5 5 -109 -21 1 -112 7 82 -32 -42 82 -39 -41 100 -58 -28 -32 78 -73 -25 106 -63 -6 98 -81 -100 87 43 -113 77 66 -119 75 65 -72 45 -37 -73 49 -38 -101 70 -46 -78 71 -14 -84 77 13 -94 66 12 -80 2 14 -110 35 30 -111 25 41 -12 9 4 -12 26 23 -16 46 15 6 -32 72 18 -44 79 -9 -19 90 -51 52 -18 -68 52 15 -74 56 -2 -46 -28 8 -57 -40 12 -75 -23 21 -12 -86 -80 -2 -77 -93 -8 -76 -107 30 -37 38 9 -55 28 4 -52 44 106 5 48 89 40 72 105 35 70 -80 -47 -22 -81 -49 -13 -85 -71 -12 -67 -73 -80 -74 -85 -81 -83 -95 -83 -84 2 69 -81 19 94 -114 22 76 62 -21 -54 66 -39 -56 71 -26 -67 16 62 -43 26 99 -44 27 97 -54 77 19 100 107 37 87 92 16 119 61 -11 -77 84 -16 -53 61 -6 -83 -2 -24 13 -8 -41 21 17 -44 19 -93 47 7 -78 72 -12 -97 79 3 49 -43 -61 72 -46 -38 37 -74 -63 -87 -56 60 -80 -58 77 -111 -55 65 -85 62 18 -85 91 28 -73 94 48 16 25 -44 36 28 -62 43 13 -71 -29 -6 11 -30 -4 16 -51 -14 5 82 -92 16 90 -102 17 109 -91 23 92 -3 -63 105 15 -68 111 14 -89 -87 -35 -52 -108 -43 -39 -105 -71 -50 -39 -87 -15 -52 -84 -36 -43 -87 -52 -69 98 66 -50 116 71 -57 114 71 20 56 -73 30 43 -92 10 45 -96 -12 -26 66 -25 -44 59 -15 -36 80 16 -68 -50 23 -94 -57 9 -80 -80 -61 10 21 -77 -1 4 -79 -24 26 32 -78 66 41 -73 86 67 -88 76
 
-#RUN: %lvl1 < %s
-#ANSWER: unknown
+#RUN: %lvl1 < %s | %fc %s
+#CHECK:      0
+#CHECK-NEXT: 1
+#CHECK-NEXT: 2
+#CHECK-NEXT: 4
+#CHECK-NEXT: 6
+#CHECK-NEXT: 7
+#CHECK-NEXT: 10
+#CHECK-NEXT: 12
+#CHECK-NEXT: 13
+#CHECK-NEXT: 14
+#CHECK-NEXT: 16
+#CHECK-NEXT: 17
+#CHECK-NEXT: 18
+#CHECK-NEXT: 20
+#CHECK-NEXT: 21
+#CHECK-NEXT: 22
+#CHECK-NEXT: 25
+#CHECK-NEXT: 28
+#CHECK-NEXT: 29
+#CHECK-NEXT: 30
+#CHECK-NEXT: 31
+#CHECK-NEXT: 32
+#CHECK-NEXT: 34
+#CHECK-NEXT: 35
+#CHECK-NEXT: 36
+#CHECK-NEXT: 37
+#CHECK-NEXT: 38
+#CHECK-NEXT: 39
+#CHECK-NEXT: 42
+#CHECK-NEXT: 43
+#CHECK-NEXT: 46
+#CHECK-NEXT: 47
+#CHECK-NEXT: 48
+#CHECK-NEXT: 49
+#CHECK-NEXT: 50
+#CHECK-NEXT: 51
+#CHECK-NEXT: 54
+#CHECK-NEXT: 55
+#CHECK-NEXT: 56
+#CHECK-NEXT: 57
+#CHECK-NEXT: 58
+#CHECK-NEXT: 61
+#CHECK-NEXT: 62
+#CHECK-NEXT: 63
+#CHECK-NEXT: 65
+#CHECK-NEXT: 66
+#CHECK-NEXT: 67
+#CHECK-NEXT: 68
+#CHECK-NEXT: 71
+#CHECK-NEXT: 73
+#CHECK-NEXT: 74
+#CHECK-NEXT: 75
+#CHECK-NEXT: 76
+#CHECK-NEXT: 78
+#CHECK-NEXT: 80
+#CHECK-NEXT: 82
+#CHECK-NEXT: 84
+#CHECK-NEXT: 87
+#CHECK-NEXT: 90
+#CHECK-NEXT: 91
+#CHECK-NEXT: 92
+#CHECK-NEXT: 93
+#CHECK-NEXT: 94
+#CHECK-NEXT: 97
+#CHECK-NEXT: 98
+#CHECK-NEXT: 99
+#CHECK-NEXT: 100
+#CHECK-NEXT: 101
+#CHECK-NEXT: 103
+#CHECK-NEXT: 104
+#CHECK-NEXT: 105
+#CHECK-NEXT: 108
+#CHECK-NEXT: 109
+#CHECK-NEXT: 111
+#CHECK-NEXT: 114
+#CHECK-NEXT: 115
+#CHECK-NEXT: 116
+#CHECK-NEXT: 120
+#CHECK-NEXT: 121
+#CHECK-NEXT: 123
+#CHECK-NEXT: 124
+#CHECK-NEXT: 125
+#CHECK-NEXT: 126
+#CHECK-NEXT: 127
+#CHECK-NEXT: 129
+#CHECK-NEXT: 131
+#CHECK-NEXT: 133
+#CHECK-NEXT: 134
+#CHECK-NEXT: 136
+#CHECK-NEXT: 137
+#CHECK-NEXT: 140
+#CHECK-NEXT: 141
+#CHECK-NEXT: 142
+#CHECK-NEXT: 145
+#CHECK-NEXT: 149
+#CHECK-NEXT: 150
+#CHECK-NEXT: 152
+#CHECK-NEXT: 155
+#CHECK-NEXT: 156
+#CHECK-NEXT: 157
+#CHECK-NEXT: 158
+#CHECK-NEXT: 161
+#CHECK-NEXT: 164
+#CHECK-NEXT: 165
+#CHECK-NEXT: 167
+#CHECK-NEXT: 169
+#CHECK-NEXT: 170
+#CHECK-NEXT: 171
+#CHECK-NEXT: 172
+#CHECK-NEXT: 173
+#CHECK-NEXT: 174
+#CHECK-NEXT: 176
+#CHECK-NEXT: 177
+#CHECK-NEXT: 178
+#CHECK-NEXT: 179
+#CHECK-NEXT: 180
+#CHECK-NEXT: 181
+#CHECK-NEXT: 182
+#CHECK-NEXT: 187
+#CHECK-NEXT: 188
+#CHECK-NEXT: 189
+#CHECK-NEXT: 191
+#CHECK-NEXT: 193
+#CHECK-NEXT: 195
+#CHECK-NEXT: 196
+#CHECK-NEXT: 197
+#CHECK-NEXT: 198
+#CHECK-NEXT: 199
+#CHECK-NEXT: 200
+#CHECK-NEXT: 201
+#CHECK-NEXT: 202
+#CHECK-NEXT: 203
+#CHECK-NEXT: 205
+#CHECK-NEXT: 206
+#CHECK-NEXT: 207
+#CHECK-NEXT: 208
+#CHECK-NEXT: 209
+#CHECK-NEXT: 213
+#CHECK-NEXT: 215
+#CHECK-NEXT: 217
+#CHECK-NEXT: 218
+#CHECK-NEXT: 219
+#CHECK-NEXT: 221
+#CHECK-NEXT: 222
+#CHECK-NEXT: 223
+#CHECK-NEXT: 224
+#CHECK-NEXT: 225
+#CHECK-NEXT: 226
+#CHECK-NEXT: 227
+#CHECK-NEXT: 228
+#CHECK-NEXT: 230
+#CHECK-NEXT: 231
+#CHECK-NEXT: 232
+#CHECK-NEXT: 233
+#CHECK-NEXT: 234
+#CHECK-NEXT: 237
+#CHECK-NEXT: 238
+#CHECK-NEXT: 239
+#CHECK-NEXT: 240
+#CHECK-NEXT: 241
+#CHECK-NEXT: 243
+#CHECK-NEXT: 245
+#CHECK-NEXT: 247
+#CHECK-NEXT: 251
+#CHECK-NEXT: 253
+#CHECK-NEXT: 254
+#CHECK-NEXT: 256
+#CHECK-NEXT: 259
+#CHECK-NEXT: 260
+#CHECK-NEXT: 261
+#CHECK-NEXT: 262
+#CHECK-NEXT: 265
+#CHECK-NEXT: 268
+#CHECK-NEXT: 269
+#CHECK-NEXT: 272
+#CHECK-NEXT: 273
+#CHECK-NEXT: 277
+#CHECK-NEXT: 278
+#CHECK-NEXT: 279
+#CHECK-NEXT: 280
+#CHECK-NEXT: 281
+#CHECK-NEXT: 282
+#CHECK-NEXT: 285
+#CHECK-NEXT: 286
+#CHECK-NEXT: 288
+#CHECK-NEXT: 289
+#CHECK-NEXT: 291
+#CHECK-NEXT: 292
+#CHECK-NEXT: 293
+#CHECK-NEXT: 294
+#CHECK-NEXT: 296
+#CHECK-NEXT: 298
+#CHECK-NEXT: 300
+#CHECK-NEXT: 301
+#CHECK-NEXT: 303
+#CHECK-NEXT: 305
+#CHECK-NEXT: 306
+#CHECK-NEXT: 308
+#CHECK-NEXT: 309
+#CHECK-NEXT: 311
+#CHECK-NEXT: 313
+#CHECK-NEXT: 315
+#CHECK-NEXT: 316
+#CHECK-NEXT: 321
+#CHECK-NEXT: 322
+#CHECK-NEXT: 323
+#CHECK-NEXT: 324
+#CHECK-NEXT: 325
+#CHECK-NEXT: 327
+#CHECK-NEXT: 328
+#CHECK-NEXT: 329
+#CHECK-NEXT: 330
+#CHECK-NEXT: 332
+#CHECK-NEXT: 333
+#CHECK-NEXT: 334
+#CHECK-NEXT: 335
+#CHECK-NEXT: 337
+#CHECK-NEXT: 339
+#CHECK-NEXT: 340
+#CHECK-NEXT: 341
+#CHECK-NEXT: 342
+#CHECK-NEXT: 343
+#CHECK-NEXT: 349
+#CHECK-NEXT: 350
+#CHECK-NEXT: 352
+#CHECK-NEXT: 353
+#CHECK-NEXT: 354
+#CHECK-NEXT: 355
+#CHECK-NEXT: 357
+#CHECK-NEXT: 358
+#CHECK-NEXT: 359
+#CHECK-NEXT: 360
+#CHECK-NEXT: 362
+#CHECK-NEXT: 365
+#CHECK-NEXT: 367
+#CHECK-NEXT: 368
+#CHECK-NEXT: 369
+#CHECK-NEXT: 370
+#CHECK-NEXT: 371
+#CHECK-NEXT: 373
+#CHECK-NEXT: 375
+#CHECK-NEXT: 376
+#CHECK-NEXT: 378
+#CHECK-NEXT: 381
+#CHECK-NEXT: 384
+#CHECK-NEXT: 386
+#CHECK-NEXT: 387
+#CHECK-NEXT: 389
+#CHECK-NEXT: 391
+#CHECK-NEXT: 396
+#CHECK-NEXT: 398
+#CHECK-NEXT: 399
+#CHECK-NEXT: 400
+#CHECK-NEXT: 401
+#CHECK-NEXT: 402
+#CHECK-NEXT: 405
+#CHECK-NEXT: 406
+#CHECK-NEXT: 407
+#CHECK-NEXT: 410
+#CHECK-NEXT: 415
+#CHECK-NEXT: 418
+#CHECK-NEXT: 419
+#CHECK-NEXT: 420
+#CHECK-NEXT: 421
+#CHECK-NEXT: 425
+#CHECK-NEXT: 428
+#CHECK-NEXT: 430
+#CHECK-NEXT: 432
+#CHECK-NEXT: 435
+#CHECK-NEXT: 436
+#CHECK-NEXT: 438
+#CHECK-NEXT: 439
+#CHECK-NEXT: 440
+#CHECK-NEXT: 441
+#CHECK-NEXT: 442
+#CHECK-NEXT: 445
+#CHECK-NEXT: 446
+#CHECK-NEXT: 447
+#CHECK-NEXT: 449
+#CHECK-NEXT: 450
+#CHECK-NEXT: 451
+#CHECK-NEXT: 452
+#CHECK-NEXT: 454
+#CHECK-NEXT: 455
+#CHECK-NEXT: 457
+#CHECK-NEXT: 458
+#CHECK-NEXT: 459
+#CHECK-NEXT: 462
+#CHECK-NEXT: 463
+#CHECK-NEXT: 466
+#CHECK-NEXT: 467
+#CHECK-NEXT: 468
+#CHECK-NEXT: 469
+#CHECK-NEXT: 470
+#CHECK-NEXT: 471
+#CHECK-NEXT: 472
+#CHECK-NEXT: 473
+#CHECK-NEXT: 475
+#CHECK-NEXT: 476
+#CHECK-NEXT: 481
+#CHECK-NEXT: 482
+#CHECK-NEXT: 483
+#CHECK-NEXT: 484
+#CHECK-NEXT: 485
+#CHECK-NEXT: 487
+#CHECK-NEXT: 488
+#CHECK-NEXT: 489
+#CHECK-NEXT: 491
+#CHECK-NEXT: 492
+#CHECK-NEXT: 493
+#CHECK-NEXT: 498
+#CHECK-NEXT: 499
+#CHECK-NEXT: 502
+#CHECK-NEXT: 503
+#CHECK-NEXT: 507
+#CHECK-NEXT: 508
+#CHECK-NEXT: 509
+#CHECK-NEXT: 510
+#CHECK-NEXT: 511
+#CHECK-NEXT: 512
+#CHECK-NEXT: 515
+#CHECK-NEXT: 518
+#CHECK-NEXT: 519
+#CHECK-NEXT: 520
+#CHECK-NEXT: 522
+#CHECK-NEXT: 525
+#CHECK-NEXT: 526
+#CHECK-NEXT: 528
+#CHECK-NEXT: 529
+#CHECK-NEXT: 530
+#CHECK-NEXT: 531
+#CHECK-NEXT: 534
+#CHECK-NEXT: 535
+#CHECK-NEXT: 536
+#CHECK-NEXT: 537
+#CHECK-NEXT: 539
+#CHECK-NEXT: 542
+#CHECK-NEXT: 543
+#CHECK-NEXT: 544
+#CHECK-NEXT: 545
+#CHECK-NEXT: 546
+#CHECK-NEXT: 547
+#CHECK-NEXT: 548
+#CHECK-NEXT: 549
+#CHECK-NEXT: 552
+#CHECK-NEXT: 553
+#CHECK-NEXT: 554
+#CHECK-NEXT: 555
+#CHECK-NEXT: 556
+#CHECK-NEXT: 557
+#CHECK-NEXT: 559
+#CHECK-NEXT: 561
+#CHECK-NEXT: 563
+#CHECK-NEXT: 564
+#CHECK-NEXT: 566
+#CHECK-NEXT: 568
+#CHECK-NEXT: 569
+#CHECK-NEXT: 572
+#CHECK-NEXT: 573
+#CHECK-NEXT: 574
+#CHECK-NEXT: 575
+#CHECK-NEXT: 576
+#CHECK-NEXT: 578
+#CHECK-NEXT: 580
+#CHECK-NEXT: 581
+#CHECK-NEXT: 582
+#CHECK-NEXT: 583
+#CHECK-NEXT: 584
+#CHECK-NEXT: 585
+#CHECK-NEXT: 586
+#CHECK-NEXT: 587
+#CHECK-NEXT: 588
+#CHECK-NEXT: 590
+#CHECK-NEXT: 594
+#CHECK-NEXT: 595
+#CHECK-NEXT: 597
+#CHECK-NEXT: 598
+#CHECK-NEXT: 602
+#CHECK-NEXT: 604
+#CHECK-NEXT: 605
+#CHECK-NEXT: 607
+#CHECK-NEXT: 612
+#CHECK-NEXT: 616
+#CHECK-NEXT: 617
+#CHECK-NEXT: 618
+#CHECK-NEXT: 620
+#CHECK-NEXT: 621
+#CHECK-NEXT: 623
+#CHECK-NEXT: 625
+#CHECK-NEXT: 627
+#CHECK-NEXT: 633
+#CHECK-NEXT: 635
+#CHECK-NEXT: 636
+#CHECK-NEXT: 637
+#CHECK-NEXT: 642
+#CHECK-NEXT: 644
+#CHECK-NEXT: 645
+#CHECK-NEXT: 647
+#CHECK-NEXT: 648
+#CHECK-NEXT: 649
+#CHECK-NEXT: 650
+#CHECK-NEXT: 652
+#CHECK-NEXT: 653
+#CHECK-NEXT: 654
+#CHECK-NEXT: 658
+#CHECK-NEXT: 661
+#CHECK-NEXT: 662
+#CHECK-NEXT: 663
+#CHECK-NEXT: 664
+#CHECK-NEXT: 665
+#CHECK-NEXT: 669
+#CHECK-NEXT: 670
+#CHECK-NEXT: 674
+#CHECK-NEXT: 675
+#CHECK-NEXT: 676
+#CHECK-NEXT: 677
+#CHECK-NEXT: 678
+#CHECK-NEXT: 679
+#CHECK-NEXT: 680
+#CHECK-NEXT: 684
+#CHECK-NEXT: 685
+#CHECK-NEXT: 687
+#CHECK-NEXT: 688
+#CHECK-NEXT: 689
+#CHECK-NEXT: 690
+#CHECK-NEXT: 691
+#CHECK-NEXT: 693
+#CHECK-NEXT: 694
+#CHECK-NEXT: 695
+#CHECK-NEXT: 696
+#CHECK-NEXT: 697
+#CHECK-NEXT: 700
+#CHECK-NEXT: 701
+#CHECK-NEXT: 703
+#CHECK-NEXT: 707
+#CHECK-NEXT: 708
+#CHECK-NEXT: 709
+#CHECK-NEXT: 710
+#CHECK-NEXT: 714
+#CHECK-NEXT: 715
+#CHECK-NEXT: 717
+#CHECK-NEXT: 719
+#CHECK-NEXT: 720
+#CHECK-NEXT: 721
+#CHECK-NEXT: 722
+#CHECK-NEXT: 725
+#CHECK-NEXT: 726
+#CHECK-NEXT: 727
+#CHECK-NEXT: 730
+#CHECK-NEXT: 731
+#CHECK-NEXT: 732
+#CHECK-NEXT: 735
+#CHECK-NEXT: 738
+#CHECK-NEXT: 740
+#CHECK-NEXT: 746
+#CHECK-NEXT: 747
+#CHECK-NEXT: 748
+#CHECK-NEXT: 749
+#CHECK-NEXT: 750
+#CHECK-NEXT: 751
+#CHECK-NEXT: 753
+#CHECK-NEXT: 755
+#CHECK-NEXT: 757
+#CHECK-NEXT: 758
+#CHECK-NEXT: 759
+#CHECK-NEXT: 761
+#CHECK-NEXT: 762
+#CHECK-NEXT: 763
+#CHECK-NEXT: 764
+#CHECK-NEXT: 766
+#CHECK-NEXT: 768
+#CHECK-NEXT: 770
+#CHECK-NEXT: 771
+#CHECK-NEXT: 774
+#CHECK-NEXT: 775
+#CHECK-NEXT: 776
+#CHECK-NEXT: 778
+#CHECK-NEXT: 780
+#CHECK-NEXT: 785
+#CHECK-NEXT: 788
+#CHECK-NEXT: 789
+#CHECK-NEXT: 790
+#CHECK-NEXT: 791
+#CHECK-NEXT: 793
+#CHECK-NEXT: 795
+#CHECK-NEXT: 798
+#CHECK-NEXT: 799
+#CHECK-NEXT: 800
+#CHECK-NEXT: 801
+#CHECK-NEXT: 802
+#CHECK-NEXT: 803
+#CHECK-NEXT: 804
+#CHECK-NEXT: 805
+#CHECK-NEXT: 806
+#CHECK-NEXT: 808
+#CHECK-NEXT: 809
+#CHECK-NEXT: 812
+#CHECK-NEXT: 813
+#CHECK-NEXT: 817
+#CHECK-NEXT: 818
+#CHECK-NEXT: 819
+#CHECK-NEXT: 820
+#CHECK-NEXT: 821
+#CHECK-NEXT: 822
+#CHECK-NEXT: 823
+#CHECK-NEXT: 827
+#CHECK-NEXT: 829
+#CHECK-NEXT: 831
+#CHECK-NEXT: 833
+#CHECK-NEXT: 834
+#CHECK-NEXT: 835
+#CHECK-NEXT: 839
+#CHECK-NEXT: 840
+#CHECK-NEXT: 842
+#CHECK-NEXT: 844
+#CHECK-NEXT: 847
+#CHECK-NEXT: 848
+#CHECK-NEXT: 849
+#CHECK-NEXT: 850
+#CHECK-NEXT: 851
+#CHECK-NEXT: 852
+#CHECK-NEXT: 853
+#CHECK-NEXT: 855
+#CHECK-NEXT: 858
+#CHECK-NEXT: 866
+#CHECK-NEXT: 867
+#CHECK-NEXT: 869
+#CHECK-NEXT: 870
+#CHECK-NEXT: 871
+#CHECK-NEXT: 872
+#CHECK-NEXT: 873
+#CHECK-NEXT: 875
+#CHECK-NEXT: 877
+#CHECK-NEXT: 879
+#CHECK-NEXT: 880
+#CHECK-NEXT: 881
+#CHECK-NEXT: 882
+#CHECK-NEXT: 883
+#CHECK-NEXT: 884
+#CHECK-NEXT: 886
+#CHECK-NEXT: 887
+#CHECK-NEXT: 888
+#CHECK-NEXT: 889
+#CHECK-NEXT: 890
+#CHECK-NEXT: 891
+#CHECK-NEXT: 892
+#CHECK-NEXT: 893
+#CHECK-NEXT: 895
+#CHECK-NEXT: 896
+#CHECK-NEXT: 898
+#CHECK-NEXT: 901
+#CHECK-NEXT: 902
+#CHECK-NEXT: 903
+#CHECK-NEXT: 904
+#CHECK-NEXT: 905
+#CHECK-NEXT: 906
+#CHECK-NEXT: 908
+#CHECK-NEXT: 909
+#CHECK-NEXT: 910
+#CHECK-NEXT: 911
+#CHECK-NEXT: 914
+#CHECK-NEXT: 915
+#CHECK-NEXT: 916
+#CHECK-NEXT: 918
+#CHECK-NEXT: 919
+#CHECK-NEXT: 921
+#CHECK-NEXT: 922
+#CHECK-NEXT: 923
+#CHECK-NEXT: 924
+#CHECK-NEXT: 926
+#CHECK-NEXT: 927
+#CHECK-NEXT: 928
+#CHECK-NEXT: 930
+#CHECK-NEXT: 931
+#CHECK-NEXT: 932
+#CHECK-NEXT: 934
+#CHECK-NEXT: 935
+#CHECK-NEXT: 936
+#CHECK-NEXT: 937
+#CHECK-NEXT: 939
+#CHECK-NEXT: 940
+#CHECK-NEXT: 943
+#CHECK-NEXT: 944
+#CHECK-NEXT: 945
+#CHECK-NEXT: 946
+#CHECK-NEXT: 947
+#CHECK-NEXT: 948
+#CHECK-NEXT: 949
+#CHECK-NEXT: 950
+#CHECK-NEXT: 951
+#CHECK-NEXT: 952
+#CHECK-NEXT: 955
+#CHECK-NEXT: 959
+#CHECK-NEXT: 960
+#CHECK-NEXT: 964
+#CHECK-NEXT: 967
+#CHECK-NEXT: 968
+#CHECK-NEXT: 969
+#CHECK-NEXT: 970
+#CHECK-NEXT: 971
+#CHECK-NEXT: 972
+#CHECK-NEXT: 975
+#CHECK-NEXT: 983
+#CHECK-NEXT: 984
+#CHECK-NEXT: 985
+#CHECK-NEXT: 986
+#CHECK-NEXT: 987
+#CHECK-NEXT: 988
+#CHECK-NEXT: 992
+#CHECK-NEXT: 993
+#CHECK-NEXT: 995
+#CHECK-NEXT: 996
+#CHECK-NEXT: 997
+#CHECK-NEXT: 999
+#CHECK-NOT:  {{[0-9]+}}
@@ -39999,5 +39999,21 @@
 6179.421760573947 4182.166864530428 9069.844269429694
 6203.656377805522 4148.239229494985 9070.12151781359
 
-#RUN: %lvl1 < %s
-#ANSWER: unknown
+#RUN: %lvl1 < %s | %fc %s
+#CHECK:      247
+#CHECK-NEXT: 285
+#CHECK-NEXT: 1328
+#CHECK-NEXT: 3015
+#CHECK-NEXT: 3049
+#CHECK-NEXT: 3263
+#CHECK-NEXT: 3289
+#CHECK-NEXT: 3900
+#CHECK-NEXT: 4050
+#CHECK-NEXT: 4086
+#CHECK-NEXT: 6727
+#CHECK-NEXT: 6763
+#CHECK-NEXT: 7520
+#CHECK-NEXT: 7659
+#CHECK-NEXT: 7953
+#CHECK-NEXT: 8749
+#CHECK-NOT:  {{[0-9]+}}
@@ -0,0 +1,18 @@
+3
+
+5 5 0
+5 5 1
+5 5 1
+
+5 5 1
+5 5 -1
+5 5 -1
+
+5 5 3
+5 5 2
+5 5 2
+
+#RUN: %lvl1 < %s | %fc %s
+#CHECK:     0
+#CHECK:     1
+#CHECK-NOT: {{[0-9]+}}
@@ -0,0 +1,23 @@
+4
+
+1000 0 0
+0 1000 0
+0 0 1000
+
+333 333 334
+400 400 400
+500 300 400
+
+300 366 334.001
+350 420 450
+250 450 450
+
+500 500 0
+600 600 -100
+400 700 -50
+
+#RUN: %lvl1 < %s | %fc %s
+#CHECK:      0
+#CHECK-NEXT: 1
+#CHECK-NEXT: 3
+#CHECK-NOT:  {{[0-9]+}}
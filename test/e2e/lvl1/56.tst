@@ -0,0 +1,23 @@
+4
+
+-1000 -1000 0.5
+1000 -1000 0.5
+0 1000 0.5
+
+0 0 0.5
+10 0 20
+0 10 20
+
+-1000 -1000 0.50002
+1000 -1000 0.50002
+0 1000 0.50002
+
+700 -900 0.49998
+800 -900 -10
+750 -800 -10
+
+#RUN: %lvl1 < %s | %fc %s
+#CHECK:      0
+#CHECK-NEXT: 1
+#CHECK-NEXT: 2
+#CHECK-NOT:  {{[0-9]+}}
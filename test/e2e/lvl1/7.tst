@@ -37,6 +37,6 @@
 15 15 0
 
 #RUN: %lvl1 < %s | %fc %s
-#CHECK:     0
-#CHECK:     8
-#CHECK-NOT: {{[0-9]+}}
+#CHECK:      0
+#CHECK-NEXT: 8
+#CHECK-NOT:  {{[0-9]+}}
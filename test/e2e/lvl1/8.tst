@@ -3000,5 +3000,1005 @@
 -870 309 -569
 821 817 996
 
-#RUN: %lvl1 < %s
-#ANSWER: unknown
+#RUN: %lvl1 < %s | %fc %s
+#CHECK:      0
+#CHECK-NEXT: 1
+#CHECK-NEXT: 2
+#CHECK-NEXT: 3
+#CHECK-NEXT: 4
+#CHECK-NEXT: 5
+#CHECK-NEXT: 6
+#CHECK-NEXT: 7
+#CHECK-NEXT: 8
+#CHECK-NEXT: 9
+#CHECK-NEXT: 10
+#CHECK-NEXT: 11
+#CHECK-NEXT: 12
+#CHECK-NEXT: 13
+#CHECK-NEXT: 14
+#CHECK-NEXT: 15
+#CHECK-NEXT: 16
+#CHECK-NEXT: 17
+#CHECK-NEXT: 18
+#CHECK-NEXT: 19
+#CHECK-NEXT: 20
+#CHECK-NEXT: 21
+#CHECK-NEXT: 22
+#CHECK-NEXT: 23
+#CHECK-NEXT: 24
+#CHECK-NEXT: 25
+#CHECK-NEXT: 26
+#CHECK-NEXT: 27
+#CHECK-NEXT: 28
+#CHECK-NEXT: 29
+#CHECK-NEXT: 30
+#CHECK-NEXT: 31
+#CHECK-NEXT: 32
+#CHECK-NEXT: 33
+#CHECK-NEXT: 34
+#CHECK-NEXT: 35
+#CHECK-NEXT: 36
+#CHECK-NEXT: 37
+#CHECK-NEXT: 38
+#CHECK-NEXT: 39
+#CHECK-NEXT: 40
+#CHECK-NEXT: 41
+#CHECK-NEXT: 42
+#CHECK-NEXT: 43
+#CHECK-NEXT: 44
+#CHECK-NEXT: 45
+#CHECK-NEXT: 46
+#CHECK-NEXT: 47
+#CHECK-NEXT: 48
+#CHECK-NEXT: 49
+#CHECK-NEXT: 50
+#CHECK-NEXT: 51
+#CHECK-NEXT: 52
+#CHECK-NEXT: 53
+#CHECK-NEXT: 54
+#CHECK-NEXT: 55
+#CHECK-NEXT: 56
+#CHECK-NEXT: 57
+#CHECK-NEXT: 58
+#CHECK-NEXT: 59
+#CHECK-NEXT: 60
+#CHECK-NEXT: 61
+#CHECK-NEXT: 62
+#CHECK-NEXT: 63
+#CHECK-NEXT: 64
+#CHECK-NEXT: 65
+#CHECK-NEXT: 66
+#CHECK-NEXT: 67
+#CHECK-NEXT: 68
+#CHECK-NEXT: 69
+#CHECK-NEXT: 70
+#CHECK-NEXT: 71
+#CHECK-NEXT: 72
+#CHECK-NEXT: 73
+#CHECK-NEXT: 74
+#CHECK-NEXT: 75
+#CHECK-NEXT: 76
+#CHECK-NEXT: 77
+#CHECK-NEXT: 78
+#CHECK-NEXT: 79
+#CHECK-NEXT: 80
+#CHECK-NEXT: 81
+#CHECK-NEXT: 82
+#CHECK-NEXT: 83
+#CHECK-NEXT: 84
+#CHECK-NEXT: 85
+#CHECK-NEXT: 86
+#CHECK-NEXT: 87
+#CHECK-NEXT: 88
+#CHECK-NEXT: 89
+#CHECK-NEXT: 90
+#CHECK-NEXT: 91
+#CHECK-NEXT: 92
+#CHECK-NEXT: 93
+#CHECK-NEXT: 94
+#CHECK-NEXT: 95
+#CHECK-NEXT: 96
+#CHECK-NEXT: 97
+#CHECK-NEXT: 98
+#CHECK-NEXT: 99
+#CHECK-NEXT: 100
+#CHECK-NEXT: 101
+#CHECK-NEXT: 102
+#CHECK-NEXT: 103
+#CHECK-NEXT: 104
+#CHECK-NEXT: 105
+#CHECK-NEXT: 106
+#CHECK-NEXT: 107
+#CHECK-NEXT: 108
+#CHECK-NEXT: 109
+#CHECK-NEXT: 110
+#CHECK-NEXT: 111
+#CHECK-NEXT: 112
+#CHECK-NEXT: 113
+#CHECK-NEXT: 114
+#CHECK-NEXT: 115
+#CHECK-NEXT: 116
+#CHECK-NEXT: 117
+#CHECK-NEXT: 118
+#CHECK-NEXT: 119
+#CHECK-NEXT: 120
+#CHECK-NEXT: 121
+#CHECK-NEXT: 122
+#CHECK-NEXT: 123
+#CHECK-NEXT: 124
+#CHECK-NEXT: 125
+#CHECK-NEXT: 126
+#CHECK-NEXT: 127
+#CHECK-NEXT: 128
+#CHECK-NEXT: 129
+#CHECK-NEXT: 130
+#CHECK-NEXT: 131
+#CHECK-NEXT: 132
+#CHECK-NEXT: 133
+#CHECK-NEXT: 134
+#CHECK-NEXT: 135
+#CHECK-NEXT: 136
+#CHECK-NEXT: 137
+#CHECK-NEXT: 138
+#CHECK-NEXT: 139
+#CHECK-NEXT: 140
+#CHECK-NEXT: 141
+#CHECK-NEXT: 142
+#CHECK-NEXT: 143
+#CHECK-NEXT: 144
+#CHECK-NEXT: 145
+#CHECK-NEXT: 146
+#CHECK-NEXT: 147
+#CHECK-NEXT: 148
+#CHECK-NEXT: 149
+#CHECK-NEXT: 150
+#CHECK-NEXT: 151
+#CHECK-NEXT: 152
+#CHECK-NEXT: 153
+#CHECK-NEXT: 154
+#CHECK-NEXT: 155
+#CHECK-NEXT: 156
+#CHECK-NEXT: 157
+#CHECK-NEXT: 158
+#CHECK-NEXT: 159
+#CHECK-NEXT: 160
+#CHECK-NEXT: 161
+#CHECK-NEXT: 162
+#CHECK-NEXT: 163
+#CHECK-NEXT: 164
+#CHECK-NEXT: 165
+#CHECK-NEXT: 166
+#CHECK-NEXT: 167
+#CHECK-NEXT: 168
+#CHECK-NEXT: 169
+#CHECK-NEXT: 170
+#CHECK-NEXT: 171
+#CHECK-NEXT: 172
+#CHECK-NEXT: 173
+#CHECK-NEXT: 174
+#CHECK-NEXT: 175
+#CHECK-NEXT: 176
+#CHECK-NEXT: 177
+#CHECK-NEXT: 178
+#CHECK-NEXT: 179
+#CHECK-NEXT: 180
+#CHECK-NEXT: 181
+#CHECK-NEXT: 182
+#CHECK-NEXT: 183
+#CHECK-NEXT: 184
+#CHECK-NEXT: 185
+#CHECK-NEXT: 186
+#CHECK-NEXT: 187
+#CHECK-NEXT: 188
+#CHECK-NEXT: 189
+#CHECK-NEXT: 190
+#CHECK-NEXT: 191
+#CHECK-NEXT: 192
+#CHECK-NEXT: 193
+#CHECK-NEXT: 194
+#CHECK-NEXT: 195
+#CHECK-NEXT: 196
+#CHECK-NEXT: 197
+#CHECK-NEXT: 198
+#CHECK-NEXT: 199
+#CHECK-NEXT: 200
+#CHECK-NEXT: 201
+#CHECK-NEXT: 202
+#CHECK-NEXT: 203
+#CHECK-NEXT: 204
+#CHECK-NEXT: 205
+#CHECK-NEXT: 206
+#CHECK-NEXT: 207
+#CHECK-NEXT: 208
+#CHECK-NEXT: 209
+#CHECK-NEXT: 210
+#CHECK-NEXT: 211
+#CHECK-NEXT: 212
+#CHECK-NEXT: 213
+#CHECK-NEXT: 214
+#CHECK-NEXT: 215
+#CHECK-NEXT: 216
+#CHECK-NEXT: 217
+#CHECK-NEXT: 218
+#CHECK-NEXT: 219
+#CHECK-NEXT: 220
+#CHECK-NEXT: 221
+#CHECK-NEXT: 222
+#CHECK-NEXT: 223
+#CHECK-NEXT: 224
+#CHECK-NEXT: 225
+#CHECK-NEXT: 226
+#CHECK-NEXT: 227
+#CHECK-NEXT: 228
+#CHECK-NEXT: 229
+#CHECK-NEXT: 230
+#CHECK-NEXT: 231
+#CHECK-NEXT: 232
+#CHECK-NEXT: 233
+#CHECK-NEXT: 234
+#CHECK-NEXT: 235
+#CHECK-NEXT: 236
+#CHECK-NEXT: 237
+#CHECK-NEXT: 238
+#CHECK-NEXT: 239
+#CHECK-NEXT: 240
+#CHECK-NEXT: 241
+#CHECK-NEXT: 242
+#CHECK-NEXT: 243
+#CHECK-NEXT: 244
+#CHECK-NEXT: 245
+#CHECK-NEXT: 246
+#CHECK-NEXT: 247
+#CHECK-NEXT: 248
+#CHECK-NEXT: 249
+#CHECK-NEXT: 250
+#CHECK-NEXT: 251
+#CHECK-NEXT: 252
+#CHECK-NEXT: 253
+#CHECK-NEXT: 254
+#CHECK-NEXT: 255
+#CHECK-NEXT: 256
+#CHECK-NEXT: 257
+#CHECK-NEXT: 258
+#CHECK-NEXT: 259
+#CHECK-NEXT: 260
+#CHECK-NEXT: 261
+#CHECK-NEXT: 262
+#CHECK-NEXT: 263
+#CHECK-NEXT: 264
+#CHECK-NEXT: 265
+#CHECK-NEXT: 266
+#CHECK-NEXT: 267
+#CHECK-NEXT: 268
+#CHECK-NEXT: 269
+#CHECK-NEXT: 270
+#CHECK-NEXT: 271
+#CHECK-NEXT: 272
+#CHECK-NEXT: 273
+#CHECK-NEXT: 274
+#CHECK-NEXT: 275
+#CHECK-NEXT: 276
+#CHECK-NEXT: 277
+#CHECK-NEXT: 278
+#CHECK-NEXT: 279
+#CHECK-NEXT: 280
+#CHECK-NEXT: 281
+#CHECK-NEXT: 282
+#CHECK-NEXT: 283
+#CHECK-NEXT: 284
+#CHECK-NEXT: 285
+#CHECK-NEXT: 286
+#CHECK-NEXT: 287
+#CHECK-NEXT: 288
+#CHECK-NEXT: 289
+#CHECK-NEXT: 290
+#CHECK-NEXT: 291
+#CHECK-NEXT: 292
+#CHECK-NEXT: 293
+#CHECK-NEXT: 294
+#CHECK-NEXT: 295
+#CHECK-NEXT: 296
+#CHECK-NEXT: 297
+#CHECK-NEXT: 298
+#CHECK-NEXT: 299
+#CHECK-NEXT: 300
+#CHECK-NEXT: 301
+#CHECK-NEXT: 302
+#CHECK-NEXT: 303
+#CHECK-NEXT: 304
+#CHECK-NEXT: 305
+#CHECK-NEXT: 306
+#CHECK-NEXT: 307
+#CHECK-NEXT: 308
+#CHECK-NEXT: 309
+#CHECK-NEXT: 310
+#CHECK-NEXT: 311
+#CHECK-NEXT: 312
+#CHECK-NEXT: 313
+#CHECK-NEXT: 314
+#CHECK-NEXT: 315
+#CHECK-NEXT: 316
+#CHECK-NEXT: 317
+#CHECK-NEXT: 318
+#CHECK-NEXT: 319
+#CHECK-NEXT: 320
+#CHECK-NEXT: 321
+#CHECK-NEXT: 322
+#CHECK-NEXT: 323
+#CHECK-NEXT: 324
+#CHECK-NEXT: 325
+#CHECK-NEXT: 326
+#CHECK-NEXT: 327
+#CHECK-NEXT: 328
+#CHECK-NEXT: 329
+#CHECK-NEXT: 330
+#CHECK-NEXT: 331
+#CHECK-NEXT: 332
+#CHECK-NEXT: 333
+#CHECK-NEXT: 334
+#CHECK-NEXT: 335
+#CHECK-NEXT: 336
+#CHECK-NEXT: 337
+#CHECK-NEXT: 338
+#CHECK-NEXT: 339
+#CHECK-NEXT: 340
+#CHECK-NEXT: 341
+#CHECK-NEXT: 342
+#CHECK-NEXT: 343
+#CHECK-NEXT: 344
+#CHECK-NEXT: 345
+#CHECK-NEXT: 346
+#CHECK-NEXT: 347
+#CHECK-NEXT: 348
+#CHECK-NEXT: 349
+#CHECK-NEXT: 350
+#CHECK-NEXT: 351
+#CHECK-NEXT: 352
+#CHECK-NEXT: 353
+#CHECK-NEXT: 354
+#CHECK-NEXT: 355
+#CHECK-NEXT: 356
+#CHECK-NEXT: 357
+#CHECK-NEXT: 358
+#CHECK-NEXT: 359
+#CHECK-NEXT: 360
+#CHECK-NEXT: 361
+#CHECK-NEXT: 362
+#CHECK-NEXT: 363
+#CHECK-NEXT: 364
+#CHECK-NEXT: 365
+#CHECK-NEXT: 366
+#CHECK-NEXT: 367
+#CHECK-NEXT: 368
+#CHECK-NEXT: 369
+#CHECK-NEXT: 370
+#CHECK-NEXT: 371
+#CHECK-NEXT: 372
+#CHECK-NEXT: 373
+#CHECK-NEXT: 374
+#CHECK-NEXT: 375
+#CHECK-NEXT: 376
+#CHECK-NEXT: 377
+#CHECK-NEXT: 378
+#CHECK-NEXT: 379
+#CHECK-NEXT: 380
+#CHECK-NEXT: 381
+#CHECK-NEXT: 382
+#CHECK-NEXT: 383
+#CHECK-NEXT: 384
+#CHECK-NEXT: 385
+#CHECK-NEXT: 386
+#CHECK-NEXT: 387
+#CHECK-NEXT: 388
+#CHECK-NEXT: 389
+#CHECK-NEXT: 390
+#CHECK-NEXT: 391
+#CHECK-NEXT: 392
+#CHECK-NEXT: 393
+#CHECK-NEXT: 394
+#CHECK-NEXT: 395
+#CHECK-NEXT: 396
+#CHECK-NEXT: 397
+#CHECK-NEXT: 398
+#CHECK-NEXT: 399
+#CHECK-NEXT: 400
+#CHECK-NEXT: 401
+#CHECK-NEXT: 402
+#CHECK-NEXT: 403
+#CHECK-NEXT: 404
+#CHECK-NEXT: 405
+#CHECK-NEXT: 406
+#CHECK-NEXT: 407
+#CHECK-NEXT: 408
+#CHECK-NEXT: 409
+#CHECK-NEXT: 410
+#CHECK-NEXT: 411
+#CHECK-NEXT: 412
+#CHECK-NEXT: 413
+#CHECK-NEXT: 414
+#CHECK-NEXT: 415
+#CHECK-NEXT: 416
+#CHECK-NEXT: 417
+#CHECK-NEXT: 418
+#CHECK-NEXT: 419
+#CHECK-NEXT: 420
+#CHECK-NEXT: 421
+#CHECK-NEXT: 422
+#CHECK-NEXT: 423
+#CHECK-NEXT: 424
+#CHECK-NEXT: 425
+#CHECK-NEXT: 426
+#CHECK-NEXT: 427
+#CHECK-NEXT: 428
+#CHECK-NEXT: 429
+#CHECK-NEXT: 430
+#CHECK-NEXT: 431
+#CHECK-NEXT: 432
+#CHECK-NEXT: 433
+#CHECK-NEXT: 434
+#CHECK-NEXT: 435
+#CHECK-NEXT: 436
+#CHECK-NEXT: 437
+#CHECK-NEXT: 438
+#CHECK-NEXT: 439
+#CHECK-NEXT: 440
+#CHECK-NEXT: 441
+#CHECK-NEXT: 442
+#CHECK-NEXT: 443
+#CHECK-NEXT: 444
+#CHECK-NEXT: 445
+#CHECK-NEXT: 446
+#CHECK-NEXT: 447
+#CHECK-NEXT: 448
+#CHECK-NEXT: 449
+#CHECK-NEXT: 450
+#CHECK-NEXT: 451
+#CHECK-NEXT: 452
+#CHECK-NEXT: 453
+#CHECK-NEXT: 454
+#CHECK-NEXT: 455
+#CHECK-NEXT: 456
+#CHECK-NEXT: 457
+#CHECK-NEXT: 458
+#CHECK-NEXT: 459
+#CHECK-NEXT: 460
+#CHECK-NEXT: 461
+#CHECK-NEXT: 462
+#CHECK-NEXT: 463
+#CHECK-NEXT: 464
+#CHECK-NEXT: 465
+#CHECK-NEXT: 466
+#CHECK-NEXT: 467
+#CHECK-NEXT: 468
+#CHECK-NEXT: 469
+#CHECK-NEXT: 470
+#CHECK-NEXT: 471
+#CHECK-NEXT: 472
+#CHECK-NEXT: 473
+#CHECK-NEXT: 474
+#CHECK-NEXT: 475
+#CHECK-NEXT: 476
+#CHECK-NEXT: 477
+#CHECK-NEXT: 478
+#CHECK-NEXT: 479
+#CHECK-NEXT: 480
+#CHECK-NEXT: 481
+#CHECK-NEXT: 482
+#CHECK-NEXT: 483
+#CHECK-NEXT: 484
+#CHECK-NEXT: 485
+#CHECK-NEXT: 486
+#CHECK-NEXT: 487
+#CHECK-NEXT: 488
+#CHECK-NEXT: 489
+#CHECK-NEXT: 490
+#CHECK-NEXT: 491
+#CHECK-NEXT: 492
+#CHECK-NEXT: 493
+#CHECK-NEXT: 494
+#CHECK-NEXT: 495
+#CHECK-NEXT: 496
+#CHECK-NEXT: 497
+#CHECK-NEXT: 498
+#CHECK-NEXT: 499
+#CHECK-NEXT: 500
+#CHECK-NEXT: 501
+#CHECK-NEXT: 502
+#CHECK-NEXT: 503
+#CHECK-NEXT: 504
+#CHECK-NEXT: 505
+#CHECK-NEXT: 506
+#CHECK-NEXT: 507
+#CHECK-NEXT: 508
+#CHECK-NEXT: 509
+#CHECK-NEXT: 510
+#CHECK-NEXT: 511
+#CHECK-NEXT: 512
+#CHECK-NEXT: 513
+#CHECK-NEXT: 514
+#CHECK-NEXT: 515
+#CHECK-NEXT: 516
+#CHECK-NEXT: 517
+#CHECK-NEXT: 518
+#CHECK-NEXT: 519
+#CHECK-NEXT: 520
+#CHECK-NEXT: 521
+#CHECK-NEXT: 522
+#CHECK-NEXT: 523
+#CHECK-NEXT: 524
+#CHECK-NEXT: 525
+#CHECK-NEXT: 526
+#CHECK-NEXT: 527
+#CHECK-NEXT: 528
+#CHECK-NEXT: 529
+#CHECK-NEXT: 530
+#CHECK-NEXT: 531
+#CHECK-NEXT: 532
+#CHECK-NEXT: 533
+#CHECK-NEXT: 534
+#CHECK-NEXT: 535
+#CHECK-NEXT: 536
+#CHECK-NEXT: 537
+#CHECK-NEXT: 538
+#CHECK-NEXT: 539
+#CHECK-NEXT: 540
+#CHECK-NEXT: 541
+#CHECK-NEXT: 542
+#CHECK-NEXT: 543
+#CHECK-NEXT: 544
+#CHECK-NEXT: 545
+#CHECK-NEXT: 546
+#CHECK-NEXT: 547
+#CHECK-NEXT: 548
+#CHECK-NEXT: 549
+#CHECK-NEXT: 550
+#CHECK-NEXT: 551
+#CHECK-NEXT: 552
+#CHECK-NEXT: 553
+#CHECK-NEXT: 554
+#CHECK-NEXT: 555
+#CHECK-NEXT: 556
+#CHECK-NEXT: 557
+#CHECK-NEXT: 558
+#CHECK-NEXT: 559
+#CHECK-NEXT: 560
+#CHECK-NEXT: 561
+#CHECK-NEXT: 562
+#CHECK-NEXT: 563
+#CHECK-NEXT: 564
+#CHECK-NEXT: 565
+#CHECK-NEXT: 566
+#CHECK-NEXT: 567
+#CHECK-NEXT: 568
+#CHECK-NEXT: 569
+#CHECK-NEXT: 570
+#CHECK-NEXT: 571
+#CHECK-NEXT: 572
+#CHECK-NEXT: 573
+#CHECK-NEXT: 574
+#CHECK-NEXT: 575
+#CHECK-NEXT: 576
+#CHECK-NEXT: 577
+#CHECK-NEXT: 578
+#CHECK-NEXT: 579
+#CHECK-NEXT: 580
+#CHECK-NEXT: 581
+#CHECK-NEXT: 582
+#CHECK-NEXT: 583
+#CHECK-NEXT: 584
+#CHECK-NEXT: 585
+#CHECK-NEXT: 586
+#CHECK-NEXT: 587
+#CHECK-NEXT: 588
+#CHECK-NEXT: 589
+#CHECK-NEXT: 590
+#CHECK-NEXT: 591
+#CHECK-NEXT: 592
+#CHECK-NEXT: 593
+#CHECK-NEXT: 594
+#CHECK-NEXT: 595
+#CHECK-NEXT: 596
+#CHECK-NEXT: 597
+#CHECK-NEXT: 598
+#CHECK-NEXT: 599
+#CHECK-NEXT: 600
+#CHECK-NEXT: 601
+#CHECK-NEXT: 602
+#CHECK-NEXT: 603
+#CHECK-NEXT: 604
+#CHECK-NEXT: 605
+#CHECK-NEXT: 606
+#CHECK-NEXT: 607
+#CHECK-NEXT: 608
+#CHECK-NEXT: 609
+#CHECK-NEXT: 610
+#CHECK-NEXT: 611
+#CHECK-NEXT: 612
+#CHECK-NEXT: 613
+#CHECK-NEXT: 614
+#CHECK-NEXT: 615
+#CHECK-NEXT: 616
+#CHECK-NEXT: 617
+#CHECK-NEXT: 618
+#CHECK-NEXT: 619
+#CHECK-NEXT: 620
+#CHECK-NEXT: 621
+#CHECK-NEXT: 622
+#CHECK-NEXT: 623
+#CHECK-NEXT: 624
+#CHECK-NEXT: 625
+#CHECK-NEXT: 626
+#CHECK-NEXT: 627
+#CHECK-NEXT: 628
+#CHECK-NEXT: 629
+#CHECK-NEXT: 630
+#CHECK-NEXT: 631
+#CHECK-NEXT: 632
+#CHECK-NEXT: 633
+#CHECK-NEXT: 634
+#CHECK-NEXT: 635
+#CHECK-NEXT: 636
+#CHECK-NEXT: 637
+#CHECK-NEXT: 638
+#CHECK-NEXT: 639
+#CHECK-NEXT: 640
+#CHECK-NEXT: 641
+#CHECK-NEXT: 642
+#CHECK-NEXT: 643
+#CHECK-NEXT: 644
+#CHECK-NEXT: 645
+#CHECK-NEXT: 646
+#CHECK-NEXT: 647
+#CHECK-NEXT: 648
+#CHECK-NEXT: 649
+#CHECK-NEXT: 650
+#CHECK-NEXT: 651
+#CHECK-NEXT: 652
+#CHECK-NEXT: 653
+#CHECK-NEXT: 654
+#CHECK-NEXT: 655
+#CHECK-NEXT: 656
+#CHECK-NEXT: 657
+#CHECK-NEXT: 658
+#CHECK-NEXT: 659
+#CHECK-NEXT: 660
+#CHECK-NEXT: 661
+#CHECK-NEXT: 662
+#CHECK-NEXT: 663
+#CHECK-NEXT: 664
+#CHECK-NEXT: 665
+#CHECK-NEXT: 666
+#CHECK-NEXT: 667
+#CHECK-NEXT: 668
+#CHECK-NEXT: 669
+#CHECK-NEXT: 670
+#CHECK-NEXT: 671
+#CHECK-NEXT: 672
+#CHECK-NEXT: 673
+#CHECK-NEXT: 674
+#CHECK-NEXT: 675
+#CHECK-NEXT: 676
+#CHECK-NEXT: 677
+#CHECK-NEXT: 678
+#CHECK-NEXT: 679
+#CHECK-NEXT: 680
+#CHECK-NEXT: 681
+#CHECK-NEXT: 682
+#CHECK-NEXT: 683
+#CHECK-NEXT: 684
+#CHECK-NEXT: 685
+#CHECK-NEXT: 686
+#CHECK-NEXT: 687
+#CHECK-NEXT: 688
+#CHECK-NEXT: 689
+#CHECK-NEXT: 690
+#CHECK-NEXT: 691
+#CHECK-NEXT: 692
+#CHECK-NEXT: 693
+#CHECK-NEXT: 694
+#CHECK-NEXT: 695
+#CHECK-NEXT: 696
+#CHECK-NEXT: 697
+#CHECK-NEXT: 698
+#CHECK-NEXT: 699
+#CHECK-NEXT: 700
+#CHECK-NEXT: 701
+#CHECK-NEXT: 702
+#CHECK-NEXT: 703
+#CHECK-NEXT: 704
+#CHECK-NEXT: 705
+#CHECK-NEXT: 706
+#CHECK-NEXT: 707
+#CHECK-NEXT: 708
+#CHECK-NEXT: 709
+#CHECK-NEXT: 710
+#CHECK-NEXT: 711
+#CHECK-NEXT: 712
+#CHECK-NEXT: 713
+#CHECK-NEXT: 714
+#CHECK-NEXT: 715
+#CHECK-NEXT: 716
+#CHECK-NEXT: 717
+#CHECK-NEXT: 718
+#CHECK-NEXT: 719
+#CHECK-NEXT: 720
+#CHECK-NEXT: 721
+#CHECK-NEXT: 722
+#CHECK-NEXT: 723
+#CHECK-NEXT: 724
+#CHECK-NEXT: 725
+#CHECK-NEXT: 726
+#CHECK-NEXT: 727
+#CHECK-NEXT: 728
+#CHECK-NEXT: 729
+#CHECK-NEXT: 730
+#CHECK-NEXT: 731
+#CHECK-NEXT: 732
+#CHECK-NEXT: 733
+#CHECK-NEXT: 734
+#CHECK-NEXT: 735
+#CHECK-NEXT: 736
+#CHECK-NEXT: 737
+#CHECK-NEXT: 738
+#CHECK-NEXT: 739
+#CHECK-NEXT: 740
+#CHECK-NEXT: 741
+#CHECK-NEXT: 742
+#CHECK-NEXT: 743
+#CHECK-NEXT: 744
+#CHECK-NEXT: 745
+#CHECK-NEXT: 746
+#CHECK-NEXT: 747
+#CHECK-NEXT: 748
+#CHECK-NEXT: 749
+#CHECK-NEXT: 750
+#CHECK-NEXT: 751
+#CHECK-NEXT: 752
+#CHECK-NEXT: 753
+#CHECK-NEXT: 754
+#CHECK-NEXT: 755
+#CHECK-NEXT: 756
+#CHECK-NEXT: 757
+#CHECK-NEXT: 758
+#CHECK-NEXT: 759
+#CHECK-NEXT: 760
+#CHECK-NEXT: 761
+#CHECK-NEXT: 762
+#CHECK-NEXT: 763
+#CHECK-NEXT: 764
+#CHECK-NEXT: 765
+#CHECK-NEXT: 766
+#CHECK-NEXT: 767
+#CHECK-NEXT: 768
+#CHECK-NEXT: 769
+#CHECK-NEXT: 770
+#CHECK-NEXT: 771
+#CHECK-NEXT: 772
+#CHECK-NEXT: 773
+#CHECK-NEXT: 774
+#CHECK-NEXT: 775
+#CHECK-NEXT: 776
+#CHECK-NEXT: 777
+#CHECK-NEXT: 778
+#CHECK-NEXT: 779
+#CHECK-NEXT: 780
+#CHECK-NEXT: 781
+#CHECK-NEXT: 782
+#CHECK-NEXT: 783
+#CHECK-NEXT: 784
+#CHECK-NEXT: 785
+#CHECK-NEXT: 786
+#CHECK-NEXT: 787
+#CHECK-NEXT: 788
+#CHECK-NEXT: 789
+#CHECK-NEXT: 790
+#CHECK-NEXT: 791
+#CHECK-NEXT: 792
+#CHECK-NEXT: 793
+#CHECK-NEXT: 794
+#CHECK-NEXT: 795
+#CHECK-NEXT: 796
+#CHECK-NEXT: 797
+#CHECK-NEXT: 798
+#CHECK-NEXT: 799
+#CHECK-NEXT: 800
+#CHECK-NEXT: 801
+#CHECK-NEXT: 802
+#CHECK-NEXT: 803
+#CHECK-NEXT: 804
+#CHECK-NEXT: 805
+#CHECK-NEXT: 806
+#CHECK-NEXT: 807
+#CHECK-NEXT: 808
+#CHECK-NEXT: 809
+#CHECK-NEXT: 810
+#CHECK-NEXT: 811
+#CHECK-NEXT: 812
+#CHECK-NEXT: 813
+#CHECK-NEXT: 814
+#CHECK-NEXT: 815
+#CHECK-NEXT: 816
+#CHECK-NEXT: 817
+#CHECK-NEXT: 818
+#CHECK-NEXT: 819
+#CHECK-NEXT: 820
+#CHECK-NEXT: 821
+#CHECK-NEXT: 822
+#CHECK-NEXT: 823
+#CHECK-NEXT: 824
+#CHECK-NEXT: 825
+#CHECK-NEXT: 826
+#CHECK-NEXT: 827
+#CHECK-NEXT: 828
+#CHECK-NEXT: 829
+#CHECK-NEXT: 830
+#CHECK-NEXT: 831
+#CHECK-NEXT: 832
+#CHECK-NEXT: 833
+#CHECK-NEXT: 834
+#CHECK-NEXT: 835
+#CHECK-NEXT: 836
+#CHECK-NEXT: 837
+#CHECK-NEXT: 838
+#CHECK-NEXT: 839
+#CHECK-NEXT: 840
+#CHECK-NEXT: 841
+#CHECK-NEXT: 842
+#CHECK-NEXT: 843
+#CHECK-NEXT: 844
+#CHECK-NEXT: 845
+#CHECK-NEXT: 846
+#CHECK-NEXT: 847
+#CHECK-NEXT: 848
+#CHECK-NEXT: 849
+#CHECK-NEXT: 850
+#CHECK-NEXT: 851
+#CHECK-NEXT: 852
+#CHECK-NEXT: 853
+#CHECK-NEXT: 854
+#CHECK-NEXT: 855
+#CHECK-NEXT: 856
+#CHECK-NEXT: 857
+#CHECK-NEXT: 858
+#CHECK-NEXT: 859
+#CHECK-NEXT: 860
+#CHECK-NEXT: 861
+#CHECK-NEXT: 862
+#CHECK-NEXT: 863
+#CHECK-NEXT: 864
+#CHECK-NEXT: 865
+#CHECK-NEXT: 866
+#CHECK-NEXT: 867
+#CHECK-NEXT: 868
+#CHECK-NEXT: 869
+#CHECK-NEXT: 870
+#CHECK-NEXT: 871
+#CHECK-NEXT: 872
+#CHECK-NEXT: 873
+#CHECK-NEXT: 874
+#CHECK-NEXT: 875
+#CHECK-NEXT: 876
+#CHECK-NEXT: 877
+#CHECK-NEXT: 878
+#CHECK-NEXT: 879
+#CHECK-NEXT: 880
+#CHECK-NEXT: 881
+#CHECK-NEXT: 882
+#CHECK-NEXT: 883
+#CHECK-NEXT: 884
+#CHECK-NEXT: 885
+#CHECK-NEXT: 886
+#CHECK-NEXT: 887
+#CHECK-NEXT: 888
+#CHECK-NEXT: 889
+#CHECK-NEXT: 890
+#CHECK-NEXT: 891
+#CHECK-NEXT: 892
+#CHECK-NEXT: 893
+#CHECK-NEXT: 894
+#CHECK-NEXT: 895
+#CHECK-NEXT: 896
+#CHECK-NEXT: 897
+#CHECK-NEXT: 898
+#CHECK-NEXT: 899
+#CHECK-NEXT: 900
+#CHECK-NEXT: 901
+#CHECK-NEXT: 902
+#CHECK-NEXT: 903
+#CHECK-NEXT: 904
+#CHECK-NEXT: 905
+#CHECK-NEXT: 906
+#CHECK-NEXT: 907
+#CHECK-NEXT: 908
+#CHECK-NEXT: 909
+#CHECK-NEXT: 910
+#CHECK-NEXT: 911
+#CHECK-NEXT: 912
+#CHECK-NEXT: 913
+#CHECK-NEXT: 914
+#CHECK-NEXT: 915
+#CHECK-NEXT: 916
+#CHECK-NEXT: 917
+#CHECK-NEXT: 918
+#CHECK-NEXT: 919
+#CHECK-NEXT: 920
+#CHECK-NEXT: 921
+#CHECK-NEXT: 922
+#CHECK-NEXT: 923
+#CHECK-NEXT: 924
+#CHECK-NEXT: 925
+#CHECK-NEXT: 926
+#CHECK-NEXT: 927
+#CHECK-NEXT: 928
+#CHECK-NEXT: 929
+#CHECK-NEXT: 930
+#CHECK-NEXT: 931
+#CHECK-NEXT: 932
+#CHECK-NEXT: 933
+#CHECK-NEXT: 934
+#CHECK-NEXT: 935
+#CHECK-NEXT: 936
+#CHECK-NEXT: 937
+#CHECK-NEXT: 938
+#CHECK-NEXT: 939
+#CHECK-NEXT: 940
+#CHECK-NEXT: 941
+#CHECK-NEXT: 942
+#CHECK-NEXT: 943
+#CHECK-NEXT: 944
+#CHECK-NEXT: 945
+#CHECK-NEXT: 946
+#CHECK-NEXT: 947
+#CHECK-NEXT: 948
+#CHECK-NEXT: 949
+#CHECK-NEXT: 950
+#CHECK-NEXT: 951
+#CHECK-NEXT: 952
+#CHECK-NEXT: 953
+#CHECK-NEXT: 954
+#CHECK-NEXT: 955
+#CHECK-NEXT: 956
+#CHECK-NEXT: 957
+#CHECK-NEXT: 958
+#CHECK-NEXT: 959
+#CHECK-NEXT: 960
+#CHECK-NEXT: 961
+#CHECK-NEXT: 962
+#CHECK-NEXT: 963
+#CHECK-NEXT: 964
+#CHECK-NEXT: 965
+#CHECK-NEXT: 966
+#CHECK-NEXT: 967
+#CHECK-NEXT: 968
+#CHECK-NEXT: 969
+#CHECK-NEXT: 970
+#CHECK-NEXT: 971
+#CHECK-NEXT: 972
+#CHECK-NEXT: 973
+#CHECK-NEXT: 974
+#CHECK-NEXT: 975
+#CHECK-NEXT: 976
+#CHECK-NEXT: 977
+#CHECK-NEXT: 978
+#CHECK-NEXT: 979
+#CHECK-NEXT: 980
+#CHECK-NEXT: 981
+#CHECK-NEXT: 982
+#CHECK-NEXT: 983
+#CHECK-NEXT: 984
+#CHECK-NEXT: 985
+#CHECK-NEXT: 986
+#CHECK-NEXT: 987
+#CHECK-NEXT: 988
+#CHECK-NEXT: 989
+#CHECK-NEXT: 990
+#CHECK-NEXT: 991
+#CHECK-NEXT: 992
+#CHECK-NEXT: 993
+#CHECK-NEXT: 994
+#CHECK-NEXT: 995
+#CHECK-NEXT: 996
+#CHECK-NEXT: 997
+#CHECK-NEXT: 998
+#CHECK-NEXT: 999
+#CHECK-NOT:  {{[0-9]+}}
@@ -1,3 +1,8 @@
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "intersection/batch.hh"
 #include "intersection/intersection.hh"
 #include "test_header.hh"
 
@@ -74,6 +79,246 @@ TYPED_TEST(IntersectionTriangles, CommonCase)
   EXPECT_TRUE(isIntersect(t1, t2));
 }
 
+TYPED_TEST(IntersectionTriangles, LoneVertexOrder)
+{
+  // Arrange
+  Triangle<TypeParam> t1{{-20, -1, -12}, {-22, -10, -7}, {-16, -6, -15}};
+  Triangle<TypeParam> t2{{-24, -20, -2}, {-20, -12, -6}, {-20, -13, -1}};
+  Triangle<TypeParam> t3{{4, 5, 0}, {4, -5, 0}, {-4, 0, 25}};
+  Triangle<TypeParam> t4{{-2.5, 7.875, 15}, {-2.5, -9.5, 15}, {3.5, 0, 15}};
+
+  // Act & Assert
+  EXPECT_FALSE(isIntersect(t1, t2));
+  EXPECT_FALSE(isIntersect(t2, t1));
+
+  EXPECT_TRUE(isIntersect(t3, t4));
+  EXPECT_TRUE(isIntersect(t4, t3));
+}
+
+TYPED_TEST(IntersectionTriangles, Prepared)
+{
+  // Arrange
+  std::vector<Triangle<TypeParam>> trs{{{0, 0, 0}, {0, 1, 0}, {1, 0, 0}},
+                                       {{0, 0, 1}, {0, 1, -1}, {1, 0, -1}},
+                                       {{0, 0, 1}, {0, 1, 1}, {1, 0, 2}},
+                                       {{3, 0, 0}, {0, 3, 0}, {0, 0, 0}},
+                                       {{-1, -1, 0}, {1, 1, 0}, {2, 2, 0}},
+                                       {{0, 0, 5}, {0, 0, -5}, {0, 0, 0}},
+                                       {{0.5, 0.5, 0}, {0.5, 0.5, 0}, {0.5, 0.5, 0}},
+                                       {{5, 5, 5}, {5, 5, 5}, {5, 5, 5}}};
+
+  // Act
+  std::vector<PreparedTriangle<TypeParam>> prepared{};
+  for (const auto &tr : trs)
+    prepared.emplace_back(tr);
+
+  // Assert
+  EXPECT_EQ(prepared[0].kind, TriangleKind::TRIANGLE);
+  EXPECT_EQ(prepared[4].kind, TriangleKind::SEGMENT);
+  EXPECT_EQ(prepared[7].kind, TriangleKind::POINT);
+
+  for (std::size_t i = 0; i < trs.size(); ++i)
+    for (std::size_t j = 0; j < trs.size(); ++j)
+      EXPECT_EQ(isIntersect(trs[i], prepared[i], trs[j], prepared[j]), isIntersect(trs[i], trs[j]))
+        << i << " " << j;
+}
+
+TYPED_TEST(IntersectionTriangles, Mixed)
+{
+  // Arrange
+  std::vector<Triangle<TypeParam>> trs{{{0, 0, 0}, {0, 1, 0}, {1, 0, 0}},
+                                       {{0, 0, 1}, {0, 1, -1}, {1, 0, -1}},
+                                       {{0, 0, 1}, {0, 1, 1}, {1, 0, 2}},
+                                       {{3, 0, 0}, {0, 3, 0}, {0, 0, 0}},
+                                       {{-1, -1, 0}, {1, 1, 0}, {2, 2, 0}},
+                                       {{0, 0, 5}, {0, 0, -5}, {0, 0, 0}},
+                                       {{0.5, 0.5, 0}, {0.5, 0.5, 0}, {0.5, 0.5, 0}}};
+  trs.push_back(detail::toPrecision<TypeParam>(
+    Triangle<double>{{0.1, 0.1, -1e-6}, {0.2, 0.1, -1e-6}, {9, 9, 1e-6}}));
+
+  std::vector<PreparedTriangle<TypeParam>> prepared{};
+  for (const auto &tr : trs)
+    prepared.emplace_back(tr);
+
+  // Act & Assert
+  for (std::size_t i = 0; i < trs.size(); ++i)
+    for (std::size_t j = 0; j < trs.size(); ++j)
+      EXPECT_EQ(isIntersectMixed(trs[i], prepared[i], trs[j], prepared[j]),
+                isIntersect(detail::toPrecision<double>(trs[i]),
+                            detail::toPrecision<double>(trs[j])))
+        << i << " " << j;
+}
+
+TEST(IntersectionMixed, NearlyParallel)
+{
+  // Arrange
+  Triangle<float> t1{{0, 0, 0}, {1, 0, 0}, {0, 1, 0}};
+  Triangle<float> t2{{0.1f, 0.1f, -1e-6f}, {0.2f, 0.1f, -1e-6f}, {9, 9, 1e-6f}};
+
+  // Act & Assert
+  EXPECT_TRUE(isIntersect(t1, t2));
+  EXPECT_FALSE(isIntersectMixed(t1, PreparedTriangle<float>{t1}, t2, PreparedTriangle<float>{t2}));
+  EXPECT_FALSE(
+    isIntersect(detail::toPrecision<double>(t1), detail::toPrecision<double>(t2)));
+}
+
+TYPED_TEST(IntersectionTriangles, Batch)
+{
+  // Arrange
+  auto tenth = static_cast<TypeParam>(0.1);
+  auto fifth = static_cast<TypeParam>(0.2);
+  auto threeTenths = static_cast<TypeParam>(0.3);
+  std::vector<Triangle<TypeParam>> trs{{{0, 0, 0}, {0, 1, 0}, {1, 0, 0}},
+                                       {{0, 0, 1}, {0, 1, -1}, {1, 0, -1}},
+                                       {{0, 0, 1}, {0, 1, 1}, {1, 0, 2}},
+                                       {{3, 0, 0}, {0, 3, 0}, {0, 0, 0}},
+                                       {{-1, -1, 0}, {1, 1, 0}, {2, 2, 0}},
+                                       {{0, 0, 5}, {0, 0, -5}, {0, 0, 0}},
+                                       {{0.5, 0.5, 0}, {0.5, 0.5, 0}, {0.5, 0.5, 0}},
+                                       {{5, 5, 5}, {5, 5, 5}, {5, 5, 5}},
+                                       {{0, 0, 0.5}, {0, 1, 0.5}, {1, 0, 0.5}},
+                                       {{fifth, fifth, -1},
+                                        {fifth, fifth, 1},
+                                        {threeTenths, tenth, 0}},
+                                       {{10, 0, 0}, {0, 10, 0}, {0, 0, 10}}};
+
+  std::vector<PreparedTriangle<TypeParam>> prepared{};
+  for (const auto &tr : trs)
+    prepared.emplace_back(tr);
+
+  TriangleBatch<TypeParam, 4> batch{};
+  EXPECT_TRUE(batch.empty());
+
+  for (std::size_t first = 0; first < trs.size(); first += batch.kWidth)
+  {
+    // Act
+    batch.clear();
+    for (std::size_t j = first; j < trs.size() && !batch.full(); ++j)
+      batch.push(trs[j], prepared[j]);
+
+    // Assert
+    for (std::size_t i = 0; i < trs.size(); ++i)
+    {
+      auto mask = isIntersect(trs[i], prepared[i], batch);
+      for (std::size_t lane = 0; lane < batch.kWidth; ++lane)
+      {
+        auto expected = lane < batch.size() && isIntersect(trs[i], trs[first + lane]);
+        EXPECT_EQ(((mask >> lane) & 1) != 0, expected) << i << " " << first + lane;
+      }
+    }
+  }
+
+  EXPECT_THROW(
+    {
+      batch.clear();
+      for (std::size_t j = 0; j <= batch.kWidth; ++j)
+        batch.push(trs[j], prepared[j]);
+    },
+    std::length_error);
+}
+
+TYPED_TEST(IntersectionTriangles, BatchSlivers)
+{
+  // Arrange
+  std::uint32_t seed = 12345;
+  auto next = [&seed] {
+    seed = seed * 1664525u + 1013904223u;
+    return static_cast<TypeParam>(seed >> 8) / static_cast<TypeParam>(1u << 24);
+  };
+
+  /* Slivers of decreasing height at growing offsets and triangles crossing them a hair off
+   * the middle of the long edge, where computed normal of a sliver is the least reliable */
+  std::vector<Triangle<TypeParam>> trs{};
+  for (int i = 0; i < 48; ++i)
+  {
+    auto scale = static_cast<TypeParam>(1 << (i % 12));
+    auto height = std::pow(TypeParam{10}, -static_cast<TypeParam>(2 + i % 5));
+    Vec3<TypeParam> org{scale * next(), scale * next(), scale * next()};
+    Vec3<TypeParam> dir{next() + 1, next() - TypeParam{0.5}, next() - TypeParam{0.5}};
+    Vec3<TypeParam> side{next() - TypeParam{0.5}, next() + 1, next() - TypeParam{0.5}};
+
+    auto end = org + dir * scale;
+    auto mid = org + dir * (scale / 2);
+    trs.push_back({org, end, mid + side * (scale * height)});
+
+    auto tip = mid + side * (scale * height * next());
+    auto lift = side.cross(dir) * (scale * height * height);
+    trs.push_back({tip + lift, tip + lift + side * scale, tip + lift + dir.cross(side) * scale});
+  }
+
+  std::vector<PreparedTriangle<TypeParam>> prepared{};
+  for (const auto &tr : trs)
+    prepared.emplace_back(tr);
+
+  TriangleSoA<TypeParam> soa{trs.begin(), trs.end()};
+  TriangleBatch<TypeParam, 8> batch{};
+  for (std::size_t first = 0; first < trs.size(); first += batch.kWidth)
+  {
+    batch.clear();
+    for (std::size_t j = first; j < trs.size() && !batch.full(); ++j)
+      batch.push(trs[j], prepared[j]);
+
+    for (std::size_t i = 0; i < trs.size(); ++i)
+    {
+      // Act
+      auto mask = isIntersect(trs[i], prepared[i], batch);
+
+      // Assert
+      for (std::size_t lane = 0; lane < batch.size(); ++lane)
+        EXPECT_EQ(((mask >> lane) & 1) != 0,
+                  isIntersect(trs[i], prepared[i], trs[first + lane], prepared[first + lane]))
+          << i << " " << first + lane;
+    }
+  }
+
+  for (std::size_t i = 0; i < trs.size(); ++i)
+  {
+    std::vector<std::size_t> expected{};
+    for (std::size_t j = 0; j < trs.size(); ++j)
+      if (isIntersect(trs[i], trs[j]))
+        expected.push_back(j);
+
+    // Act
+    std::vector<std::size_t> found{};
+    findIntersectingIndices(trs[i], soa, found);
+
+    // Assert
+    EXPECT_EQ(found, expected) << i;
+  }
+}
+
+TYPED_TEST(IntersectionTriangles, SoA)
+{
+  // Arrange
+  std::vector<Triangle<TypeParam>> trs{};
+  for (int i = 0; i < 100; ++i)
+  {
+    auto x = static_cast<TypeParam>((i * 37) % 20);
+    auto y = static_cast<TypeParam>((i * 11) % 13);
+    auto z = static_cast<TypeParam>(i % 7);
+    trs.push_back({{x, y, z}, {x + 3, y, z + 1}, {x, y + 3, z - 1}});
+  }
+  trs.push_back({{1, 1, 1}, {2, 2, 2}, {4, 4, 4}});
+  trs.push_back({{5, 5, 2}, {5, 5, 2}, {5, 5, 2}});
+
+  TriangleSoA<TypeParam> soa{trs.begin(), trs.end()};
+
+  for (const auto &tr : trs)
+  {
+    std::vector<std::size_t> expected{};
+    for (std::size_t i = 0; i < trs.size(); ++i)
+      if (isIntersect(tr, trs[i]))
+        expected.push_back(i);
+
+    // Act
+    std::vector<std::size_t> found{};
+    findIntersectingIndices(tr, soa, found);
+
+    // Assert
+    EXPECT_EQ(found, expected);
+  }
+}
+
 //================================================================================================
 
 template <typename T>
@@ -271,6 +516,31 @@ TYPED_TEST(IntersectionDetail, isOnOneSide)
   EXPECT_FALSE(detail::isOnOneSide(pl, t3));
 }
 
+TYPED_TEST(IntersectionDetail, isOnOneSideTriangle)
+{
+  // Arrange
+  auto thres = ThresComp<TypeParam>::getThreshold();
+  Triangle<TypeParam> base{{0, 0, 0}, {1, 0, 0}, {0, 1, 0}};
+  Triangle<TypeParam> near{{0, 0, thres / 2}, {1, 0, 1}, {0, 1, 1}};
+  Triangle<TypeParam> far{{0, 0, 2 * thres}, {1, 0, 1}, {0, 1, 1}};
+
+  // Distances to this plane are rounded by more than the gaps below
+  Triangle<TypeParam> big{{1000, 0, 0}, {0, 1000, 0}, {0, 0, 1000}};
+  Triangle<TypeParam> touching{{333, 333, 334}, {400, 400, 400}, {500, 300, 400}};
+  auto gap = static_cast<TypeParam>(334 + 1. / 1024);
+  Triangle<TypeParam> apart{{300, 366, gap}, {350, 420, 450}, {250, 450, 450}};
+
+  auto isOnOneSide = [](const auto &lhs, const auto &rhs) {
+    return detail::isOnOneSide(lhs, lhs.getPlane(), detail::normalError(lhs), rhs);
+  };
+
+  // Act & Assert
+  EXPECT_FALSE(isOnOneSide(base, near));
+  EXPECT_TRUE(isOnOneSide(base, far));
+  EXPECT_FALSE(isOnOneSide(big, touching));
+  EXPECT_TRUE(isOnOneSide(big, apart));
+}
+
 TYPED_TEST(IntersectionDetail, isCounterClockwise)
 {
   // Arrange
@@ -517,6 +787,21 @@ TYPED_TEST(IntersectionDetail, isIntersectSegmentSegment2)
   EXPECT_FALSE(detail::isIntersectSegmentSegment(segm7, segm1));
 }
 
+TYPED_TEST(IntersectionDetail, isIntersectSegmentSegmentOpposite)
+{
+  // Arrange
+  detail::Segment3D<TypeParam> segm1{{5, 5, 0}, {5, 5, 1}};
+  detail::Segment3D<TypeParam> segm2{{5, 5, 1}, {5, 5, -1}};
+  detail::Segment3D<TypeParam> segm3{{5, 5, 3}, {5, 5, 2}};
+
+  // Act & Assert
+  EXPECT_TRUE(detail::isIntersectSegmentSegment(segm1, segm2));
+  EXPECT_TRUE(detail::isIntersectSegmentSegment(segm2, segm1));
+
+  EXPECT_FALSE(detail::isIntersectSegmentSegment(segm1, segm3));
+  EXPECT_FALSE(detail::isIntersectSegmentSegment(segm3, segm1));
+}
+
 TYPED_TEST(IntersectionDetail, isIntersectIntersectionTrianglesegment2D)
 {
   // Arrange
@@ -1,4 +1,936 @@
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <memory_resource>
+#include <numeric>
+#include <set>
+#include <sstream>
+#include <thread>
+#include <utility>
+
 #include "kdtree/kdtree.hh"
 #include "test_header.hh"
 
+using namespace geom;
+using namespace geom::kdtree;
+
+template <typename T>
+class KdTreeTest : public testing::Test
+{};
+
+TYPED_TEST_SUITE(KdTreeTest, FPTypes);
+
+template <std::floating_point T>
+std::size_t countIndicies(const KdTree<T> &tree)
+{
+  std::size_t res = 0;
+  for (auto cont : tree)
+    res += static_cast<std::size_t>(std::distance(cont.indexBegin(), cont.indexEnd()));
+
+  return res;
+}
+
+TYPED_TEST(KdTreeTest, sahSplitSeparatesCluster)
+{
+  // Arrange
+  std::vector<Triangle<TypeParam>> triangles{
+    {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}},    {{1, 1, 1}, {2, 1, 1}, {1, 2, 1}},
+    {{0, 1, 2}, {1, 1, 2}, {0, 2, 2}},    {{1, 0, 3}, {2, 0, 3}, {1, 1, 3}},
+    {{99, 0, 0}, {100, 0, 0}, {99, 1, 3}}};
+  std::vector<Index> indicies{0, 1, 2, 3, 4};
+  BoundBox<TypeParam> bb{0, 100, 0, 2, 0, 3};
+
+  // Act
+  auto split = sahSplit(bb, indicies.begin(), indicies.end(), triangles);
+
+  // Assert
+  EXPECT_EQ(split.axis, Axis::X);
+  EXPECT_GT(split.separator, 2);
+  EXPECT_LT(split.separator, 99);
+}
+
+TYPED_TEST(KdTreeTest, sahSplitKeepsLeaf)
+{
+  // Arrange
+  std::vector<Triangle<TypeParam>> triangles{{{0, 0, 0}, {10, 0, 0}, {0, 10, 10}},
+                                             {{10, 10, 0}, {0, 10, 0}, {10, 0, 10}},
+                                             {{0, 0, 10}, {10, 10, 10}, {5, 0, 0}},
+                                             {{4, 4, 4}, {6, 4, 4}, {4, 6, 6}}};
+  std::vector<Index> indicies{0, 1, 2, 3};
+  BoundBox<TypeParam> bb{0, 10, 0, 10, 0, 10};
+
+  // Act
+  auto split = sahSplit(bb, indicies.begin(), indicies.end(), triangles);
+
+  KdTree<TypeParam> tree{};
+  tree.setSplitPolicy(SplitPolicy::SAH);
+  tree.build(triangles.begin(), triangles.end());
+
+  // Assert
+  EXPECT_EQ(split.axis, Axis::NONE);
+  EXPECT_EQ(tree.nodeCount(), 1);
+  EXPECT_EQ(countIndicies(tree), triangles.size());
+}
+
+TYPED_TEST(KdTreeTest, sahCostSingle)
+{
+  // Arrange
+  KdTree<TypeParam> tree{{{0, 0, 0}, {1, 0, 0}, {0, 1, 0}}};
+
+  // Act & Assert
+  EXPECT_EQ(tree.sahCost(), kSahIntersectionCost<TypeParam>);
+}
+
+TYPED_TEST(KdTreeTest, splitPolicies)
+{
+  for (auto policy : {SplitPolicy::MIDDLE, SplitPolicy::SAH})
+  {
+    // Arrange
+    KdTree<TypeParam> tree{};
+    tree.setSplitPolicy(policy);
+    tree.setNodeCapacity(2);
+
+    // Act
+    for (int i = 0; i < 50; ++i)
+    {
+      auto x = static_cast<TypeParam>(i % 10 == 0 ? 100 + i : i % 10);
+      tree.insert({{x, 0, 0}, {x + 1, 0, 0}, {x, 1, 1}});
+    }
+
+    // Assert
+    EXPECT_EQ(tree.splitPolicy(), policy);
+    EXPECT_EQ(countIndicies(tree), tree.size());
+    EXPECT_GT(tree.sahCost(), 0);
+  }
+}
+
+TYPED_TEST(KdTreeTest, buildFromRange)
+{
+  // Arrange
+  std::vector<Triangle<TypeParam>> triangles{};
+  for (int i = 0; i < 100; ++i)
+  {
+    auto x = static_cast<TypeParam>(i % 10);
+    auto y = static_cast<TypeParam>(i / 10);
+    triangles.push_back({{x, y, 0}, {x + 1, y, 0}, {x, y + 1, 1}});
+  }
+
+  // Act
+  KdTree<TypeParam> tree{triangles.begin(), triangles.end()};
+
+  // Assert
+  ASSERT_EQ(tree.size(), triangles.size());
+  EXPECT_EQ(countIndicies(tree), triangles.size());
+  for (std::size_t i = 0; i < triangles.size(); ++i)
+    for (std::size_t j = 0; j < 3; ++j)
+      EXPECT_EQ(tree.triangleByIndex(i)[j], triangles[i][j]);
+
+  for (auto cont : tree)
+  {
+    auto bb = cont.boundBox();
+    for (const auto &tr : cont)
+      for (const auto &v : tr)
+      {
+        EXPECT_TRUE(bb.minX <= v.x && v.x <= bb.maxX);
+        EXPECT_TRUE(bb.minY <= v.y && v.y <= bb.maxY);
+        EXPECT_TRUE(bb.minZ <= v.z && v.z <= bb.maxZ);
+      }
+  }
+}
+
+TYPED_TEST(KdTreeTest, buildDuplicates)
+{
+  // Arrange
+  std::vector<Triangle<TypeParam>> triangles(1000, {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}});
+
+  // Act
+  KdTree<TypeParam> tree{};
+  tree.build(triangles.begin(), triangles.end());
+
+  // Assert
+  EXPECT_EQ(countIndicies(tree), triangles.size());
+}
+
+TYPED_TEST(KdTreeTest, buildClear)
+{
+  // Arrange
+  std::vector<Triangle<TypeParam>> triangles(10, {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}});
+  KdTree<TypeParam> tree{triangles.begin(), triangles.end()};
+
+  // Act
+  tree.clear();
+
+  // Assert
+  EXPECT_TRUE(tree.empty());
+  EXPECT_EQ(tree.begin(), tree.end());
+}
+
+TYPED_TEST(KdTreeTest, insertExpanding)
+{
+  // Arrange
+  KdTree<TypeParam> tree{};
+
+  // Act
+  for (int i = 0; i < 30; ++i)
+  {
+    auto sh = static_cast<TypeParam>(i % 2 == 0 ? i : -i);
+    tree.insert({{sh, sh, sh}, {sh + 1, sh, sh}, {sh, sh + 1, sh + 1}});
+  }
+
+  // Assert
+  EXPECT_EQ(tree.size(), 30);
+  EXPECT_EQ(countIndicies(tree), tree.size());
+  for (auto cont : tree)
+    for (const auto &tr : cont)
+      EXPECT_TRUE(tr.belongsTo(cont.boundBox()));
+}
+
+TYPED_TEST(KdTreeTest, copy)
+{
+  // Arrange
+  KdTree<TypeParam> tree{};
+  tree.setNodeCapacity(3);
+  for (int i = 0; i < 30; ++i)
+  {
+    auto sh = static_cast<TypeParam>(i);
+    tree.insert({{sh, 0, 0}, {sh + 1, 0, 0}, {sh, 1, 1}});
+  }
+
+  // Act
+  KdTree<TypeParam> copy{tree};
+
+  // Assert
+  std::stringstream orig{};
+  std::stringstream copied{};
+  tree.dumpRecursive(orig);
+  copy.dumpRecursive(copied);
+
+  EXPECT_EQ(copy.nodeCapacity(), tree.nodeCapacity());
+  EXPECT_EQ(copy.nodeCount(), tree.nodeCount());
+  EXPECT_EQ(orig.str(), copied.str());
+}
+
+TYPED_TEST(KdTreeTest, finalize)
+{
+  // Arrange
+  KdTree<TypeParam> tree{};
+  tree.setNodeCapacity(2);
+  for (int i = 0; i < 40; ++i)
+  {
+    auto sh = static_cast<TypeParam>(i % 2 == 0 ? i : 40 - i);
+    tree.insert({{sh, 0, 0}, {sh + 1, 0, 0}, {sh, 1, 1}});
+  }
+
+  std::multiset<Index> before{};
+  for (auto cont : tree)
+    before.insert(cont.indexBegin(), cont.indexEnd());
+
+  // Act
+  tree.finalize();
+
+  // Assert
+  std::multiset<Index> after{};
+  for (auto cont : tree)
+  {
+    EXPECT_LE(cont.indexBegin(), cont.indexEnd());
+    after.insert(cont.indexBegin(), cont.indexEnd());
+  }
+
+  EXPECT_EQ(before.size(), tree.size());
+  EXPECT_EQ(before, after);
+}
+
+TYPED_TEST(KdTreeTest, stats)
+{
+  // Arrange
+  std::vector<Triangle<TypeParam>> triangles{};
+  for (int i = 0; i < 200; ++i)
+  {
+    auto x = static_cast<TypeParam>((i * 13) % 50);
+    auto y = static_cast<TypeParam>((i * 7) % 20);
+    triangles.push_back({{x, y, 0}, {x + 1, y, 1}, {x, y + 1, -1}});
+  }
+  /* Spans the whole scene, so it straddles the root separator */
+  triangles.push_back({{-1, 0, 0}, {60, 0, 0}, {-1, 25, 0}});
+
+  KdTree<TypeParam> tree{};
+  tree.setNodeCapacity(4);
+  tree.build(triangles.begin(), triangles.end());
+
+  // Act
+  auto stats = tree.stats();
+  auto empty = KdTree<TypeParam>{}.stats();
+
+  // Assert
+  std::size_t nLeaves = 0;
+  std::size_t nInLeaves = 0;
+  for (auto cont : tree)
+    if (Axis::NONE == cont.sepAxis())
+    {
+      ++nLeaves;
+      nInLeaves += static_cast<std::size_t>(std::distance(cont.indexBegin(), cont.indexEnd()));
+    }
+
+  auto sum = [](const auto &hist) {
+    return std::accumulate(hist.begin(), hist.end(), std::size_t{0});
+  };
+
+  EXPECT_EQ(stats.nodeCount, tree.nodeCount());
+  EXPECT_EQ(stats.leafCount, nLeaves);
+  EXPECT_EQ(stats.triangleCount, triangles.size());
+  EXPECT_EQ(stats.straddlingCount, triangles.size() - nInLeaves);
+  EXPECT_GE(stats.straddlingCount, 1);
+  EXPECT_EQ(sum(stats.depthHistogram), nLeaves);
+  EXPECT_EQ(sum(stats.occupancyHistogram), nLeaves);
+  EXPECT_EQ(stats.depthHistogram.size(), stats.maxDepth + 1);
+  EXPECT_EQ(stats.nodeBytes, tree.nodeCount() * sizeof(Node<TypeParam>));
+  auto sahCost = static_cast<double>(tree.sahCost());
+  EXPECT_NEAR(static_cast<double>(stats.sahCost), sahCost, sahCost * 1e-4);
+
+  EXPECT_EQ(empty.nodeCount, 0);
+  EXPECT_EQ(empty.leafCount, 0);
+
+  std::ostringstream oss{};
+  stats.dump(oss);
+  EXPECT_NE(oss.str().find("SAH cost"), std::string::npos);
+}
+
+TYPED_TEST(KdTreeTest, autoTune)
+{
+  // Arrange
+  std::vector<Triangle<TypeParam>> triangles{};
+  for (int i = 0; i < 10000; ++i)
+  {
+    auto x = static_cast<TypeParam>(i % 25 * 4);
+    auto y = static_cast<TypeParam>(i / 25 % 20 * 3);
+    auto z = static_cast<TypeParam>(i / 500 * 2);
+    triangles.push_back({{x, y, z}, {x + 5, y, z + 1}, {x, y + 4, z - 1}});
+  }
+
+  KdTree<TypeParam> fixed{triangles.begin(), triangles.end()};
+  KdTree<TypeParam> tuned{};
+  tuned.setAutoTune(true);
+  KdTree<TypeParam> again{};
+  again.setAutoTune(true);
+  again.setThreadCount(3);
+
+  // Act
+  tuned.build(triangles.begin(), triangles.end());
+  again.build(triangles.begin(), triangles.end());
+  const auto &profile = tuned.tuneProfile();
+
+  // Assert
+  EXPECT_TRUE(fixed.tuneProfile().empty());
+  ASSERT_FALSE(profile.empty());
+  EXPECT_EQ(profile.sceneSize, triangles.size());
+  EXPECT_GE(profile.sampleSize, kTuneSampleSize / 2);
+  EXPECT_LE(profile.sampleSize, 2 * kTuneSampleSize);
+  EXPECT_EQ(profile.costs.size(), kTuneCapacities.size());
+  EXPECT_EQ(tuned.nodeCapacity(), profile.nodeCapacity);
+  EXPECT_EQ(again.nodeCapacity(), profile.nodeCapacity);
+  EXPECT_EQ(again.nodeCount(), tuned.nodeCount());
+  EXPECT_EQ(tuned.findIntersectingIndices(), fixed.findIntersectingIndices());
+
+  tuned.setNodeCapacity(4);
+  EXPECT_FALSE(tuned.isAutoTune());
+
+  std::ostringstream oss{};
+  profile.dump(oss);
+  auto dump = oss.str();
+  EXPECT_NE(dump.find("node capacity " + std::to_string(profile.nodeCapacity)), std::string::npos);
+}
+
+TYPED_TEST(KdTreeTest, autoTuneThreshold)
+{
+  // Arrange
+  std::vector<Triangle<TypeParam>> triangles{};
+  for (int i = 0; i < 2000; ++i)
+  {
+    auto x = static_cast<TypeParam>(i % 20 * 3);
+    auto y = static_cast<TypeParam>(i / 20 % 10 * 3);
+    auto z = static_cast<TypeParam>(i / 200 * 3);
+    triangles.push_back({{x, y, z}, {x + 1, y, z}, {x, y + 1, z + 1}});
+  }
+
+  /* Gaps between triangles are 2, so loose boxes overlap neighbours and tight ones don't */
+  KdTree<TypeParam> tight{};
+  tight.setAutoTune(true);
+  KdTree<TypeParam> loose{};
+  loose.setAutoTune(true);
+  loose.setThreshold(static_cast<TypeParam>(1.5));
+
+  // Act
+  tight.build(triangles.begin(), triangles.end());
+  loose.build(triangles.begin(), triangles.end());
+  const auto &tightCosts = tight.tuneProfile().costs;
+  const auto &looseCosts = loose.tuneProfile().costs;
+
+  // Assert
+  ASSERT_EQ(tightCosts.size(), kTuneCapacities.size());
+  ASSERT_EQ(looseCosts.size(), kTuneCapacities.size());
+  for (std::size_t i = 0; i < kTuneCapacities.size(); ++i)
+    EXPECT_GT(looseCosts[i], tightCosts[i]) << kTuneCapacities[i];
+}
+
+class CountingResource final : public std::pmr::memory_resource
+{
+public:
+  std::size_t allocated = 0;
+  std::size_t deallocated = 0;
+
+private:
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override
+  {
+    allocated += bytes;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void *ptr, std::size_t bytes, std::size_t alignment) override
+  {
+    deallocated += bytes;
+    std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+  }
+
+  bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+  {
+    return this == &other;
+  }
+};
+
+TYPED_TEST(KdTreeTest, memoryResource)
+{
+  // Arrange
+  std::vector<Triangle<TypeParam>> triangles{};
+  for (int i = 0; i < 1000; ++i)
+  {
+    auto x = static_cast<TypeParam>((i * 13) % 70);
+    auto y = static_cast<TypeParam>((i * 7) % 40);
+    auto z = static_cast<TypeParam>(i % 11);
+    triangles.push_back({{x, y, z}, {x + 2, y, z + 1}, {x, y + 2, z - 1}});
+  }
+
+  KdTree<TypeParam> expected{triangles.begin(), triangles.end()};
+  CountingResource counting{};
+  std::pmr::monotonic_buffer_resource arena{};
+
+  // Act
+  std::size_t nCopyAllocated = 0;
+  {
+    KdTree<TypeParam> tree{&counting};
+    tree.setThreadCount(3);
+    tree.build(triangles.begin(), triangles.end());
+    tree.insert({{0, 0, 0}, {1, 0, 0}, {0, 1, 0}});
+
+    KdTree<TypeParam> copy{tree};
+    nCopyAllocated = counting.allocated;
+
+    // Assert
+    EXPECT_EQ(tree.memoryResource(), &counting);
+    EXPECT_EQ(copy.memoryResource(), std::pmr::get_default_resource());
+    EXPECT_EQ(copy.findIntersectingIndices(), tree.findIntersectingIndices());
+  }
+
+  KdTree<TypeParam> inArena{&arena};
+  inArena.build(triangles.begin(), triangles.end());
+
+  EXPECT_GE(counting.allocated, triangles.size() * (sizeof(Triangle<TypeParam>) + sizeof(Index)));
+  EXPECT_EQ(counting.allocated, nCopyAllocated);
+  EXPECT_EQ(counting.deallocated, counting.allocated);
+  EXPECT_EQ(inArena.memoryResource(), &arena);
+  EXPECT_EQ(inArena.nodeCount(), expected.nodeCount());
+  EXPECT_EQ(inArena.findIntersectingIndices(), expected.findIntersectingIndices());
+}
+
+TYPED_TEST(KdTreeTest, buildParallel)
+{
+  // Arrange
+  std::vector<Triangle<TypeParam>> triangles{};
+  for (int i = 0; i < 20000; ++i)
+  {
+    auto x = static_cast<TypeParam>((i * 7919) % 1000);
+    auto y = static_cast<TypeParam>((i * 104729) % 997);
+    auto z = static_cast<TypeParam>(i % 101);
+    triangles.push_back({{x, y, z}, {x + 2, y, z}, {x, y + 2, z + 1}});
+  }
+
+  for (auto policy : {SplitPolicy::MIDDLE, SplitPolicy::SAH})
+  {
+    KdTree<TypeParam> sequential{};
+    sequential.setSplitPolicy(policy);
+    KdTree<TypeParam> parallel{};
+    parallel.setSplitPolicy(policy);
+    parallel.setThreadCount(4);
+
+    // Act
+    sequential.build(triangles.begin(), triangles.end());
+    parallel.build(triangles.begin(), triangles.end());
+
+    // Assert
+    std::stringstream seqDump{};
+    std::stringstream parDump{};
+    sequential.dumpRecursive(seqDump);
+    parallel.dumpRecursive(parDump);
+
+    EXPECT_EQ(parallel.threadCount(), 4);
+    EXPECT_EQ(parallel.nodeCount(), sequential.nodeCount());
+    EXPECT_EQ(parDump.str(), seqDump.str());
+  }
+}
+
+TYPED_TEST(KdTreeTest, findIntersectingIndices)
+{
+  // Arrange
+  std::vector<Triangle<TypeParam>> triangles{};
+  for (int i = 0; i < 300; ++i)
+  {
+    auto x = static_cast<TypeParam>((i * 37) % 50);
+    auto y = static_cast<TypeParam>((i * 11) % 23);
+    auto z = static_cast<TypeParam>(i % 7);
+    triangles.push_back({{x, y, z}, {x + 3, y, z + 1}, {x, y + 3, z - 1}});
+  }
+
+  std::vector<Index> expected{};
+  for (std::size_t i = 0; i < triangles.size(); ++i)
+    for (std::size_t j = 0; j < triangles.size(); ++j)
+      if (i != j && isIntersect(triangles[i], triangles[j]))
+      {
+        expected.push_back(i);
+        break;
+      }
+
+  for (auto nThreads : {std::size_t{1}, std::size_t{4}})
+  {
+    KdTree<TypeParam> tree{};
+    tree.setThreadCount(nThreads);
+    tree.setNodeCapacity(4);
+    tree.build(triangles.begin(), triangles.end());
+
+    // Act
+    auto found = tree.findIntersectingIndices();
+
+    // Assert
+    EXPECT_EQ(found, expected);
+  }
+
+  /* Copies share the pool of the original tree */
+  KdTree<TypeParam> tree{};
+  tree.setThreadCount(3);
+  tree.setNodeCapacity(4);
+  tree.build(triangles.begin(), triangles.end());
+  auto copy = tree;
+
+  std::vector<Index> foundByCopy{};
+  std::thread other{[&copy, &foundByCopy] { foundByCopy = copy.findIntersectingIndices(); }};
+  auto found = tree.findIntersectingIndices();
+  other.join();
+
+  EXPECT_EQ(found, expected);
+  EXPECT_EQ(foundByCopy, expected);
+}
+
+TYPED_TEST(KdTreeTest, buildSoA)
+{
+  // Arrange
+  std::vector<Triangle<TypeParam>> triangles{};
+  for (int i = 0; i < 100; ++i)
+  {
+    auto x = static_cast<TypeParam>((i * 37) % 50);
+    auto y = static_cast<TypeParam>((i * 11) % 23);
+    triangles.push_back({{x, y, 0}, {x + 3, y, 1}, {x, y + 3, -1}});
+  }
+  TriangleSoA<TypeParam> soa{triangles.begin(), triangles.end()};
+
+  KdTree<TypeParam> expected{};
+  expected.setNodeCapacity(4);
+  expected.build(triangles.begin(), triangles.end());
+
+  std::stringstream expectedDump{};
+  expected.dumpRecursive(expectedDump);
+
+  for (auto nThreads : {std::size_t{1}, std::size_t{3}})
+  {
+    // Act
+    KdTree<TypeParam> tree{};
+    tree.setThreadCount(nThreads);
+    tree.setNodeCapacity(4);
+    tree.build(soa);
+
+    // Assert
+    std::stringstream dump{};
+    tree.dumpRecursive(dump);
+
+    EXPECT_EQ(tree.size(), expected.size());
+    EXPECT_EQ(tree.nodeCount(), expected.nodeCount());
+    EXPECT_EQ(dump.str(), expectedDump.str());
+    EXPECT_EQ(tree.findIntersectingIndices(), expected.findIntersectingIndices());
+  }
+}
+
+TYPED_TEST(KdTreeTest, thresholdPerTree)
+{
+  // Arrange
+  std::vector<Triangle<TypeParam>> triangles{};
+  for (int i = 0; i < 50; ++i)
+  {
+    auto x = static_cast<TypeParam>(3 * i);
+    auto px = x - static_cast<TypeParam>(0.01);
+    auto py = static_cast<TypeParam>(0.2);
+    triangles.push_back({{x, 0, 0}, {x + 1, 0, 0}, {x, 1, 0}});
+    triangles.push_back({{px, py, 0}, {px, py, 0}, {px, py, 0}});
+  }
+
+  auto query = [&triangles](TypeParam thres) {
+    KdTree<TypeParam> tree{};
+    tree.setThreadCount(4);
+    tree.setNodeCapacity(2);
+    tree.setThreshold(thres);
+    tree.build(triangles.begin(), triangles.end());
+    return tree.findIntersectingIndices();
+  };
+
+  // Act
+  std::vector<Index> coarse{};
+  std::thread coarseThread{
+    [&coarse, &query] { coarse = query(static_cast<TypeParam>(0.1)); }};
+  auto fine = query(ThresComp<TypeParam>::getThreshold());
+  coarseThread.join();
+
+  // Assert
+  EXPECT_TRUE(fine.empty());
+  EXPECT_EQ(coarse.size(), triangles.size());
+  EXPECT_EQ(KdTree<TypeParam>{}.threshold(), ThresComp<TypeParam>::getThreshold());
+}
+
+TYPED_TEST(KdTreeTest, mixedPrecision)
+{
+  // Arrange
+  std::vector<Triangle<TypeParam>> triangles{};
+  std::vector<Triangle<double>> trianglesDouble{};
+  for (int i = 0; i < 200; ++i)
+  {
+    auto x = static_cast<TypeParam>((i * 37) % 50);
+    auto y = static_cast<TypeParam>((i * 11) % 23);
+    auto z = static_cast<TypeParam>(i % 7);
+    triangles.push_back({{x, y, z}, {x + 3, y, z + 1}, {x, y + 3, z - 1}});
+  }
+  triangles.push_back({{100, 100, 0}, {101, 100, 0}, {100, 101, 0}});
+  triangles.push_back(detail::toPrecision<TypeParam>(
+    Triangle<double>{{100.1, 100.1, -1e-6}, {100.2, 100.1, -1e-6}, {109, 109, 1e-6}}));
+
+  for (const auto &tr : triangles)
+    trianglesDouble.push_back(detail::toPrecision<double>(tr));
+
+  KdTree<double> expected{};
+  expected.setNodeCapacity(4);
+  expected.build(trianglesDouble.begin(), trianglesDouble.end());
+
+  for (auto nThreads : {std::size_t{1}, std::size_t{4}})
+  {
+    KdTree<TypeParam> tree{};
+    tree.setThreadCount(nThreads);
+    tree.setNodeCapacity(4);
+    tree.setMixedPrecision(true);
+    tree.build(triangles.begin(), triangles.end());
+
+    // Act
+    auto found = tree.findIntersectingIndices();
+
+    // Assert
+    EXPECT_TRUE(tree.isMixedPrecision());
+    EXPECT_EQ(found, expected.findIntersectingIndices());
+  }
+}
+
+TYPED_TEST(KdTreeTest, findIntersectingPairs)
+{
+  // Arrange
+  std::vector<Triangle<TypeParam>> triangles{};
+  for (int i = 0; i < 200; ++i)
+  {
+    auto x = static_cast<TypeParam>((i * 13) % 40);
+    auto z = static_cast<TypeParam>(i % 5);
+    triangles.push_back({{x, 0, z}, {x + 2, 0, z + 1}, {x, 2, z - 1}});
+  }
+
+  std::vector<IndexPair> expected{};
+  for (std::size_t i = 0; i < triangles.size(); ++i)
+    for (std::size_t j = i + 1; j < triangles.size(); ++j)
+      if (isIntersect(triangles[i], triangles[j]))
+        expected.emplace_back(i, j);
+
+  KdTree<TypeParam> tree{};
+  tree.setThreadCount(3);
+  tree.setNodeCapacity(4);
+  tree.build(triangles.begin(), triangles.end());
+
+  // Act
+  std::vector<IndexPair> pairs{};
+  tree.findIntersectingPairs(pairs);
+
+  std::vector<IndexPair> reported{};
+  tree.findIntersectingPairs([&reported](auto lhs, auto rhs) { reported.emplace_back(lhs, rhs); });
+  std::sort(reported.begin(), reported.end());
+
+  std::vector<bool> bitmap{};
+  tree.findIntersectingIndices(bitmap);
+
+  // Assert
+  ASSERT_FALSE(expected.empty());
+  EXPECT_EQ(pairs, expected);
+  EXPECT_EQ(reported, expected);
+
+  ASSERT_EQ(bitmap.size(), triangles.size());
+  std::vector<bool> expectedBitmap(triangles.size());
+  for (auto [lhs, rhs] : expected)
+    expectedBitmap[lhs] = expectedBitmap[rhs] = true;
+  EXPECT_EQ(bitmap, expectedBitmap);
+}
+
+TYPED_TEST(KdTreeTest, findIntersectingStraddling)
+{
+  // Arrange
+  std::vector<Triangle<TypeParam>> triangles{};
+  for (int i = 0; i < 100; ++i)
+  {
+    auto x = static_cast<TypeParam>((i * 17) % 100);
+    auto y = static_cast<TypeParam>((i * 29) % 100);
+    triangles.push_back({{x, y, 0}, {x + 1, y, 1}, {x, y + 1, -1}});
+  }
+
+  /* Long triangles crossing many cells stay in nodes close to the root */
+  for (int i = 0; i < 20; ++i)
+  {
+    auto y = static_cast<TypeParam>(i * 5);
+    triangles.push_back({{-1, y, 0}, {101, y + 1, 0}, {-1, y + 2, 0}});
+  }
+
+  /* Query never passes triangles with disjoint bound boxes to narrow phase */
+  std::vector<IndexPair> expected{};
+  for (std::size_t i = 0; i < triangles.size(); ++i)
+    for (std::size_t j = i + 1; j < triangles.size(); ++j)
+      if (triangles[i].boundBox().overlaps(triangles[j].boundBox()) &&
+          isIntersect(triangles[i], triangles[j]))
+        expected.emplace_back(i, j);
+
+  KdTree<TypeParam> tree{triangles.begin(), triangles.end()};
+
+  // Act
+  std::vector<IndexPair> pairs{};
+  tree.findIntersectingPairs(pairs);
+
+  // Assert
+  ASSERT_FALSE(expected.empty());
+  EXPECT_EQ(pairs, expected);
+}
+
+TYPED_TEST(KdTreeTest, findIntersectingPairsTwoTrees)
+{
+  // Arrange
+  std::vector<Triangle<TypeParam>> lhsTriangles{};
+  std::vector<Triangle<TypeParam>> rhsTriangles{};
+  for (int i = 0; i < 150; ++i)
+  {
+    auto x = static_cast<TypeParam>((i * 13) % 60);
+    auto y = static_cast<TypeParam>((i * 7) % 30);
+    lhsTriangles.push_back({{x, y, 0}, {x + 2, y, 0}, {x, y + 2, 0}});
+    rhsTriangles.push_back({{x + 1, y, -1}, {x + 1, y + 1, 1}, {x + 2, y + 1, 1}});
+  }
+
+  std::vector<IndexPair> expected{};
+  for (std::size_t i = 0; i < lhsTriangles.size(); ++i)
+    for (std::size_t j = 0; j < rhsTriangles.size(); ++j)
+      if (lhsTriangles[i].boundBox().overlaps(rhsTriangles[j].boundBox()) &&
+          isIntersect(lhsTriangles[i], rhsTriangles[j]))
+        expected.emplace_back(i, j);
+
+  KdTree<TypeParam> rhs{rhsTriangles.begin(), rhsTriangles.end()};
+
+  for (auto nThreads : {std::size_t{1}, std::size_t{3}})
+  {
+    KdTree<TypeParam> lhs{};
+    lhs.setThreadCount(nThreads);
+    lhs.build(lhsTriangles.begin(), lhsTriangles.end());
+
+    // Act
+    std::vector<IndexPair> pairs{};
+    lhs.findIntersectingPairs(rhs, pairs);
+
+    std::vector<IndexPair> reported{};
+    lhs.findIntersectingPairs(rhs, [&reported](auto l, auto r) { reported.emplace_back(l, r); });
+    std::sort(reported.begin(), reported.end());
+
+    // Assert
+    ASSERT_FALSE(expected.empty());
+    EXPECT_EQ(pairs, expected);
+    EXPECT_EQ(reported, expected);
+  }
+}
+
+TYPED_TEST(KdTreeTest, saveLoad)
+{
+  // Arrange
+  std::vector<Triangle<TypeParam>> triangles{};
+  for (int i = 0; i < 300; ++i)
+  {
+    auto x = static_cast<TypeParam>((i * 13) % 50);
+    auto y = static_cast<TypeParam>((i * 7) % 20);
+    auto z = static_cast<TypeParam>(i % 3);
+    triangles.push_back({{x, y, z}, {x + 2, y, z + 1}, {x, y + 2, z - 1}});
+  }
+
+  KdTree<TypeParam> tree{};
+  tree.setSplitPolicy(SplitPolicy::SAH);
+  tree.setNodeCapacity(4);
+  tree.setThreshold(static_cast<TypeParam>(0.01));
+  tree.build(triangles.begin(), triangles.end());
+
+  // Act
+  std::ostringstream oss{};
+  tree.save(oss);
+  auto data = std::make_shared<std::string>(oss.str());
+  auto loaded = KdTree<TypeParam>::load(*data, data);
+  data.reset();
+
+  // Assert
+  std::stringstream origDump{};
+  std::stringstream loadedDump{};
+  tree.dumpRecursive(origDump);
+  loaded.dumpRecursive(loadedDump);
+
+  EXPECT_EQ(loaded.size(), tree.size());
+  EXPECT_EQ(loaded.nodeCapacity(), tree.nodeCapacity());
+  EXPECT_EQ(loaded.splitPolicy(), tree.splitPolicy());
+  EXPECT_EQ(loaded.threshold(), tree.threshold());
+  EXPECT_EQ(loadedDump.str(), origDump.str());
+  EXPECT_EQ(loaded.findIntersectingIndices(), tree.findIntersectingIndices());
+
+  /* Loaded tree is copied on the first modification, the original one stays intact */
+  Triangle<TypeParam> tr{{0, 0, -1}, {1, 0, 1}, {0, 1, 1}};
+  auto copy = loaded;
+  tree.insert(tr);
+  loaded.insert(tr);
+  EXPECT_EQ(loaded.size(), copy.size() + 1);
+  EXPECT_EQ(loaded.findIntersectingIndices(), tree.findIntersectingIndices());
+}
+
+TYPED_TEST(KdTreeTest, loadMalformed)
+{
+  // Arrange
+  std::vector<Triangle<TypeParam>> triangles{};
+  for (int i = 0; i < 50; ++i)
+  {
+    auto sh = static_cast<TypeParam>(i);
+    triangles.push_back({{sh, 0, 0}, {sh + 1, 0, 0}, {sh, 1, 1}});
+  }
+
+  KdTree<TypeParam> tree{triangles.begin(), triangles.end()};
+  std::ostringstream oss{};
+  tree.save(oss);
+  auto data = oss.str();
+
+  auto badChild = data;
+  auto childOffset = sizeof(TreeFileHeader) + offsetof(Node<TypeParam>, children);
+  std::memset(badChild.data() + childOffset, 0xff, sizeof(NodeId));
+
+  auto badIndex = data;
+  TreeFileHeader header{};
+  std::memcpy(&header, data.data(), sizeof(header));
+  std::memset(badIndex.data() + header.sectionOffsets()[1], 0xff, sizeof(Index));
+
+  // Act & Assert
+  ASSERT_NO_THROW(KdTree<TypeParam>::load(data));
+  EXPECT_THROW(KdTree<TypeParam>::load(data.substr(0, data.size() - 1)), std::runtime_error);
+  EXPECT_THROW(KdTree<TypeParam>::load(data.substr(0, 16)), std::runtime_error);
+  EXPECT_THROW(KdTree<TypeParam>::load(badChild), std::runtime_error);
+  EXPECT_THROW(KdTree<TypeParam>::load(badIndex), std::runtime_error);
+  EXPECT_NO_THROW(KdTree<TypeParam>::load(badIndex, {}, false));
+  if constexpr (std::is_same_v<TypeParam, float>)
+    EXPECT_THROW(KdTree<double>::load(data), std::runtime_error);
+  else
+    EXPECT_THROW(KdTree<float>::load(data), std::runtime_error);
+}
+
+TEST(ThreadPoolTest, taskGroup)
+{
+  // Arrange
+  ThreadPool pool{4};
+  std::atomic<int> counter{0};
+
+  // Act
+  {
+    ThreadPool::TaskGroup group{pool};
+    for (int i = 0; i < 100; ++i)
+      group.run([&counter] { ++counter; });
+    group.wait();
+  }
+
+  // Assert
+  EXPECT_EQ(counter, 100);
+}
+
+TEST(ThreadPoolTest, taskGroupException)
+{
+  // Arrange
+  ThreadPool pool{2};
+  ThreadPool::TaskGroup group{pool};
+
+  // Act
+  group.run([] { throw std::runtime_error("task failed"); });
+
+  // Assert
+  EXPECT_THROW(group.wait(), std::runtime_error);
+}
+
+TEST(ThreadPoolTest, parallelFor)
+{
+  // Arrange
+  ThreadPool pool{3};
+  std::vector<std::vector<std::size_t>> buffers(pool.size());
+
+  // Act
+  pool.parallelFor(0, 1000, 7, [&pool, &buffers](auto begin, auto end) {
+    for (auto i = begin; i < end; ++i)
+      buffers[pool.workerIndex()].push_back(i);
+  });
+
+  // Assert
+  std::multiset<std::size_t> all{};
+  for (const auto &buffer : buffers)
+    all.insert(buffer.begin(), buffer.end());
+
+  ASSERT_EQ(all.size(), 1000);
+  EXPECT_EQ(*all.begin(), 0);
+  EXPECT_EQ(*all.rbegin(), 999);
+  EXPECT_EQ(std::set<std::size_t>(all.begin(), all.end()).size(), 1000);
+}
+
+TEST(ThreadPoolTest, enterFromManyThreads)
+{
+  // Arrange
+  ThreadPool pool{3};
+  std::vector<std::size_t> owners(pool.size(), 0);
+  std::atomic<bool> isShared{false};
+  auto work = [&pool, &owners, &isShared] {
+    for (int round = 0; round < 50; ++round)
+      pool.enter([&] {
+        pool.parallelFor(0, 64, 1, [&](auto, auto) {
+          auto idx = pool.workerIndex();
+          if (0 != std::exchange(owners[idx], idx + 1))
+            isShared = true;
+          owners[idx] = 0;
+        });
+      });
+  };
+
+  // Act
+  std::thread other{work};
+  work();
+  other.join();
+
+  // Assert
+  EXPECT_FALSE(isShared);
+}
+
 #include "test_footer.hh"
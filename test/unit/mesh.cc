@@ -0,0 +1,232 @@
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "io/io.hh"
+#include "kdtree/kdtree.hh"
+#include "test_header.hh"
+
+using namespace geom;
+
+template <typename T>
+class MeshTest : public testing::Test
+{};
+
+TYPED_TEST_SUITE(MeshTest, FPTypes);
+
+template <typename T>
+void expectTriangle(const Triangle<T> &tr, std::array<float, 9> coords)
+{
+  for (std::size_t k = 0; k < 3; ++k)
+  {
+    EXPECT_EQ(tr[k].x, static_cast<T>(coords[3 * k]));
+    EXPECT_EQ(tr[k].y, static_cast<T>(coords[3 * k + 1]));
+    EXPECT_EQ(tr[k].z, static_cast<T>(coords[3 * k + 2]));
+  }
+}
+
+template <typename U>
+void appendBytes(std::string &str, U val, bool isBigEndian = false)
+{
+  std::array<char, sizeof(U)> bytes{};
+  std::memcpy(bytes.data(), &val, sizeof(U));
+  if (isBigEndian)
+    std::reverse(bytes.begin(), bytes.end());
+  str.append(bytes.data(), bytes.size());
+}
+
+std::string binaryStl(const std::vector<std::array<float, 9>> &facets)
+{
+  std::string res = "solid but actually binary";
+  res.resize(80, ' ');
+  appendBytes(res, static_cast<std::uint32_t>(facets.size()));
+  for (const auto &facet : facets)
+  {
+    for (std::size_t i = 0; i < 3; ++i)
+      appendBytes(res, 0.0f);
+    for (auto coord : facet)
+      appendBytes(res, coord);
+    appendBytes(res, std::uint16_t{0});
+  }
+
+  return res;
+}
+
+TYPED_TEST(MeshTest, binaryStl)
+{
+  // Arrange
+  std::vector<std::array<float, 9>> facets{{0, 0, 0, 1, 0, 0, 0, 1, 0},
+                                           {0.5f, -2, 3, 4, 5, 6, 7, 8, 9.25f}};
+  auto data = binaryStl(facets);
+
+  // Act
+  auto trs = io::loadStl<TypeParam>(data);
+
+  // Assert
+  ASSERT_EQ(trs.size(), 2);
+  expectTriangle(trs[0], facets[0]);
+  expectTriangle(trs[1], facets[1]);
+  EXPECT_THROW(io::loadStl<TypeParam>(data.substr(0, data.size() - 1)), std::runtime_error);
+}
+
+TYPED_TEST(MeshTest, asciiStl)
+{
+  // Arrange
+  std::string data = "solid cube\n"
+                     "  facet normal 0 0 1\n"
+                     "    outer loop\n"
+                     "      vertex 0 0 0\n"
+                     "      vertex 1 0 0\n"
+                     "      vertex 0 1 0\n"
+                     "    endloop\n"
+                     "  endfacet\n"
+                     "  facet normal 0 0 -1\r\n"
+                     "    outer loop\r\n"
+                     "      vertex 0.5 -2 3e0\r\n"
+                     "      vertex 4 5 6\r\n"
+                     "      vertex 7 8 9.25\r\n"
+                     "    endloop\r\n"
+                     "  endfacet\r\n"
+                     "endsolid cube\n";
+
+  // Act
+  auto trs = io::loadStl<TypeParam>(data);
+
+  // Assert
+  ASSERT_EQ(trs.size(), 2);
+  expectTriangle(trs[0], {0, 0, 0, 1, 0, 0, 0, 1, 0});
+  expectTriangle(trs[1], {0.5f, -2, 3, 4, 5, 6, 7, 8, 9.25f});
+  EXPECT_THROW(io::loadStl<TypeParam>("solid x\nfacet outer loop vertex 0 0 0 endloop"),
+               std::runtime_error);
+  EXPECT_THROW(io::loadStl<TypeParam>("solid x\nvertex 0 0 zero"), std::runtime_error);
+  EXPECT_THROW(io::loadStl<TypeParam>("not an stl"), std::runtime_error);
+}
+
+TYPED_TEST(MeshTest, obj)
+{
+  // Arrange
+  std::string data = "# quad and triangle\n"
+                     "o square\n"
+                     "v 0 0 0\n"
+                     "v 1 0 0\n"
+                     "v 1 1 0\n"
+                     "v 0 1 0\n"
+                     "vn 0 0 1\n"
+                     "vt 0 0\n"
+                     "f 1/1/1 2/1/1 3/1/1 4/1/1\n"
+                     "v 0 0 5\r\n"
+                     "f -1//1 1 -3\r\n";
+
+  // Act
+  auto trs = io::loadObj<TypeParam>(data);
+
+  // Assert
+  ASSERT_EQ(trs.size(), 3);
+  expectTriangle(trs[0], {0, 0, 0, 1, 0, 0, 1, 1, 0});
+  expectTriangle(trs[1], {0, 0, 0, 1, 1, 0, 0, 1, 0});
+  expectTriangle(trs[2], {0, 0, 5, 0, 0, 0, 1, 1, 0});
+  EXPECT_THROW(io::loadObj<TypeParam>("v 0 0 0\nf 1 1"), std::runtime_error);
+  EXPECT_THROW(io::loadObj<TypeParam>("v 0 0 0\nf 1 1 2"), std::runtime_error);
+  EXPECT_THROW(io::loadObj<TypeParam>("v 0 0 0\nf 0 1 1"), std::runtime_error);
+}
+
+TYPED_TEST(MeshTest, asciiPly)
+{
+  // Arrange
+  std::string data = "ply\n"
+                     "format ascii 1.0\n"
+                     "comment made by hand\n"
+                     "element vertex 4\n"
+                     "property float x\n"
+                     "property float y\n"
+                     "property float z\n"
+                     "property uchar red\n"
+                     "element face 1\n"
+                     "property list uchar int vertex_indices\n"
+                     "property int flags\n"
+                     "element edge 1\n"
+                     "property int vertex1\n"
+                     "property int vertex2\n"
+                     "end_header\n"
+                     "0 0 0 255\n1 0 0 0\n1 1 0 0\n0 1 0 7\n"
+                     "4 0 1 2 3 42\n"
+                     "0 1\n";
+
+  // Act
+  auto trs = io::loadPly<TypeParam>(data);
+
+  // Assert
+  ASSERT_EQ(trs.size(), 2);
+  expectTriangle(trs[0], {0, 0, 0, 1, 0, 0, 1, 1, 0});
+  expectTriangle(trs[1], {0, 0, 0, 1, 1, 0, 0, 1, 0});
+  EXPECT_THROW(io::loadPly<TypeParam>(data.substr(0, data.find("4 0 1"))), std::runtime_error);
+  EXPECT_THROW(io::loadPly<TypeParam>("ply\nformat ascii 1.0\nelement vertex 1\n"),
+               std::runtime_error);
+  EXPECT_THROW(io::loadPly<TypeParam>("ply\nformat ascii 1.0\nelement vertex 1000000000000000\n"
+                                     "property float x\nend_header\n0\n"),
+               std::runtime_error);
+  EXPECT_THROW(io::loadPly<TypeParam>("obj\n"), std::runtime_error);
+}
+
+TYPED_TEST(MeshTest, binaryPly)
+{
+  for (bool isBigEndian : {false, true})
+  {
+    // Arrange
+    std::string data = "ply\n";
+    data += isBigEndian ? "format binary_big_endian 1.0\n" : "format binary_little_endian 1.0\n";
+    data += "element vertex 3\n"
+            "property double x\n"
+            "property short nx\n"
+            "property double y\n"
+            "property double z\n"
+            "element face 1\n"
+            "property list uchar uint vertex_index\n"
+            "end_header\n";
+
+    std::array<double, 9> coords{0.5, 0, 0, 1, 0, 0, 0, 1, -3};
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+      appendBytes(data, coords[3 * i], isBigEndian);
+      appendBytes(data, std::int16_t{-1}, isBigEndian);
+      appendBytes(data, coords[3 * i + 1], isBigEndian);
+      appendBytes(data, coords[3 * i + 2], isBigEndian);
+    }
+    appendBytes(data, std::uint8_t{3}, isBigEndian);
+    for (std::uint32_t idx : {2u, 1u, 0u})
+      appendBytes(data, idx, isBigEndian);
+
+    // Act
+    auto trs = io::loadPly<TypeParam>(data);
+
+    // Assert
+    ASSERT_EQ(trs.size(), 1);
+    expectTriangle(trs[0], {0, 1, -3, 1, 0, 0, 0.5, 0, 0});
+    EXPECT_THROW(io::loadPly<TypeParam>(data.substr(0, data.size() - 1)), std::runtime_error);
+  }
+}
+
+TEST(Mesh, kdtree)
+{
+  // Arrange
+  auto data = binaryStl({{0, 0, 0, 1, 0, 0, 0, 1, 0},
+                         {0.2f, 0.2f, -1, 0.2f, 0.2f, 1, 5, 5, 0},
+                         {9, 9, 9, 10, 9, 9, 9, 10, 9}});
+
+  // Act
+  kdtree::KdTree<float> tree{};
+  io::forEachStlTriangle<float>(data, [&tree](const Triangle<float> &tr) { tree.insert(tr); });
+  auto fromLoad = io::loadTriangles<float>(data, io::Format::STL);
+
+  // Assert
+  EXPECT_EQ(tree.size(), 3);
+  EXPECT_EQ(fromLoad.size(), 3);
+  EXPECT_EQ(tree.findIntersectingIndices(), (std::vector<kdtree::Index>{0, 1}));
+  EXPECT_EQ(io::toFormat("ply"), io::Format::PLY);
+  EXPECT_THROW(io::toFormat("fbx"), std::invalid_argument);
+}
+
+#include "test_footer.hh"
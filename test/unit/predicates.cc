@@ -0,0 +1,119 @@
+#include <cmath>
+#include <limits>
+
+#include "intersection/predicates.hh"
+#include "test_header.hh"
+
+using namespace geom;
+
+template <typename T>
+class PredicatesTest : public testing::Test
+{};
+
+TYPED_TEST_SUITE(PredicatesTest, FPTypes);
+
+TYPED_TEST(PredicatesTest, orient2d)
+{
+  // Arrange
+  Vec2<TypeParam> a{0, 0};
+  Vec2<TypeParam> b{1, 0};
+
+  // Act & Assert
+  EXPECT_EQ(orient2d(a, b, {0, 1}), 1);
+  EXPECT_EQ(orient2d(a, b, {0, -1}), -1);
+  EXPECT_EQ(orient2d(a, b, {5, 0}), 0);
+}
+
+TYPED_TEST(PredicatesTest, orient2dNearCollinear)
+{
+  // Arrange
+  constexpr auto inf = std::numeric_limits<TypeParam>::infinity();
+  Vec2<TypeParam> a{0.5, 0.5};
+  Vec2<TypeParam> b{12, 12};
+  TypeParam c = 24;
+
+  // Act & Assert
+  EXPECT_EQ(orient2d(a, b, {c, c}), 0);
+  EXPECT_EQ(orient2d(a, b, {c, std::nextafter(c, inf)}), 1);
+  EXPECT_EQ(orient2d(a, b, {c, std::nextafter(c, -inf)}), -1);
+  EXPECT_EQ(orient2d(a, b, {std::nextafter(c, inf), c}), -1);
+}
+
+TYPED_TEST(PredicatesTest, orient3d)
+{
+  // Arrange
+  Vec3<TypeParam> a{1, 0, 0};
+  Vec3<TypeParam> b{0, 1, 0};
+  Vec3<TypeParam> c{0, 0, 1};
+
+  // Act & Assert
+  EXPECT_EQ(orient3d(a, b, c, {1, 1, 1}), 1);
+  EXPECT_EQ(orient3d(a, b, c, {0, 0, 0}), -1);
+  EXPECT_EQ(orient3d(a, b, c, {0.5, 0.25, 0.25}), 0);
+  EXPECT_EQ(orient3d(b, a, c, {1, 1, 1}), -1);
+}
+
+TYPED_TEST(PredicatesTest, orient3dNearCoplanar)
+{
+  // Arrange
+  constexpr auto inf = std::numeric_limits<TypeParam>::infinity();
+  for (auto shift : {TypeParam{0}, TypeParam{1024}, TypeParam{-4096}})
+  {
+    Vec3<TypeParam> a{shift + 1, shift, shift};
+    Vec3<TypeParam> b{shift, shift + 1, shift};
+    Vec3<TypeParam> c{shift, shift, shift + 1};
+    auto x = shift + static_cast<TypeParam>(0.5);
+    auto y = shift + static_cast<TypeParam>(0.25);
+    auto z = y;
+
+    // Act & Assert
+    EXPECT_EQ(orient3d(a, b, c, {x, y, z}), 0) << shift;
+    EXPECT_EQ(orient3d(a, b, c, {x, y, std::nextafter(z, inf)}), 1) << shift;
+    EXPECT_EQ(orient3d(a, b, c, {x, y, std::nextafter(z, -inf)}), -1) << shift;
+  }
+}
+
+TYPED_TEST(PredicatesTest, orient3dRoundedDifferences)
+{
+  // Arrange
+  constexpr auto inf = std::numeric_limits<TypeParam>::infinity();
+  TypeParam tiny = std::numeric_limits<TypeParam>::epsilon() / 8;
+
+  // Plane z = x, differences with tiny coordinates are inexact
+  Vec3<TypeParam> a{1, 0, 1};
+  Vec3<TypeParam> b{0, 1, 0};
+  Vec3<TypeParam> c{-1, -1, -1};
+
+  // Act & Assert
+  EXPECT_EQ(orient3d(a, b, c, {tiny, tiny, tiny}), 0);
+  EXPECT_EQ(orient3d(a, b, c, {tiny, tiny, std::nextafter(tiny, inf)}), 1);
+  EXPECT_EQ(orient3d(a, b, c, {tiny, tiny, std::nextafter(tiny, -inf)}), -1);
+  EXPECT_EQ(orient3d(a, b, c, {3 * tiny, -tiny, 3 * tiny}), 0);
+  EXPECT_EQ(orient3d(a, b, c, {std::nextafter(3 * tiny, inf), -tiny, 3 * tiny}), -1);
+}
+
+TYPED_TEST(PredicatesTest, expansion)
+{
+  // Arrange
+  TypeParam big = 1 / std::numeric_limits<TypeParam>::epsilon();
+  TypeParam quarter = 0.25;
+  auto diff = detail::twoTwoDiff(big, TypeParam{}, TypeParam{}, quarter);
+  auto negDiff = detail::twoTwoDiff(TypeParam{}, quarter, big, TypeParam{});
+
+  // Act
+  auto zero = detail::sumExpansions(diff, negDiff);
+  auto scaled = detail::scaleExpansion(diff, big - 1);
+  auto prod = detail::twoOneProduct(big, -quarter, -big);
+
+  // Assert
+  EXPECT_EQ(detail::signExpansion(diff), 1);
+  EXPECT_EQ(detail::signExpansion(negDiff), -1);
+  EXPECT_EQ(detail::signExpansion(zero), 0);
+  EXPECT_EQ(zero.size(), 1);
+  EXPECT_EQ(detail::signExpansion(scaled), 1);
+  EXPECT_EQ(detail::signExpansion(prod), -1);
+  auto less = detail::sumExpansions(scaled, detail::scaleExpansion(diff, -big));
+  EXPECT_EQ(detail::signExpansion(less), -1);
+}
+
+#include "test_footer.hh"
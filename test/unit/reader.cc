@@ -0,0 +1,158 @@
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "io/io.hh"
+#include "test_header.hh"
+
+using namespace geom;
+
+template <typename T>
+class ReaderTest : public testing::Test
+{};
+
+namespace
+{
+
+/**
+ * @brief Random triangles as text with uneven spacing, streams are kept out of test bodies
+ */
+std::string makeTriangleText(std::size_t num)
+{
+  std::mt19937 gen{42};
+  std::uniform_real_distribution<double> dist{-1e3, 1e3};
+
+  auto oss = std::make_unique<std::ostringstream>();
+  oss->precision(10);
+  *oss << num << '\n';
+  for (std::size_t i = 0; i < num; ++i)
+  {
+    for (std::size_t k = 0; k < 9; ++k)
+      *oss << dist(gen) << (i % 7 == k ? "\n\n" : " ");
+    *oss << '\n';
+  }
+
+  return oss->str();
+}
+
+template <typename T>
+std::vector<Triangle<T>> readWithStream(const std::string &text)
+{
+  auto iss = std::make_unique<std::istringstream>(text);
+  std::size_t n = 0;
+  *iss >> n;
+  std::vector<Triangle<T>> res(n);
+  for (auto &tr : res)
+    *iss >> tr;
+
+  return res;
+}
+
+} // namespace
+
+TYPED_TEST_SUITE(ReaderTest, FPTypes);
+
+TYPED_TEST(ReaderTest, parse)
+{
+  // Arrange
+  std::string text = "2\n"
+                     "0 0 0\n1 0 0\n0 1 0\n\n"
+                     "\t-1.5e1 +2 .25   3e-2 4.\r\n5 6 7 8\n";
+
+  // Act
+  auto trs = io::parseTriangles<TypeParam>(text);
+
+  // Assert
+  ASSERT_EQ(trs.size(), 2);
+  EXPECT_EQ(trs[0][0], Vec3<TypeParam>(0, 0, 0));
+  EXPECT_EQ(trs[0][1], Vec3<TypeParam>(1, 0, 0));
+  EXPECT_EQ(trs[0][2], Vec3<TypeParam>(0, 1, 0));
+  EXPECT_EQ(trs[1][0].x, TypeParam(-15));
+  EXPECT_EQ(trs[1][0].y, TypeParam(2));
+  EXPECT_EQ(trs[1][0].z, TypeParam(0.25));
+  EXPECT_EQ(trs[1][1].x, static_cast<TypeParam>(3e-2L));
+  EXPECT_EQ(trs[1][2].z, TypeParam(8));
+}
+
+TYPED_TEST(ReaderTest, empty)
+{
+  EXPECT_TRUE(io::parseTriangles<TypeParam>("0").empty());
+  EXPECT_TRUE(io::parseTriangles<TypeParam>("  0\n").empty());
+}
+
+TYPED_TEST(ReaderTest, errors)
+{
+  EXPECT_THROW(io::parseTriangles<TypeParam>(""), std::runtime_error);
+  EXPECT_THROW(io::parseTriangles<TypeParam>("-1"), std::runtime_error);
+  EXPECT_THROW(io::parseTriangles<TypeParam>("1 0 0 0 1 0 0 0 1"), std::runtime_error);
+  EXPECT_THROW(io::parseTriangles<TypeParam>("1 0 0 0 1 0 0 0 x 1"), std::runtime_error);
+  EXPECT_THROW(io::parseTriangles<TypeParam>("1 0 0 0 1 0 0 0 1e"), std::runtime_error);
+  EXPECT_THROW(io::parseTriangles<TypeParam>("1 0 0 0 1,0 0 0 1 0"), std::runtime_error);
+  EXPECT_THROW(io::parseTriangles<TypeParam>("100000000000000000 0 0 0 1 0 0 0 1 0"),
+               std::runtime_error);
+  EXPECT_NO_THROW(io::parseTriangles<TypeParam>("1 0 0 0 1 0 0 0 1 0\n#trailing text"));
+}
+
+TYPED_TEST(ReaderTest, parallel)
+{
+  // Arrange
+  constexpr std::size_t kNum = 20000;
+  auto text = makeTriangleText(kNum);
+  auto expected = readWithStream<TypeParam>(text);
+
+  // Act
+  auto single = io::parseTriangles<TypeParam>(text, 1);
+  auto multi = io::parseTriangles<TypeParam>(text, 5);
+  auto soa = io::parseTrianglesSoA<TypeParam>(text, 3);
+
+  // Assert
+  ASSERT_EQ(single.size(), kNum);
+  ASSERT_EQ(multi.size(), kNum);
+  ASSERT_EQ(soa.size(), kNum);
+  for (std::size_t i = 0; i < kNum; ++i)
+    for (std::size_t k = 0; k < 3; ++k)
+    {
+      EXPECT_EQ(single[i][k].x, expected[i][k].x);
+      EXPECT_EQ(single[i][k].y, expected[i][k].y);
+      EXPECT_EQ(single[i][k].z, expected[i][k].z);
+      EXPECT_EQ(multi[i][k].x, expected[i][k].x);
+      EXPECT_EQ(multi[i][k].z, expected[i][k].z);
+      EXPECT_EQ(soa.y(k)[i], expected[i][k].y);
+    }
+
+  auto bogus = std::to_string(kNum + 1) + text.substr(text.find('\n'));
+  EXPECT_THROW(io::parseTriangles<TypeParam>(bogus, 4), std::runtime_error);
+}
+
+TEST(MappedFile, read)
+{
+  // Arrange
+  auto path = std::filesystem::temp_directory_path() / "triangles_reader_test.txt";
+  std::string text = "1\n0 0 0\n1 0 0\n0 1 0\n";
+  {
+    std::ofstream ofs{path};
+    ofs << text;
+  }
+
+  // Act
+  io::MappedFile file{path};
+  auto trs = io::parseTriangles<float>(file.view());
+  auto moved = std::move(file);
+
+  // Assert
+  EXPECT_EQ(moved.view(), text);
+  EXPECT_EQ(moved.size(), text.size());
+  ASSERT_EQ(trs.size(), 1);
+  EXPECT_EQ(trs[0][1], Vec3F(1, 0, 0));
+  EXPECT_THROW(io::MappedFile{path.string() + ".missing"}, std::system_error);
+
+  std::filesystem::remove(path);
+}
+
+#include "test_footer.hh"
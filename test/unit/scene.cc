@@ -0,0 +1,125 @@
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "io/io.hh"
+#include "test_header.hh"
+
+using namespace geom;
+
+template <typename T>
+class SceneTest : public testing::Test
+{};
+
+using SceneTypes = testing::Types<float, double>;
+TYPED_TEST_SUITE(SceneTest, SceneTypes);
+
+template <typename T>
+std::vector<Triangle<T>> sceneTriangles()
+{
+  return {{{0, 0, 0}, {1, 0, 0}, {0, 1, 0}},
+          {{-1.5, 2.25, 3}, {4, -5, 6.125}, {7, 8, -9}},
+          {{static_cast<T>(1e-3), 1e3, 0}, {0, 0, 1}, {0.5, 0.5, 0.5}}};
+}
+
+template <typename T, typename U>
+void expectEqual(const std::vector<Triangle<T>> &lhs, const std::vector<Triangle<U>> &rhs)
+{
+  ASSERT_EQ(lhs.size(), rhs.size());
+  for (std::size_t i = 0; i < lhs.size(); ++i)
+    for (std::size_t k = 0; k < 3; ++k)
+    {
+      EXPECT_EQ(lhs[i][k].x, static_cast<T>(rhs[i][k].x));
+      EXPECT_EQ(lhs[i][k].y, static_cast<T>(rhs[i][k].y));
+      EXPECT_EQ(lhs[i][k].z, static_cast<T>(rhs[i][k].z));
+    }
+}
+
+TYPED_TEST(SceneTest, roundTrip)
+{
+  // Arrange
+  auto trs = sceneTriangles<TypeParam>();
+  std::ostringstream oss{};
+
+  // Act
+  io::writeScene<TypeParam>(oss, trs);
+  auto data = oss.str();
+  io::SceneView<TypeParam> view{data};
+  std::vector<Triangle<TypeParam>> viewed(view.begin(), view.end());
+
+  // Assert
+  EXPECT_TRUE(io::isScene(data));
+  EXPECT_EQ(data.size(), sizeof(io::SceneHeader) + view.header().dataSize());
+  EXPECT_EQ(view.size(), trs.size());
+  EXPECT_TRUE(view.verify());
+  expectEqual(viewed, trs);
+  expectEqual(io::readScene<TypeParam>(data), trs);
+  expectEqual(io::loadTriangles<TypeParam>(data, io::Format::BINARY), trs);
+  expectEqual(io::readScene<long double>(data), trs);
+}
+
+TYPED_TEST(SceneTest, checksum)
+{
+  // Arrange
+  auto trs = sceneTriangles<TypeParam>();
+  std::ostringstream oss{};
+  std::ostringstream ossNoSum{};
+  io::writeScene<TypeParam>(oss, trs);
+  io::writeScene<TypeParam>(ossNoSum, trs, false);
+  auto data = oss.str();
+  auto noSum = ossNoSum.str();
+
+  // Act
+  data[sizeof(io::SceneHeader) + 5] ^= 1;
+  noSum[sizeof(io::SceneHeader) + 5] ^= 1;
+
+  // Assert
+  EXPECT_FALSE(io::SceneView<TypeParam>{data}.verify());
+  EXPECT_THROW(io::readScene<TypeParam>(data), std::runtime_error);
+  EXPECT_NO_THROW(io::readScene<TypeParam>(data, false));
+  EXPECT_TRUE(io::SceneView<TypeParam>{noSum}.verify());
+}
+
+TYPED_TEST(SceneTest, malformed)
+{
+  // Arrange
+  auto trs = sceneTriangles<TypeParam>();
+  std::ostringstream oss{};
+  io::writeScene<TypeParam>(oss, trs);
+  auto data = oss.str();
+
+  auto badVersion = data;
+  badVersion[8] = 2;
+
+  // Act & Assert
+  EXPECT_FALSE(io::isScene("3\n0 0 0"));
+  EXPECT_THROW(io::readScene<TypeParam>("3\n0 0 0"), std::runtime_error);
+  EXPECT_THROW(io::readScene<TypeParam>(data.substr(0, data.size() - 1)), std::runtime_error);
+  EXPECT_THROW(io::readScene<TypeParam>(data.substr(0, 32)), std::runtime_error);
+  EXPECT_THROW(io::readScene<TypeParam>(badVersion), std::runtime_error);
+  if constexpr (std::is_same_v<TypeParam, float>)
+    EXPECT_THROW(io::SceneView<double>{data}, std::runtime_error);
+  else
+    EXPECT_THROW(io::SceneView<float>{data}, std::runtime_error);
+}
+
+TEST(Scene, fromText)
+{
+  // Arrange
+  std::string text = "2\n0 0 0 1 0 0 0 1 0\n0.1 0.2 0.3 0.4 0.5 0.6 0.7 0.8 0.9\n";
+  auto trs = io::loadTriangles<double>(text, io::Format::TEXT);
+  std::ostringstream oss{};
+
+  // Act
+  io::writeScene<float>(oss, io::parseTriangles<float>(text));
+  auto scene = io::readScene<double>(oss.str());
+
+  // Assert
+  ASSERT_EQ(scene.size(), 2);
+  EXPECT_EQ(scene[1][1].y, static_cast<double>(0.5f));
+  EXPECT_NE(scene[1][0].x, trs[1][0].x);
+  EXPECT_EQ(static_cast<float>(scene[1][0].x), static_cast<float>(trs[1][0].x));
+}
+
+#include "test_footer.hh"
@@ -0,0 +1,162 @@
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "io/io.hh"
+#include "kdtree/kdtree.hh"
+#include "test_header.hh"
+
+using namespace geom;
+using namespace geom::kdtree;
+
+TEST(IndexBitmap, setAndVisit)
+{
+  // Arrange
+  IndexBitmap bitmap{200};
+  std::vector<Index> marked{0, 5, 63, 64, 127, 199};
+
+  // Act
+  for (auto index : marked)
+    bitmap.set(index);
+  bitmap.set(5);
+
+  std::vector<Index> visited{};
+  bitmap.forEach([&visited](auto index) { visited.push_back(index); });
+
+  // Assert
+  EXPECT_EQ(bitmap.size(), 200);
+  EXPECT_EQ(bitmap.count(), marked.size());
+  EXPECT_EQ(visited, marked);
+  EXPECT_TRUE(bitmap.test(63));
+  EXPECT_FALSE(bitmap.test(62));
+}
+
+TEST(IndexBitmap, mergeResizeReset)
+{
+  // Arrange
+  IndexBitmap lhs{10};
+  IndexBitmap rhs{100};
+  lhs.set(9);
+  rhs.set(1);
+  rhs.set(99);
+
+  // Act
+  lhs.merge(rhs);
+  auto shrunk = lhs;
+  shrunk.resize(50);
+  shrunk.resize(100);
+
+  // Assert
+  EXPECT_EQ(lhs.size(), 100);
+  EXPECT_EQ(lhs.count(), 3);
+  EXPECT_EQ(shrunk.count(), 2);
+  EXPECT_FALSE(shrunk.test(99));
+
+  lhs.reset();
+  EXPECT_EQ(lhs.count(), 0);
+  EXPECT_EQ(lhs.size(), 100);
+}
+
+TEST(PairBuffer, pushSpliceReset)
+{
+  // Arrange
+  PairBuffer lhs{};
+  PairBuffer rhs{};
+  auto nLhs = PairBuffer::kChunkSize + 10;
+  auto nRhs = 2 * PairBuffer::kChunkSize;
+
+  // Act
+  for (Index i = 0; i < nLhs; ++i)
+    lhs.emplace_back(i, i + 1);
+  for (Index i = 0; i < nRhs; ++i)
+    rhs.push_back({nLhs + i, nLhs + i + 1});
+  lhs.splice(std::move(rhs));
+  lhs.emplace_back(nLhs + nRhs, nLhs + nRhs + 1);
+
+  std::vector<IndexPair> visited{};
+  lhs.forEach([&visited](auto l, auto r) { visited.emplace_back(l, r); });
+
+  // Assert
+  ASSERT_EQ(lhs.size(), nLhs + nRhs + 1);
+  EXPECT_TRUE(rhs.empty());
+  for (Index i = 0; i < visited.size(); ++i)
+    EXPECT_EQ(visited[i], IndexPair(i, i + 1));
+
+  lhs.reset();
+  EXPECT_TRUE(lhs.empty());
+}
+
+TEST(IndexWriter, blocks)
+{
+  // Arrange
+  std::ostringstream oss{};
+  std::string expected{};
+
+  // Act
+  {
+    io::IndexWriter writer{oss, 32};
+    for (std::size_t i = 0; i < 1000; i += 7)
+    {
+      writer.write(i);
+      expected += std::to_string(i) + '\n';
+    }
+    writer.write(18446744073709551615ULL);
+    expected += "18446744073709551615\n";
+  }
+
+  // Assert
+  EXPECT_EQ(oss.str(), expected);
+}
+
+TEST(Sink, kdtreeQueries)
+{
+  // Arrange
+  std::vector<Triangle<float>> triangles{};
+  for (int i = 0; i < 500; ++i)
+  {
+    auto x = static_cast<float>((i * 13) % 70);
+    auto y = static_cast<float>((i * 7) % 40);
+    auto z = static_cast<float>(i % 5);
+    triangles.push_back({{x, y, z}, {x + 2, y, z + 1}, {x, y + 2, z - 1}});
+  }
+
+  for (auto nThreads : {std::size_t{1}, std::size_t{3}})
+  {
+    KdTree<float> tree{triangles.begin(), triangles.end()};
+    tree.setThreadCount(nThreads);
+
+    // Act
+    IndexBitmap bitmap{};
+    tree.findIntersectingIndices(bitmap);
+    std::vector<Index> fromBitmap{};
+    bitmap.forEach([&fromBitmap](auto index) { fromBitmap.push_back(index); });
+
+    PairBuffer buffer{};
+    tree.findIntersectingPairs(buffer);
+    std::vector<IndexPair> fromBuffer{};
+    buffer.forEach([&fromBuffer](auto l, auto r) { fromBuffer.emplace_back(l, r); });
+    std::sort(fromBuffer.begin(), fromBuffer.end());
+
+    std::vector<IndexPair> pairs{};
+    tree.findIntersectingPairs(pairs);
+
+    std::vector<Index> expected{};
+    for (auto [lhs, rhs] : pairs)
+    {
+      expected.push_back(lhs);
+      expected.push_back(rhs);
+    }
+    std::sort(expected.begin(), expected.end());
+    expected.erase(std::unique(expected.begin(), expected.end()), expected.end());
+
+    // Assert
+    ASSERT_FALSE(pairs.empty());
+    EXPECT_EQ(bitmap.size(), triangles.size());
+    EXPECT_EQ(fromBitmap, expected);
+    EXPECT_EQ(tree.findIntersectingIndices(), expected);
+    EXPECT_EQ(fromBuffer, pairs);
+  }
+}
+
+#include "test_footer.hh"
@@ -0,0 +1,126 @@
+#ifndef GEOM_NARROW_STATS
+#define GEOM_NARROW_STATS 1
+#endif
+
+#include <future>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "intersection/intersection.hh"
+#include "kdtree/kdtree.hh"
+#include "test_header.hh"
+
+using namespace geom;
+
+TEST(NarrowStats, exitPaths)
+{
+  // Arrange
+  Triangle<double> base{{0, 0, 0}, {2, 0, 0}, {0, 2, 0}};
+  Triangle<double> above{{0, 0, 1}, {2, 0, 1}, {0, 2, 1}};
+  Triangle<double> coplanar{{0.5, 0.5, 0}, {3, 0.5, 0}, {0.5, 3, 0}};
+  Triangle<double> crossing{{0.5, 0.5, -1}, {0.5, 0.5, 1}, {1, 0.2, 1}};
+  Triangle<double> point{{0.5, 0.5, 0}, {0.5, 0.5, 0}, {0.5, 0.5, 0}};
+  Triangle<double> far{{10, 10, 10}, {11, 10, 10}, {10, 11, 10}};
+  resetNarrowStats();
+
+  // Act
+  EXPECT_FALSE(isIntersect(base, above));
+  EXPECT_TRUE(isIntersect(base, coplanar));
+  EXPECT_TRUE(isIntersect(base, crossing));
+  EXPECT_TRUE(isIntersect(base, point));
+  EXPECT_FALSE(isIntersect(base, PreparedTriangle<double>{base}, far,
+                           PreparedTriangle<double>{far}));
+  auto stats = narrowStats();
+
+  // Assert
+  EXPECT_EQ(stats.total(), 5);
+  EXPECT_EQ(stats.intersecting, 3);
+  EXPECT_EQ(stats.count(NarrowExit::FIRST_SIDE), 1);
+  EXPECT_EQ(stats.count(NarrowExit::COPLANAR), 1);
+  EXPECT_EQ(stats.count(NarrowExit::MOLLER_HAINES), 1);
+  EXPECT_EQ(stats.count(NarrowExit::ONE_DEGENERATE), 1);
+  EXPECT_EQ(stats.count(NarrowExit::BOX), 1);
+
+  std::ostringstream oss{};
+  stats.dump(oss);
+  EXPECT_NE(oss.str().find("coplanar"), std::string::npos);
+}
+
+TEST(NarrowStats, threadsAreSummed)
+{
+  // Arrange
+  Triangle<float> lhs{{0, 0, 0}, {2, 0, 0}, {0, 2, 0}};
+  Triangle<float> rhs{{0, 0, 1}, {2, 0, 1}, {0, 2, 1}};
+  resetNarrowStats();
+
+  // Act
+  std::vector<std::thread> threads{};
+  for (int i = 0; i < 3; ++i)
+    threads.emplace_back([&] {
+      for (int k = 0; k < 10; ++k)
+        isIntersect(lhs, rhs);
+    });
+  for (auto &thread : threads)
+    thread.join();
+
+  // Assert
+  EXPECT_EQ(narrowStats().count(NarrowExit::FIRST_SIDE), 30);
+}
+
+TEST(NarrowStats, flushFromLiveThread)
+{
+  // Arrange
+  Triangle<double> lhs{{0, 0, 0}, {2, 0, 0}, {0, 2, 0}};
+  Triangle<double> rhs{{0, 0, 1}, {2, 0, 1}, {0, 2, 1}};
+  std::promise<void> flushed{};
+  std::promise<void> checked{};
+  resetNarrowStats();
+
+  // Act
+  std::thread thread{[&, done = checked.get_future()] {
+    isIntersect(lhs, rhs);
+    detail::flushNarrowStats();
+    flushed.set_value();
+    done.wait();
+  }};
+  flushed.get_future().wait();
+  auto stats = narrowStats();
+  checked.set_value();
+  thread.join();
+
+  // Assert
+  EXPECT_EQ(stats.count(NarrowExit::FIRST_SIDE), 1);
+  EXPECT_EQ(narrowStats().total(), 1);
+}
+
+TEST(NarrowStats, kdtreeQuery)
+{
+  // Arrange
+  std::vector<Triangle<float>> triangles{};
+  for (int i = 0; i < 300; ++i)
+  {
+    auto x = static_cast<float>((i * 13) % 50);
+    auto y = static_cast<float>((i * 7) % 20);
+    triangles.push_back({{x, y, 0}, {x + 2, y, 1}, {x, y + 2, -1}});
+  }
+
+  kdtree::KdTree<float> tree{triangles.begin(), triangles.end()};
+  tree.setThreadCount(2);
+  std::vector<kdtree::IndexPair> pairs{};
+  resetNarrowStats();
+
+  // Act
+  tree.findIntersectingPairs(pairs);
+  auto stats = narrowStats();
+  tree.findIntersectingPairs(pairs);
+  auto twice = narrowStats();
+
+  // Assert
+  EXPECT_EQ(stats.intersecting * 2, pairs.size());
+  EXPECT_GE(stats.total() * 2, pairs.size());
+  EXPECT_EQ(twice.intersecting, pairs.size());
+  EXPECT_EQ(twice.total(), 2 * stats.total());
+}
+
+#include "test_footer.hh"
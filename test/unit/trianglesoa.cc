@@ -0,0 +1,103 @@
+#include <cstdint>
+#include <vector>
+
+#include "primitives/primitives.hh"
+#include "test_header.hh"
+
+using namespace geom;
+
+template <typename T>
+class TriangleSoATest : public testing::Test
+{};
+
+TYPED_TEST_SUITE(TriangleSoATest, FPTypes);
+
+TYPED_TEST(TriangleSoATest, ctor)
+{
+  // Arrange
+  std::vector<Triangle<TypeParam>> trs{{{1, 2, 3}, {4, 5, 6}, {7, 8, 9}},
+                                       {{-1, -2, -3}, {0, 0, 0}, {1, 0, 1}}};
+
+  // Act
+  TriangleSoA<TypeParam> soa{trs.begin(), trs.end()};
+
+  // Assert
+  ASSERT_EQ(soa.size(), trs.size());
+  for (std::size_t i = 0; i < trs.size(); ++i)
+    for (std::size_t k = 0; k < 3; ++k)
+      EXPECT_EQ(soa[i][k], trs[i][k]);
+
+  EXPECT_EQ(soa.x(1)[0], 4);
+  EXPECT_EQ(soa.y(2)[1], 0);
+  EXPECT_EQ(soa.z(0)[1], -3);
+}
+
+TYPED_TEST(TriangleSoATest, padding)
+{
+  // Arrange
+  TriangleSoA<TypeParam> soa{};
+  constexpr auto kWidth = TriangleSoA<TypeParam>::kWidth;
+
+  // Act
+  for (std::size_t i = 0; i <= kWidth; ++i)
+  {
+    auto c = static_cast<TypeParam>(i);
+    soa.push_back({{c, 0, 0}, {0, c, 0}, {0, 0, c}});
+  }
+
+  // Assert
+  EXPECT_EQ(soa.size(), kWidth + 1);
+  EXPECT_EQ(soa.paddedSize(), 2 * kWidth);
+  for (std::size_t k = 0; k < 3; ++k)
+  {
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(soa.x(k)) % kSoAAlign, 0);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(soa.y(k)) % kSoAAlign, 0);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(soa.z(k)) % kSoAAlign, 0);
+  }
+
+  for (std::size_t i = soa.size(); i < soa.paddedSize(); ++i)
+    EXPECT_TRUE(std::isnan(soa.x(0)[i]));
+}
+
+TYPED_TEST(TriangleSoATest, resize)
+{
+  // Arrange
+  TriangleSoA<TypeParam> soa{{{1, 2, 3}, {4, 5, 6}, {7, 8, 9}}};
+
+  // Act
+  soa.resize(3);
+  soa.x(2)[2] = 1;
+  auto grown = soa;
+  soa.resize(1);
+
+  // Assert
+  ASSERT_EQ(grown.size(), 3);
+  EXPECT_EQ(grown[0][1], Vec3<TypeParam>(4, 5, 6));
+  for (std::size_t k = 0; k < 3; ++k)
+    EXPECT_EQ(grown[1][k], Vec3<TypeParam>(0, 0, 0));
+  EXPECT_EQ(grown[2][2], Vec3<TypeParam>(1, 0, 0));
+
+  ASSERT_EQ(soa.size(), 1);
+  EXPECT_EQ(soa[0][2], Vec3<TypeParam>(7, 8, 9));
+  for (std::size_t i = soa.size(); i < soa.paddedSize(); ++i)
+    EXPECT_TRUE(std::isnan(soa.z(2)[i]));
+}
+
+TYPED_TEST(TriangleSoATest, iterate)
+{
+  // Arrange
+  TriangleSoA<TypeParam> soa{{{1, 0, 0}, {0, 1, 0}, {0, 0, 0}},
+                             {{1, 0, 0}, {0, 1, 0}, {0, 1, 0}}};
+
+  // Act
+  std::vector<Triangle<TypeParam>> trs{soa.begin(), soa.end()};
+
+  // Assert
+  ASSERT_EQ(trs.size(), 2);
+  EXPECT_TRUE(trs[0].isValid());
+  EXPECT_FALSE(trs[1].isValid());
+  EXPECT_EQ(soa.boundBox(0), trs[0].boundBox());
+  EXPECT_EQ(soa.boundBox(1), trs[1].boundBox());
+}
+
+#include "test_footer.hh"
@@ -1,88 +1,153 @@
+#include <charconv>
+#include <cstring>
+#include <exception>
+#include <fstream>
 #include <iostream>
-#include <set>
-#include <stack>
-
-#include "intersection/intersection.hh"
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "io/io.hh"
 #include "kdtree/kdtree.hh"
 
 using namespace geom;
 using namespace geom::kdtree;
 
-template <std::floating_point T>
-void selfIntersect(const Container<T> &node, std::set<Index> &intInd)
+struct Options final
+{
+  std::size_t nThreads = std::thread::hardware_concurrency();
+  bool isMixed = false;
+  bool isStats = false;
+  bool isTreeStats = false;
+  std::optional<std::size_t> nodeCapacity{}; // tree default if unset, 0 means tuned for the scene
+  io::Format format = io::Format::TEXT;
+  std::string savePath{};
+  std::string loadPath{};
+};
+
+std::size_t toCount(std::string_view arg, std::string_view option)
 {
-  auto end = node.end();
-  for (auto i = node.begin(); i != end; ++i)
-    for (auto j = std::next(i); j != end; ++j)
-      if (isIntersect(*i, *j))
-        intInd.insert(i.getIndex()), intInd.insert(j.getIndex());
+  std::size_t count = 0;
+  const auto *end = arg.data() + arg.size();
+  auto [ptr, ec] = std::from_chars(arg.data(), end, count);
+  if (ec != std::errc{} || ptr != end)
+    throw std::invalid_argument("Invalid value '" + std::string{arg} + "' of " +
+                                std::string{option});
+
+  return count;
 }
 
 template <std::floating_point T>
-void intersect(typename Container<T>::ConstIterator &trIt, std::set<Index> &intInd,
-               const Container<T> &node)
+KdTree<T> makeTree(const Options &opts)
 {
-  auto left = node.left();
-  auto right = node.right();
-
-  std::stack<Container<T>> stack{};
-
-  if (left.isValid())
-    stack.push(left);
-
-  if (right.isValid())
-    stack.push(right);
-
-  while (!stack.empty())
+  if (!opts.loadPath.empty())
   {
-    auto curNode = stack.top();
-    stack.pop();
-
-    for (auto i = curNode.begin(), end = curNode.end(); i != end; ++i)
-      if (isIntersect(*i, *trIt))
-        intInd.insert(i.getIndex()), intInd.insert(trIt.getIndex());
-
-    if (KdTree<T>::isOnPosSide(curNode.sepAxis(), curNode.separator(), *trIt))
-      stack.push(curNode.right());
-    else if (KdTree<T>::isOnNegSide(curNode.sepAxis(), curNode.separator(), *trIt))
-      stack.push(curNode.left());
-    else if (curNode.sepAxis() != Axis::NONE)
-    {
-      stack.push(curNode.left());
-      stack.push(curNode.right());
-    }
+    auto file = std::make_shared<io::MappedFile>(opts.loadPath);
+    return KdTree<T>::load(file->view(), file);
   }
+
+  auto input = io::MappedFile::fromStdin();
+  auto triangles = io::loadTriangles<T>(input.view(), opts.format, opts.nThreads);
+
+  KdTree<T> tree{};
+  tree.setThreadCount(opts.nThreads);
+  if (opts.nodeCapacity == 0)
+    tree.setAutoTune(true);
+  else if (opts.nodeCapacity)
+    tree.setNodeCapacity(*opts.nodeCapacity);
+  tree.build(triangles.begin(), triangles.end());
+  return tree;
 }
 
 template <std::floating_point T>
-int lvl1Main()
+int lvl1Main(const Options &opts)
 {
-  std::size_t n = 0;
-  std::cin >> n;
-  std::set<Index> intersectIndicies{};
+  auto tree = makeTree<T>(opts);
+  tree.setThreadCount(opts.nThreads);
+  tree.setMixedPrecision(opts.isMixed);
 
-  KdTree<T> tree{};
-  for (std::size_t i = 0; i < n; ++i)
+  if (opts.isTreeStats)
   {
-    Triangle<T> tr{};
-    std::cin >> tr;
-    tree.insert(tr);
+    tree.tuneProfile().dump(std::cerr);
+    tree.stats().dump(std::cerr);
   }
 
-  for (auto cont : tree)
+  if (!opts.savePath.empty())
   {
-    selfIntersect(cont, intersectIndicies);
-    for (auto trIt = cont.begin(), trEnd = cont.end(); trIt != trEnd; ++trIt)
-      intersect<T>(trIt, intersectIndicies, cont);
+    std::ofstream ofs{opts.savePath, std::ios::binary};
+    tree.save(ofs);
+    if (!ofs)
+      throw std::runtime_error("can't write tree to " + opts.savePath);
   }
 
-  for (auto elem : intersectIndicies)
-    std::cout << elem << std::endl;
+  IndexBitmap found{};
+  tree.findIntersectingIndices(found);
+
+  io::IndexWriter writer{std::cout};
+  found.forEach([&writer](auto index) { writer.write(index); });
+  writer.flush();
+
+  if (opts.isStats && kNarrowStatsEnabled)
+    narrowStats().dump(std::cerr);
+  else if (opts.isStats)
+    std::cerr << "narrow phase stats are compiled out, configure with -DNARROW_STATS=ON"
+              << std::endl;
 
   return 0;
 }
 
-int main()
+int main(int argc, char *argv[])
 {
-  return lvl1Main<float>();
-}
\ No newline at end of file
+  try
+  {
+    Options opts{};
+
+    for (int i = 1; i < argc; ++i)
+    {
+      if (std::strcmp(argv[i], "-j") == 0 && i + 1 < argc)
+      {
+        opts.nThreads = toCount(argv[++i], "-j");
+        if (opts.nThreads == 0)
+          throw std::invalid_argument("Thread count must be positive");
+      }
+      else if (std::strcmp(argv[i], "-c") == 0 && i + 1 < argc)
+        opts.nodeCapacity = toCount(argv[++i], "-c");
+      else if (std::strcmp(argv[i], "--tune") == 0)
+        opts.nodeCapacity = 0;
+      else if (std::strcmp(argv[i], "-m") == 0)
+        opts.isMixed = true;
+      else if (std::strcmp(argv[i], "-S") == 0)
+        opts.isStats = true;
+      else if (std::strcmp(argv[i], "-q") == 0)
+        opts.isTreeStats = true;
+      else if (std::strcmp(argv[i], "-b") == 0)
+        opts.format = io::Format::BINARY;
+      else if (std::strcmp(argv[i], "-f") == 0 && i + 1 < argc)
+        opts.format = io::toFormat(argv[++i]);
+      else if (std::strcmp(argv[i], "-s") == 0 && i + 1 < argc)
+        opts.savePath = argv[++i];
+      else if (std::strcmp(argv[i], "-l") == 0 && i + 1 < argc)
+        opts.loadPath = argv[++i];
+      else
+      {
+        std::cerr << "Usage: " << argv[0]
+                  << " [-j THREADS] [-c CAPACITY | --tune] [-m] [-S] [-q] [-b | -f FORMAT]"
+                     " [-s TREE] [< input | -l TREE]"
+                  << std::endl;
+        return 1;
+      }
+    }
+
+    return lvl1Main<float>(opts);
+  }
+  catch (const std::exception &err)
+  {
+    std::cerr << argv[0] << ": " << err.what() << std::endl;
+    return 1;
+  }
+}
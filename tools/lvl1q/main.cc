@@ -1,31 +1,40 @@
+#include <exception>
 #include <iostream>
-#include <vector>
+#include <thread>
 
 #include "intersection/intersection.hh"
+#include "io/io.hh"
+#include "kdtree/sink.hh"
 #include "primitives/primitives.hh"
 
-int main()
+int main(int, char *argv[])
 {
-  std::size_t n = 0;
-  std::cin >> n;
-
-  std::vector<geom::Triangle<double>> triangles{};
-  std::vector<bool> isIntersect{};
-
-  triangles.resize(n);
-  isIntersect.resize(n);
-
-  for (auto &tr : triangles)
-    std::cin >> tr;
-
-  for (std::size_t i = 0; i < n; ++i)
-    for (std::size_t j = i + 1; j < n; ++j)
-      if (geom::isIntersect(triangles[i], triangles[j]))
-        isIntersect[i] = isIntersect[j] = true;
-
-  for (std::size_t i = 0; i < n; ++i)
-    if (isIntersect[i])
-      std::cout << i << std::endl;
+  try
+  {
+    auto input = geom::io::MappedFile::fromStdin();
+    auto triangles =
+      geom::io::parseTriangles<double>(input.view(), std::thread::hardware_concurrency());
+
+    auto n = triangles.size();
+    geom::kdtree::IndexBitmap isIntersect{n};
+
+    for (std::size_t i = 0; i < n; ++i)
+      for (std::size_t j = i + 1; j < n; ++j)
+        if (geom::isIntersect(triangles[i], triangles[j]))
+        {
+          isIntersect.set(i);
+          isIntersect.set(j);
+        }
+
+    geom::io::IndexWriter writer{std::cout};
+    isIntersect.forEach([&writer](auto index) { writer.write(index); });
+    writer.flush();
+  }
+  catch (const std::exception &err)
+  {
+    std::cerr << argv[0] << ": " << err.what() << std::endl;
+    return 1;
+  }
 
   return 0;
 }
@@ -0,0 +1,91 @@
+#include <charconv>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "io/io.hh"
+
+using namespace geom;
+
+std::size_t toCount(std::string_view arg, std::string_view option)
+{
+  std::size_t count = 0;
+  const auto *end = arg.data() + arg.size();
+  auto [ptr, ec] = std::from_chars(arg.data(), end, count);
+  if (ec != std::errc{} || ptr != end)
+    throw std::invalid_argument("Invalid value '" + std::string{arg} + "' of " +
+                                std::string{option});
+
+  return count;
+}
+
+template <io::SceneCoord T>
+int txt2binMain(std::ostream &ost, std::size_t nThreads, bool hasChecksum)
+{
+  auto input = io::MappedFile::fromStdin();
+  auto triangles = io::parseTriangles<T>(input.view(), nThreads);
+
+  io::writeScene<T>(ost, triangles, hasChecksum);
+  ost.flush();
+  if (!ost)
+    throw std::runtime_error("Failed to write scene");
+
+  return 0;
+}
+
+int main(int argc, char *argv[])
+{
+  try
+  {
+    std::size_t nThreads = std::thread::hardware_concurrency();
+    bool isDouble = false;
+    bool hasChecksum = true;
+    const char *output = nullptr;
+
+    for (int i = 1; i < argc; ++i)
+    {
+      if (std::strcmp(argv[i], "-j") == 0 && i + 1 < argc)
+      {
+        nThreads = toCount(argv[++i], "-j");
+        if (nThreads == 0)
+          throw std::invalid_argument("Thread count must be positive");
+      }
+      else if (std::strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+        output = argv[++i];
+      else if (std::strcmp(argv[i], "-d") == 0)
+        isDouble = true;
+      else if (std::strcmp(argv[i], "-n") == 0)
+        hasChecksum = false;
+      else
+      {
+        std::cerr << "Usage: " << argv[0] << " [-j THREADS] [-d] [-n] [-o OUTPUT] < input.txt"
+                  << std::endl;
+        return 1;
+      }
+    }
+
+    std::ofstream ofs{};
+    if (output != nullptr)
+    {
+      ofs.open(output, std::ios::binary);
+      if (!ofs)
+        throw std::runtime_error(std::string{"Can't open "} + output);
+    }
+
+    auto &ost = (output != nullptr) ? static_cast<std::ostream &>(ofs) : std::cout;
+    return isDouble ? txt2binMain<double>(ost, nThreads, hasChecksum)
+                    : txt2binMain<float>(ost, nThreads, hasChecksum);
+  }
+  catch (const std::exception &err)
+  {
+    std::cerr << argv[0] << ": " << err.what() << std::endl;
+    return 1;
+  }
+}